@@ -0,0 +1,100 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "marching.h"
+#include "adaptive.h"
+
+luminance_sat *sat_alloc(const long x, const long y) {
+    luminance_sat *const sat = malloc(sizeof(luminance_sat));
+
+    sat->x    = x;
+    sat->y    = y;
+    sat->sums = malloc((x + 1) * (y + 1) * sizeof(uint32_t));
+    memset(sat->sums, 0, (y + 1) * sizeof(uint32_t));
+    return sat;
+}
+
+void sat_free(luminance_sat *const sat) {
+    free(sat->sums);
+    free(sat);
+}
+
+void sat_rows(luminance_sat   *const sat,
+              const ppm_image *const image,
+              const long tid,
+              const long nthreads) {
+    const thread_slice slice = thread_get_slice(tid, nthreads, sat->x);
+
+    for (long r = slice.start; r < slice.end; ++r) {
+        const ppm_pixel *const src = &image->data[r * image->y];
+        uint32_t        *const dst = &sat->sums[(r + 1) * (sat->y + 1)];
+        uint32_t               sum = 0;
+
+        dst[0] = 0;
+        for (long c = 0; c < sat->y; ++c) {
+            sum       += pixel_luminance(src[c]);
+            dst[c + 1] = sum;
+        }
+    }
+}
+
+void sat_columns(luminance_sat *const sat,
+                 const long tid,
+                 const long nthreads) {
+    const long         w     = sat->y + 1;
+    const thread_slice slice = thread_get_slice(tid, nthreads, w);
+
+    // Row by row over the slice, so that the accesses stay sequential
+    for (long r = 2; r <= sat->x; ++r) {
+        const uint32_t *const above = &sat->sums[(r - 1) * w];
+        uint32_t       *const row   = &sat->sums[r * w];
+
+        for (long c = slice.start; c < slice.end; ++c) {
+            row[c] += above[c];
+        }
+    }
+}
+
+static void sample_row_adaptive(unsigned char       *const row,
+                                const ppm_image     *const image,
+                                const luminance_sat *const sat,
+                                const long window,
+                                const long offset,
+                                const long i) {
+    const long q = image->y / STEP;
+
+    for (long j = 0; j <= q; ++j) {
+        const long     pixel = grid_sample_offset(image, i, j);
+        long           area;
+        const uint64_t sum   = sat_window(sat, pixel / image->y, pixel % image->y, window, &area);
+
+        // lum <= sum / area - offset, without dividing
+        row[j] = (int64_t) (pixel_luminance(image->data[pixel]) + offset) * area <= (int64_t) sum;
+    }
+}
+
+void sample_grid_adaptive(unsigned char       **const grid,
+                          const ppm_image      *const image,
+                          const luminance_sat  *const sat,
+                          const long window,
+                          const long offset,
+                          cancel_token         *const cancel,
+                          const long tid,
+                          const long nthreads) {
+    const long         p     = image->x / STEP;
+    const thread_slice slice = thread_get_slice(tid, nthreads, p);
+
+    for (long i = slice.start; i < slice.end; ++i) {
+        if ((i - slice.start) % (CANCEL_BAND_ROWS / STEP) == 0 && cancel_check(cancel)) {
+            return;
+        }
+        sample_row_adaptive(grid[i], image, sat, window, offset, i);
+    }
+
+    // Task reserved for the thread having the last slice of the range
+    if (tid == nthreads - 1 && !cancel_check(cancel)) {
+        sample_row_adaptive(grid[p], image, sat, window, offset, p);
+    }
+}
@@ -0,0 +1,63 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef ADAPTIVE_H
+#define ADAPTIVE_H
+
+#include <stdint.h>
+
+#include "helpers.h"
+#include "cancel.h"
+
+// Summed-area table of the luminance of an image: x + 1 rows of y + 1
+// sums, the first row and column being 0, so that entry (r, c) holds the sum
+// of the pixels above and to the left of (r, c). 32 bits are enough for
+// 2048x2048 pixels of 255.
+typedef struct {
+    long      x, y;
+    uint32_t *sums;
+} luminance_sat;
+
+luminance_sat *sat_alloc(const long x, const long y);
+void sat_free(luminance_sat *const sat);
+
+// Prefix sums along the rows of `image`, each thread taking a slice of rows
+void sat_rows(luminance_sat   *const sat,
+              const ppm_image *const image,
+              const long tid,
+              const long nthreads);
+// Prefix sums of the row sums down the columns, each thread taking a slice
+// of columns. Needs every row done.
+void sat_columns(luminance_sat *const sat,
+                 const long tid,
+                 const long nthreads);
+
+// Sum and number of the pixels in the `window` x `window` square centered on
+// (row, col), clipped to the image
+static inline uint64_t sat_window(const luminance_sat *const sat,
+                                  const long row,
+                                  const long col,
+                                  const long window,
+                                  long *const area) {
+    const long r0 = row - window / 2 < 0 ? 0 : row - window / 2;
+    const long c0 = col - window / 2 < 0 ? 0 : col - window / 2;
+    const long r1 = row - window / 2 + window > sat->x ? sat->x : row - window / 2 + window;
+    const long c1 = col - window / 2 + window > sat->y ? sat->y : col - window / 2 + window;
+    const long w  = sat->y + 1;
+
+    *area = (r1 - r0) * (c1 - c0);
+    return (uint64_t) sat->sums[r1 * w + c1] - sat->sums[r0 * w + c1]
+                    - sat->sums[r1 * w + c0] + sat->sums[r0 * w + c0];
+}
+
+// Same slicing as sample_grid, but a point is inside when its luminance is
+// at least `offset` below the mean of the window around it
+void sample_grid_adaptive(unsigned char       **const grid,
+                          const ppm_image      *const image,
+                          const luminance_sat  *const sat,
+                          const long window,
+                          const long offset,
+                          cancel_token         *const cancel,
+                          const long tid,
+                          const long nthreads);
+
+#endif
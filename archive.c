@@ -0,0 +1,255 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "archive.h"
+#include "ppm_map.h"
+
+// Offsets of the ustar header fields used here
+#define TAR_NAME     0
+#define TAR_MODE     100
+#define TAR_UID      108
+#define TAR_GID      116
+#define TAR_SIZE     124
+#define TAR_MTIME    136
+#define TAR_CHKSUM   148
+#define TAR_TYPEFLAG 156
+#define TAR_MAGIC    257
+#define TAR_VERSION  263
+#define TAR_PREFIX   345
+
+static size_t tar_octal(const char *field, const size_t len) {
+    size_t value = 0;
+
+    for (size_t i = 0; i < len && field[i] >= '0' && field[i] <= '7'; ++i) {
+        value = value * 8 + field[i] - '0';
+    }
+    return value;
+}
+
+archive *archive_read(const char *filename) {
+    const int   fd = open(filename, O_RDONLY);
+    struct stat st;
+
+    if (fd < 0 || fstat(fd, &st)) {
+        fprintf(stderr, "Unable to open file '%s'\n", filename);
+        exit(1);
+    }
+
+    archive *const ar = calloc(1, sizeof(archive));
+    long           capacity = 64;
+
+    ar->size    = st.st_size;
+    ar->buffer  = malloc(ar->size + 1);
+    ar->entries = malloc(capacity * sizeof(archive_entry));
+
+    // One read for the whole archive, short reads aside
+    for (size_t done = 0; done < ar->size; ) {
+        const ssize_t n = read(fd, ar->buffer + done, ar->size - done);
+
+        if (n <= 0) {
+            fprintf(stderr, "Error loading archive '%s'\n", filename);
+            exit(1);
+        }
+        done += n;
+    }
+    close(fd);
+
+    char *long_name = NULL;
+
+    for (size_t offset = 0; offset + ARCHIVE_BLOCK <= ar->size; ) {
+        char *const  header = ar->buffer + offset;
+        const size_t size   = tar_octal(header + TAR_SIZE, 12);
+        char *const  data   = header + ARCHIVE_BLOCK;
+
+        // Two zero blocks end the archive, one is enough to stop
+        if (!header[TAR_NAME]) {
+            break;
+        }
+        if (data + size > ar->buffer + ar->size) {
+            fprintf(stderr, "Truncated archive '%s'\n", filename);
+            exit(1);
+        }
+        offset += ARCHIVE_BLOCK + archive_padded(size);
+
+        // GNU long names come as an entry of their own before the file
+        if (header[TAR_TYPEFLAG] == 'L') {
+            long_name = strndup(data, size);
+            continue;
+        }
+        if (header[TAR_TYPEFLAG] != '0' && header[TAR_TYPEFLAG] != '\0') {
+            free(long_name);
+            long_name = NULL;
+            continue;
+        }
+
+        if (ar->nentries == capacity) {
+            capacity    *= 2;
+            ar->entries  = realloc(ar->entries, capacity * sizeof(archive_entry));
+        }
+
+        archive_entry *const entry = &ar->entries[ar->nentries++];
+
+        if (long_name) {
+            entry->name = long_name;
+            long_name   = NULL;
+        } else if (header[TAR_PREFIX] && !memcmp(header + TAR_MAGIC, "ustar", 5)) {
+            if (asprintf(&entry->name, "%.155s/%.100s", header + TAR_PREFIX, header + TAR_NAME) < 0) {
+                exit(1);
+            }
+        } else {
+            entry->name = strndup(header + TAR_NAME, 100);
+        }
+        entry->data = data;
+        entry->size = size;
+    }
+
+    free(long_name);
+    return ar;
+}
+
+void archive_free(archive *const ar) {
+    for (long i = 0; i < ar->nentries; ++i) {
+        free(ar->entries[i].name);
+    }
+    free(ar->entries);
+    free(ar->buffer);
+    free(ar);
+}
+
+// The next number of a PPM header, skipping whitespace and comments
+static int ppm_parse_int(const char *const data, const size_t size, size_t *const pos) {
+    int value = 0;
+
+    for (;;) {
+        while (*pos < size && isspace((unsigned char) data[*pos])) {
+            ++*pos;
+        }
+        if (*pos < size && data[*pos] == '#') {
+            while (*pos < size && data[*pos] != '\n') {
+                ++*pos;
+            }
+            continue;
+        }
+        break;
+    }
+
+    if (*pos == size || !isdigit((unsigned char) data[*pos])) {
+        return -1;
+    }
+    while (*pos < size && isdigit((unsigned char) data[*pos]) && value < 1 << 20) {
+        value = value * 10 + data[(*pos)++] - '0';
+    }
+    return value;
+}
+
+ppm_pixel *ppm_parse(char *const data, const size_t size, int *const x, int *const y) {
+    size_t pos = 2;
+
+    if (size < 2 || data[0] != 'P' || data[1] != '6') {
+        return NULL;
+    }
+
+    *x = ppm_parse_int(data, size, &pos);
+    *y = ppm_parse_int(data, size, &pos);
+
+    const int maxval = ppm_parse_int(data, size, &pos);
+
+    // A single whitespace character separates the header from the pixels
+    if (*x <= 0 || *y <= 0 || maxval != RGB_COMPONENT_COLOR || pos == size
+        || size - pos - 1 < (size_t) *x * *y * sizeof(ppm_pixel)) {
+        return NULL;
+    }
+    return (ppm_pixel *) (data + pos + 1);
+}
+
+static int ppm_header(const ppm_image *const image, char *const out) {
+    return sprintf(out, "P6\n%d %d\n%d\n", image->x, image->y, RGB_COMPONENT_COLOR);
+}
+
+size_t ppm_size(const ppm_image *const image) {
+    char header[64];
+
+    return ppm_header(image, header) + (size_t) image->x * image->y * sizeof(ppm_pixel);
+}
+
+void ppm_store(const ppm_image *const image, char *const out) {
+    char      header[64];
+    const int len = ppm_header(image, header);
+
+    memcpy(out, header, len);
+    memcpy(out + len, image->data, (size_t) image->x * image->y * sizeof(ppm_pixel));
+}
+
+archive_writer *archive_create(const char *filename, const size_t size) {
+    archive_writer *const ar = malloc(sizeof(archive_writer));
+
+    // Followed by the two zero blocks ending the archive
+    ar->size = size + 2 * ARCHIVE_BLOCK;
+    ar->fd   = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (ar->fd < 0) {
+        fprintf(stderr, "Unable to open file '%s'\n", filename);
+        exit(1);
+    }
+    map_reserve(ar->fd, ar->size, filename);
+
+    ar->base = mmap(NULL, ar->size, PROT_READ | PROT_WRITE, MAP_SHARED, ar->fd, 0);
+    if (ar->base == MAP_FAILED) {
+        perror(filename);
+        exit(1);
+    }
+    return ar;
+}
+
+// The mapping starts out zeroed, only the fields that aren't 0 are set. The
+// name is cut at 100 bytes, without a NUL if it takes all of them.
+static void archive_header(char *const header, const char *name, const size_t size,
+                           const char typeflag) {
+    unsigned chksum = 0;
+
+    strncpy(header + TAR_NAME, name, 100);
+    sprintf(header + TAR_MODE,  "%07o", 0644);
+    sprintf(header + TAR_UID,   "%07o", 0);
+    sprintf(header + TAR_GID,   "%07o", 0);
+    sprintf(header + TAR_SIZE,  "%011zo", size);
+    sprintf(header + TAR_MTIME, "%011lo", (unsigned long) time(NULL));
+    header[TAR_TYPEFLAG] = typeflag;
+    memcpy(header + TAR_MAGIC,   "ustar", 6);
+    memcpy(header + TAR_VERSION, "00", 2);
+
+    memset(header + TAR_CHKSUM, ' ', 8);
+    for (int i = 0; i < ARCHIVE_BLOCK; ++i) {
+        chksum += (unsigned char) header[i];
+    }
+    sprintf(header + TAR_CHKSUM, "%06o", chksum);
+}
+
+char *archive_add(archive_writer *const ar, size_t offset, const char *name, const size_t size) {
+    const size_t len = strlen(name);
+
+    // GNU tar's way: the whole name as the data of an entry of its own
+    if (len >= 100) {
+        archive_header(ar->base + offset, "././@LongLink", len + 1, 'L');
+        memcpy(ar->base + offset + ARCHIVE_BLOCK, name, len + 1);
+        offset += ARCHIVE_BLOCK + archive_padded(len + 1);
+    }
+    archive_header(ar->base + offset, name, size, '0');
+    return ar->base + offset + ARCHIVE_BLOCK;
+}
+
+void archive_close(archive_writer *const ar) {
+    munmap(ar->base, ar->size);
+    close(ar->fd);
+    free(ar);
+}
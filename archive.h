@@ -0,0 +1,69 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef ARCHIVE_H
+#define ARCHIVE_H
+
+#include <stddef.h>
+#include <string.h>
+
+#include "helpers.h"
+
+#define ARCHIVE_BLOCK 512
+
+// A regular file of a tar archive, pointing into the archive's buffer
+typedef struct {
+    char   *name;
+    char   *data;
+    size_t  size;
+} archive_entry;
+
+// A tar archive read whole with a single read, its regular files indexed
+typedef struct {
+    char          *buffer;
+    size_t         size;
+    archive_entry *entries;
+    long           nentries;
+} archive;
+
+archive *archive_read(const char *filename);
+void     archive_free(archive *const ar);
+
+// Parses the header of the P6 image held in `data`, in place. Returns its
+// pixels, which stay in `data`, or NULL if it isn't a complete P6 image.
+ppm_pixel *ppm_parse(char *const data, const size_t size, int *const x, int *const y);
+
+// Size `image` takes once written by write_ppm(), and the same bytes
+// written to `out`
+size_t ppm_size(const ppm_image *const image);
+void   ppm_store(const ppm_image *const image, char *const out);
+
+// A tar archive written through a shared mapping of its final size, so that
+// every entry can be filled in by whichever thread has it, at an offset
+// decided upfront
+typedef struct {
+    char   *base;
+    size_t  size;
+    int     fd;
+} archive_writer;
+
+// Whole blocks holding `size` bytes
+static inline size_t archive_padded(const size_t size) {
+    return (size + ARCHIVE_BLOCK - 1) / ARCHIVE_BLOCK * ARCHIVE_BLOCK;
+}
+
+// Room an entry named `name` of `size` bytes takes, headers included: names
+// of 100 bytes or more go in a GNU long name entry of their own first
+static inline size_t archive_entry_size(const char *name, const size_t size) {
+    const size_t len = strlen(name);
+
+    return (len < 100 ? 0 : ARCHIVE_BLOCK + archive_padded(len + 1)) + ARCHIVE_BLOCK + archive_padded(size);
+}
+
+// `size` is the sum of the archive_entry_size() of every entry
+archive_writer *archive_create(const char *filename, const size_t size);
+// Writes the header of an entry at `offset`, and returns where its `size`
+// bytes go
+char *archive_add(archive_writer *const ar, const size_t offset, const char *name, const size_t size);
+void  archive_close(archive_writer *const ar);
+
+#endif
@@ -0,0 +1,169 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "backend.h"
+#include "profiler.h"
+
+typedef struct {
+    const phase_fn    *phases;
+    long               nphases;
+    void              *ctx;
+    long               nthreads;
+    pthread_barrier_t  barrier;
+    // No phase starts before every thread exists: 1 once they all do, -1 if
+    // one couldn't be created and the ones that were have to leave
+    int                start;
+    pthread_mutex_t    start_lock;
+    pthread_cond_t     start_cond;
+} pthread_job;
+
+typedef struct {
+    pthread_job *job;
+    long         tid;
+} pthread_job_thread;
+
+static void *pthread_worker(void *args) {
+    pthread_job *const job = ((pthread_job_thread *) args)->job;
+    const long         tid = ((pthread_job_thread *) args)->tid;
+
+    pthread_mutex_lock(&job->start_lock);
+    while (!job->start) {
+        pthread_cond_wait(&job->start_cond, &job->start_lock);
+    }
+    const int start = job->start;
+    pthread_mutex_unlock(&job->start_lock);
+
+    if (start < 0) {
+        return NULL;
+    }
+
+    profiler_thread_begin();
+    for (long i = 0; i < job->nphases; ++i) {
+        profiler_phase(job->phases[i]);
+        job->phases[i](job->ctx, tid, job->nthreads);
+        profiler_phase(NULL);
+
+        if (i != job->nphases - 1) {
+            pthread_barrier_wait(&job->barrier);
+        }
+    }
+    profiler_thread_end();
+
+    return NULL;
+}
+
+static int pthread_run(const phase_fn *const phases,
+                       const long            nphases,
+                       void                 *ctx,
+                       const long            nthreads) {
+    pthread_job job = {
+        .phases   = phases,
+        .nphases  = nphases,
+        .ctx      = ctx,
+        .nthreads = nthreads
+    };
+
+    pthread_t          threads[nthreads];
+    pthread_job_thread args[nthreads];
+    long               created = 0;
+    int                rc      = 0;
+
+    pthread_barrier_init(&job.barrier, NULL, nthreads);
+    pthread_mutex_init(&job.start_lock, NULL);
+    pthread_cond_init(&job.start_cond, NULL);
+
+    for (; created < nthreads; ++created) {
+        args[created] = (pthread_job_thread) { .job = &job, .tid = created };
+
+        if ((rc = pthread_create(&threads[created], NULL, pthread_worker, &args[created]))) {
+            break;
+        }
+    }
+
+    pthread_mutex_lock(&job.start_lock);
+    job.start = rc ? -1 : 1;
+    pthread_cond_broadcast(&job.start_cond);
+    pthread_mutex_unlock(&job.start_lock);
+
+    for (long i = 0; i < created; ++i) {
+        const int join_rc = pthread_join(threads[i], NULL);
+
+        rc = rc ? rc : join_rc;
+    }
+
+    pthread_cond_destroy(&job.start_cond);
+    pthread_mutex_destroy(&job.start_lock);
+    pthread_barrier_destroy(&job.barrier);
+    return rc;
+}
+
+#ifdef _OPENMP
+// The tids are handed out by a worksharing loop, so the team may end up
+// smaller than nthreads without leaving any slice out. The barrier after it
+// separates the phases.
+static int openmp_run(const phase_fn *const phases,
+                      const long            nphases,
+                      void                 *ctx,
+                      const long            nthreads) {
+    #pragma omp parallel num_threads(nthreads)
+    {
+        profiler_thread_begin();
+        for (long i = 0; i < nphases; ++i) {
+            profiler_phase(phases[i]);
+            #pragma omp for schedule(static, 1) nowait
+            for (long tid = 0; tid < nthreads; ++tid) {
+                phases[i](ctx, tid, nthreads);
+            }
+            profiler_phase(NULL);
+
+            #pragma omp barrier
+        }
+        profiler_thread_end();
+    }
+
+    return 0;
+}
+#endif
+
+// Reference backend, running every slice of a phase on the calling thread
+static int serial_run(const phase_fn *const phases,
+                      const long            nphases,
+                      void                 *ctx,
+                      const long            nthreads) {
+    profiler_thread_begin();
+    for (long i = 0; i < nphases; ++i) {
+        profiler_phase(phases[i]);
+        for (long tid = 0; tid < nthreads; ++tid) {
+            phases[i](ctx, tid, nthreads);
+        }
+    }
+    profiler_phase(NULL);
+    profiler_thread_end();
+
+    return 0;
+}
+
+static const backend backends[] = {
+    { .name = "pthread", .run = pthread_run },
+#ifdef _OPENMP
+    { .name = "openmp",  .run = openmp_run  },
+#endif
+    { .name = "serial",  .run = serial_run  },
+};
+
+const backend *backend_find(const char *name) {
+    if (!name) {
+        return &backends[0];
+    }
+
+    for (size_t i = 0; i < sizeof(backends) / sizeof(backends[0]); ++i) {
+        if (!strcmp(backends[i].name, name)) {
+            return &backends[i];
+        }
+    }
+
+    return NULL;
+}
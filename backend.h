@@ -0,0 +1,25 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef BACKEND_H
+#define BACKEND_H
+
+// A phase is run once for every tid in [0, nthreads), and a phase only
+// starts after every tid finished the previous one. Phases must not wait on
+// each other's tids, as the serial backend runs them one after the other.
+typedef void (*phase_fn)(void *ctx, const long tid, const long nthreads);
+
+// `run` returns 0, or an error number if the threads couldn't be started,
+// in which case no phase was run.
+typedef struct {
+    const char *name;
+    int (*run)(const phase_fn *const phases,
+               const long            nphases,
+               void                 *ctx,
+               const long            nthreads);
+} backend;
+
+// NULL names the default backend. Returns NULL for unknown names, and for
+// the OpenMP backend when built without -fopenmp.
+const backend *backend_find(const char *name);
+
+#endif
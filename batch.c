@@ -0,0 +1,424 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <libgen.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "helpers.h"
+#include "marching.h"
+#include "batch.h"
+#include "archive.h"
+
+#define BATCH_LANES 16
+
+// One lane per image of a chunk. The 16 bit lanes hold the channel sums,
+// which don't fit in a byte.
+typedef uint8_t  lanes_u8  __attribute__((vector_size(BATCH_LANES)));
+typedef uint16_t lanes_u16 __attribute__((vector_size(2 * BATCH_LANES)));
+
+enum {
+    LOCK_BATCH_CMAP_ALLOC,
+    LOCK_BATCH_GROUP,
+    NBATCH_LOCKS
+};
+
+typedef struct {
+    char      *filename_in;
+    char      *filename_out;   // name of the entry when writing an archive
+    ppm_image *source;         // pixels left in the input archive, if any
+    ppm_image *image;
+    size_t     offset_out;     // of its entry in the output archive
+} batch_item;
+
+// Up to BATCH_LANES images of identical size, marched together
+typedef struct {
+    batch_item **items;
+    long         count;
+} batch_chunk;
+
+typedef struct {
+    batch_item       *items;
+    long              nitems;
+    batch_item      **order;
+    batch_chunk      *chunks;
+    long              nchunks;
+    ppm_image       **cmap;
+    int               cmap_loaded;
+    archive          *in;
+    const char       *filename_archive_out;
+    archive_writer   *out;
+
+    pthread_mutex_t   locks[NBATCH_LOCKS];
+} batch_shared;
+
+static int batch_is_archive(const char *const filename) {
+    const size_t len = strlen(filename);
+
+    return len > 4 && !strcmp(filename + len - 4, ".tar");
+}
+
+// `dirname_out`/basename of `filename_in`, or the path itself, made
+// relative, when the output is an archive: images of the same name in
+// different directories stay apart there
+static char *batch_output_name(const char *const dirname_out, const char *filename_in) {
+    if (!dirname_out) {
+        while (*filename_in == '/') {
+            ++filename_in;
+        }
+        return strdup(filename_in);
+    }
+
+    char *const copy = strdup(filename_in);
+    char *const base = basename(copy);
+    char *const name = malloc(strlen(dirname_out) + strlen(base) + 2);
+
+    sprintf(name, "%s/%s", dirname_out, base);
+    free(copy);
+    return name;
+}
+
+// Every P6 image of the archive becomes an item whose pixels stay where
+// they are in the archive's buffer
+static long batch_read_archive(archive     *const ar,
+                               const char  *dirname_out,
+                               batch_item **items) {
+    long nitems = 0;
+
+    *items = malloc((ar->nentries ? ar->nentries : 1) * sizeof(batch_item));
+
+    for (long i = 0; i < ar->nentries; ++i) {
+        ppm_image *const source = malloc(sizeof(ppm_image));
+
+        source->data = ppm_parse(ar->entries[i].data, ar->entries[i].size, &source->x, &source->y);
+        if (!source->data) {
+            fprintf(stderr, "batch: '%s' isn't a P6 image, skipped\n", ar->entries[i].name);
+            free(source);
+            continue;
+        }
+
+        (*items)[nitems++] = (batch_item) {
+            .filename_in  = strdup(ar->entries[i].name),
+            .filename_out = batch_output_name(dirname_out, ar->entries[i].name),
+            .source       = source
+        };
+    }
+
+    return nitems;
+}
+
+static long batch_read_list(const char   *filename_list,
+                            const char   *dirname_out,
+                            batch_item  **items) {
+    FILE *fp = fopen(filename_list, "r");
+    if (!fp) {
+        fprintf(stderr, "Unable to open file '%s'\n", filename_list);
+        exit(1);
+    }
+
+    char line[4096];
+    long nitems = 0, capacity = 64;
+
+    *items = malloc(capacity * sizeof(batch_item));
+
+    while (fgets(line, sizeof(line), fp)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (!line[0]) {
+            continue;
+        }
+
+        if (nitems == capacity) {
+            capacity *= 2;
+            *items    = realloc(*items, capacity * sizeof(batch_item));
+        }
+
+        (*items)[nitems++] = (batch_item) {
+            .filename_in  = strdup(line),
+            .filename_out = batch_output_name(dirname_out, line)
+        };
+    }
+
+    fclose(fp);
+    return nitems;
+}
+
+static int batch_compare_size(const void *a, const void *b) {
+    const ppm_image *const ia = (*(batch_item *const *) a)->image;
+    const ppm_image *const ib = (*(batch_item *const *) b)->image;
+
+    if (ia->x != ib->x) {
+        return ia->x - ib->x;
+    }
+    return ia->y - ib->y;
+}
+
+// Sorts the images by size and cuts the result into same-sized chunks
+static void batch_group(batch_shared *const shared) {
+    shared->order  = malloc(shared->nitems * sizeof(batch_item *));
+    shared->chunks = malloc(shared->nitems * sizeof(batch_chunk));
+
+    for (long i = 0; i < shared->nitems; ++i) {
+        shared->order[i] = &shared->items[i];
+    }
+    qsort(shared->order, shared->nitems, sizeof(batch_item *), batch_compare_size);
+
+    for (long i = 0; i < shared->nitems; ++i) {
+        batch_chunk *const last = shared->nchunks ? &shared->chunks[shared->nchunks - 1] : NULL;
+
+        if (!last || last->count == BATCH_LANES
+            || batch_compare_size(&last->items[0], &shared->order[i])) {
+            shared->chunks[shared->nchunks++] = (batch_chunk) {
+                .items = &shared->order[i],
+                .count = 1
+            };
+        } else {
+            ++last->count;
+        }
+    }
+}
+
+static void batch_march_chunk(const batch_chunk *const chunk,
+                              ppm_image *const *const cmap) {
+    const ppm_image *const image = chunk->items[0]->image;
+    const long             p     = image->x / STEP;
+    const long             q     = image->y / STEP;
+
+    // Unused lanes repeat the last image, their results are never read
+    const ppm_pixel *lane_data[BATCH_LANES];
+    for (long l = 0; l < BATCH_LANES; ++l) {
+        lane_data[l] = chunk->items[MIN(l, chunk->count - 1)]->image->data;
+    }
+
+    lanes_u8 *const grid = malloc((p + 1) * (q + 1) * sizeof(lanes_u8));
+    lanes_u16       red, green, blue;
+
+    for (long i = 0; i <= p; ++i) {
+        for (long j = 0; j <= q; ++j) {
+            const long offset = grid_sample_offset(image, i, j);
+
+            for (long l = 0; l < BATCH_LANES; ++l) {
+                red[l]   = lane_data[l][offset].red;
+                green[l] = lane_data[l][offset].green;
+                blue[l]  = lane_data[l][offset].blue;
+            }
+
+            grid[i * (q + 1) + j] = __builtin_convertvector(
+                (red + green + blue) / 3 <= SIGMA, lanes_u8) & 1;
+        }
+    }
+
+    for (long i = 0; i < p; ++i) {
+        const lanes_u8 *const top    = &grid[i * (q + 1)];
+        const lanes_u8 *const bottom = &grid[(i + 1) * (q + 1)];
+
+        for (long j = 0; j < q; ++j) {
+            const lanes_u8 k = top[j] << 3
+                             | top[j + 1] << 2
+                             | bottom[j + 1] << 1
+                             | bottom[j];
+
+            for (long l = 0; l < chunk->count; ++l) {
+                march_update(chunk->items[l]->image, cmap[k[l]], i * STEP, j * STEP);
+            }
+        }
+    }
+
+    free(grid);
+}
+
+void batch_march(ppm_image *const *const images,
+                 const long              nimages,
+                 ppm_image *const *const cmap) {
+    for (long i = 0; i < nimages; i += BATCH_LANES) {
+        batch_item  items[BATCH_LANES];
+        batch_item *order[BATCH_LANES];
+        const long  count = MIN(BATCH_LANES, nimages - i);
+
+        for (long l = 0; l < count; ++l) {
+            items[l].image = images[i + l];
+            order[l]       = &items[l];
+        }
+
+        batch_march_chunk(&(batch_chunk) { .items = order, .count = count }, cmap);
+    }
+}
+
+static void batch_worker_alloc(void *ctx, const long tid, const long nthreads) {
+    batch_shared *const shared = ctx;
+    (void) tid;
+    (void) nthreads;
+
+    pthread_mutex_lock(&shared->locks[LOCK_BATCH_CMAP_ALLOC]);
+    if (!shared->cmap) {
+        shared->cmap = malloc(CONTOUR_CONFIG_COUNT * sizeof(ppm_image *));
+    }
+    pthread_mutex_unlock(&shared->locks[LOCK_BATCH_CMAP_ALLOC]);
+}
+
+static void batch_worker_read(void *ctx, const long tid, const long nthreads) {
+    batch_shared *const shared = ctx;
+
+    if (!shared->cmap_loaded) {
+        init_cmap(shared->cmap, tid, nthreads);
+    }
+
+    // Large images sneaking into a batch are rescaled on their own
+    const thread_slice items = thread_get_slice(tid, nthreads, shared->nitems);
+    for (long i = items.start; i < items.end; ++i) {
+        ppm_image *const image = shared->items[i].source ? shared->items[i].source
+                                                         : read_ppm(shared->items[i].filename_in);
+
+        if (image->x <= RESCALE_X && image->y <= RESCALE_Y) {
+            shared->items[i].image = image;
+        } else {
+            ppm_image *const scaled = malloc(sizeof(ppm_image));
+            scaled->data = malloc(RESCALE_X * RESCALE_Y * sizeof(ppm_pixel));
+
+            rescale_image(image, scaled, NULL, 0, 1);
+            shared->items[i].image = scaled;
+
+            // The pixels of an archive entry belong to the archive's buffer
+            if (image != shared->items[i].source) {
+                free(image->data);
+                free(image);
+            }
+        }
+    }
+}
+
+static void batch_worker_group(void *ctx, const long tid, const long nthreads) {
+    batch_shared *const shared = ctx;
+    (void) tid;
+    (void) nthreads;
+
+    pthread_mutex_lock(&shared->locks[LOCK_BATCH_GROUP]);
+    if (!shared->chunks) {
+        batch_group(shared);
+
+        // Every image has its final size now, so does every entry of the
+        // output archive
+        if (shared->filename_archive_out) {
+            size_t size = 0;
+
+            for (long i = 0; i < shared->nitems; ++i) {
+                shared->items[i].offset_out = size;
+                size += archive_entry_size(shared->items[i].filename_out,
+                                           ppm_size(shared->items[i].image));
+            }
+            shared->out = archive_create(shared->filename_archive_out, size);
+        }
+    }
+    pthread_mutex_unlock(&shared->locks[LOCK_BATCH_GROUP]);
+}
+
+static void batch_worker_march(void *ctx, const long tid, const long nthreads) {
+    batch_shared *const shared = ctx;
+
+    const thread_slice chunks = thread_get_slice(tid, nthreads, shared->nchunks);
+    for (long i = chunks.start; i < chunks.end; ++i) {
+        batch_march_chunk(&shared->chunks[i], shared->cmap);
+
+        for (long l = 0; l < shared->chunks[i].count; ++l) {
+            const batch_item *const item = shared->chunks[i].items[l];
+
+            if (shared->out) {
+                ppm_store(item->image, archive_add(shared->out, item->offset_out,
+                                                   item->filename_out, ppm_size(item->image)));
+            } else {
+                write_ppm(item->image, item->filename_out);
+            }
+        }
+    }
+}
+
+// Frees everything batch_run() allocated. The images either came from
+// read_ppm() or the rescale, or are left in the input archive.
+static void batch_free(batch_shared *const shared) {
+    for (long i = 0; i < shared->nitems; ++i) {
+        batch_item *const item = &shared->items[i];
+
+        if (item->image && item->image != item->source) {
+            free(item->image->data);
+            free(item->image);
+        }
+        free(item->source);
+        free(item->filename_in);
+        free(item->filename_out);
+    }
+    free(shared->items);
+    free(shared->order);
+    free(shared->chunks);
+    if (shared->in) {
+        archive_free(shared->in);
+    }
+    if (!shared->cmap_loaded && shared->cmap) {
+        for (long k = 0; k < CONTOUR_CONFIG_COUNT; ++k) {
+            free(shared->cmap[k]->data);
+            free(shared->cmap[k]);
+        }
+        free(shared->cmap);
+    }
+    for (long i = 0; i < NBATCH_LOCKS; ++i) {
+        pthread_mutex_destroy(&shared->locks[i]);
+    }
+    free(shared);
+}
+
+int batch_run(const char    *filename_list,
+              const char    *dirname_out,
+              const long     nthreads,
+              const backend *engine,
+              ppm_image    **cmap) {
+    static const phase_fn phases[] = {
+        batch_worker_alloc,
+        batch_worker_read,
+        batch_worker_group,
+        batch_worker_march
+    };
+
+    batch_shared *shared = calloc(1, sizeof(*shared));
+    struct timespec begin, end;
+
+    shared->cmap        = cmap;
+    shared->cmap_loaded = cmap != NULL;
+    if (batch_is_archive(dirname_out)) {
+        shared->filename_archive_out = dirname_out;
+        dirname_out                  = NULL;
+    }
+    if (batch_is_archive(filename_list)) {
+        shared->in     = archive_read(filename_list);
+        shared->nitems = batch_read_archive(shared->in, dirname_out, &shared->items);
+    } else {
+        shared->nitems = batch_read_list(filename_list, dirname_out, &shared->items);
+    }
+
+    for (long i = 0; i < NBATCH_LOCKS; ++i) {
+        pthread_mutex_init(&shared->locks[i], NULL);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+    const int rc = engine->run(phases, sizeof(phases) / sizeof(phases[0]), shared, nthreads);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    if (rc) {
+        batch_free(shared);
+        return rc;
+    }
+    if (shared->out) {
+        archive_close(shared->out);
+    }
+
+    double pixels = 0;
+    for (long i = 0; i < shared->nitems; ++i) {
+        pixels += (double) shared->items[i].image->x * shared->items[i].image->y;
+    }
+
+    const double seconds = (end.tv_sec - begin.tv_sec) + (end.tv_nsec - begin.tv_nsec) / 1e9;
+    fprintf(stderr, "batch: %ld images in %ld chunks, %.2f MPix in %.3f s (%.2f MPix/s)\n",
+            shared->nitems, shared->nchunks, pixels / 1e6, seconds, pixels / 1e6 / seconds);
+
+    batch_free(shared);
+    return 0;
+}
@@ -0,0 +1,26 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "helpers.h"
+#include "backend.h"
+
+// Processes every image listed in `filename_list` (one path per line) and
+// writes the results to `dirname_out`, using the same file names. Images of
+// the same size are marched together, one image per SIMD lane. Either name
+// can also be a *.tar archive holding the images. The tiles are read from
+// ./contours when `cmap` is NULL.
+int batch_run(const char    *filename_list,
+              const char    *dirname_out,
+              const long     nthreads,
+              const backend *engine,
+              ppm_image    **cmap);
+
+// Marches `images` in place with the batch kernel, on the calling thread.
+// They must all have the same size.
+void batch_march(ppm_image *const *const images,
+                 const long              nimages,
+                 ppm_image *const *const cmap);
+
+#endif
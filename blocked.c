@@ -0,0 +1,124 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "marching.h"
+#include "kernels.h"
+#include "blocked.h"
+
+_Static_assert(BLOCK_SIDE % STEP == 0, "cells must not straddle blocks");
+
+blocked_image *blocked_alloc(const long x, const long y) {
+    blocked_image *const image = malloc(sizeof(blocked_image));
+
+    image->x    = x;
+    image->y    = y;
+    image->data = malloc(x * y * sizeof(ppm_pixel));
+    return image;
+}
+
+void blocked_free(blocked_image *const image) {
+    free(image->data);
+    free(image);
+}
+
+void blocked_rescale(ppm_image     *const image,
+                     blocked_image *const scaled,
+                     cancel_token  *const cancel,
+                     const long tid,
+                     const long nthreads) {
+    const long         cols  = scaled->y / BLOCK_SIDE;
+    const thread_slice slice = thread_get_slice(tid, nthreads, scaled->x / BLOCK_SIDE * cols);
+
+    // Every row of a block is a run of pixels of the row-major image
+    for (long b = slice.start; b < slice.end && !cancel_check(cancel); ++b) {
+        ppm_pixel *const block = &scaled->data[b * BLOCK_SIDE * BLOCK_SIDE];
+
+        for (long r = 0; r < BLOCK_SIDE; ++r) {
+            const long start = (b / cols * BLOCK_SIDE + r) * scaled->y + b % cols * BLOCK_SIDE;
+
+            kernels.rescale(image, &block[r * BLOCK_SIDE], start, start + BLOCK_SIDE);
+        }
+    }
+}
+
+static void blocked_sample_row(unsigned char       *const row,
+                               const blocked_image *const image,
+                               const long i) {
+    const ppm_image dims = { .x = image->x, .y = image->y };
+    const long      q    = image->y / STEP;
+
+    for (long j = 0; j <= q; ++j) {
+        const long pixel = grid_sample_offset(&dims, i, j);
+
+        row[j] = pixel_luminance(image->data[blocked_offset(image, pixel / image->y,
+                                                            pixel % image->y)]) <= SIGMA;
+    }
+}
+
+void blocked_sample_grid(unsigned char      **const grid,
+                         const blocked_image *const image,
+                         cancel_token        *const cancel,
+                         const long tid,
+                         const long nthreads) {
+    const long         p     = image->x / STEP;
+    const thread_slice slice = thread_get_slice(tid, nthreads, p);
+
+    for (long i = slice.start; i < slice.end; ++i) {
+        if ((i - slice.start) % (CANCEL_BAND_ROWS / STEP) == 0 && cancel_check(cancel)) {
+            return;
+        }
+        blocked_sample_row(grid[i], image, i);
+    }
+
+    // Task reserved for the thread having the last slice of the range
+    if (tid == nthreads - 1 && !cancel_check(cancel)) {
+        blocked_sample_row(grid[p], image, p);
+    }
+}
+
+void blocked_march(blocked_image *const image,
+                   unsigned char *const *const grid,
+                   ppm_image     *const *const cmap,
+                   cancel_token  *const cancel,
+                   const long tid,
+                   const long nthreads) {
+    const long         cols  = image->y / BLOCK_SIDE;
+    const long         cells = BLOCK_SIDE / STEP;
+    const thread_slice slice = thread_get_slice(tid, nthreads, image->x / BLOCK_SIDE * cols);
+
+    for (long b = slice.start; b < slice.end && !cancel_check(cancel); ++b) {
+        ppm_pixel *const block = &image->data[b * BLOCK_SIDE * BLOCK_SIDE];
+
+        for (long ci = 0; ci < cells; ++ci) {
+            const unsigned char *const top    = grid[b / cols * cells + ci];
+            const unsigned char *const bottom = grid[b / cols * cells + ci + 1];
+
+            for (long cj = 0; cj < cells; ++cj) {
+                const long             j = b % cols * cells + cj;
+                const ppm_image *const c = cmap[8 * top[j] + 4 * top[j + 1]
+                                                + 2 * bottom[j + 1] + bottom[j]];
+
+                for (int r = 0; r < STEP; ++r) {
+                    memcpy(&block[(ci * STEP + r) * BLOCK_SIDE + cj * STEP],
+                           &c->data[c->x * r], STEP * sizeof(ppm_pixel));
+                }
+            }
+        }
+    }
+}
+
+void blocked_unblock(const blocked_image *const image,
+                     ppm_image           *const out,
+                     const long tid,
+                     const long nthreads) {
+    const thread_slice slice = thread_get_slice(tid, nthreads, image->x);
+
+    for (long r = slice.start; r < slice.end; ++r) {
+        for (long c = 0; c < image->y; c += BLOCK_SIDE) {
+            memcpy(&out->data[r * image->y + c], &image->data[blocked_offset(image, r, c)],
+                   BLOCK_SIDE * sizeof(ppm_pixel));
+        }
+    }
+}
@@ -0,0 +1,63 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef BLOCKED_H
+#define BLOCKED_H
+
+#include "helpers.h"
+#include "cancel.h"
+
+// Side of the blocks, a multiple of STEP so that every cell lies in one
+#define BLOCK_SIDE 64
+
+// An image of x rows by y columns, both multiples of BLOCK_SIDE, stored as
+// BLOCK_SIDE x BLOCK_SIDE blocks, each contiguous and row-major, the blocks
+// themselves row by row. A cell of the march then touches BLOCK_SIDE * 3
+// bytes apart instead of a whole row apart, and a block fits in a few pages.
+typedef struct {
+    long       x, y;
+    ppm_pixel *data;
+} blocked_image;
+
+// Whether an x by y image can be blocked
+static inline int blocked_fits(const long x, const long y) {
+    return x % BLOCK_SIDE == 0 && y % BLOCK_SIDE == 0;
+}
+
+static inline long blocked_offset(const blocked_image *const image, const long row, const long col) {
+    const long block = (row / BLOCK_SIDE) * (image->y / BLOCK_SIDE) + col / BLOCK_SIDE;
+
+    return block * BLOCK_SIDE * BLOCK_SIDE + (row % BLOCK_SIDE) * BLOCK_SIDE + col % BLOCK_SIDE;
+}
+
+blocked_image *blocked_alloc(const long x, const long y);
+void           blocked_free(blocked_image *const image);
+
+// The same steps as rescale_image(), sample_grid() and march(), on a
+// RESCALE_X x RESCALE_Y blocked image. The rescale and the march go block
+// by block, the grid row by row as sample_grid() does, and `cancel` is
+// polled before every block or band of rows.
+void blocked_rescale(ppm_image     *const image,
+                     blocked_image *const scaled,
+                     cancel_token  *const cancel,
+                     const long tid,
+                     const long nthreads);
+void blocked_sample_grid(unsigned char      **const grid,
+                         const blocked_image *const image,
+                         cancel_token        *const cancel,
+                         const long tid,
+                         const long nthreads);
+void blocked_march(blocked_image *const image,
+                   unsigned char *const *const grid,
+                   ppm_image     *const *const cmap,
+                   cancel_token  *const cancel,
+                   const long tid,
+                   const long nthreads);
+
+// Rows of `image`, copied to the row-major `out` (a buffer or the mapping
+// of the output file)
+void blocked_unblock(const blocked_image *const image,
+                     ppm_image           *const out,
+                     const long tid,
+                     const long nthreads);
+
+#endif
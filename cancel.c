@@ -0,0 +1,41 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include "cancel.h"
+
+void cancel_init(cancel_token *const token, const long budget_ms) {
+    token->cancelled = 0;
+    token->timed     = budget_ms > 0;
+    clock_gettime(CLOCK_MONOTONIC, &token->deadline);
+
+    const long nsec = token->deadline.tv_nsec + budget_ms % 1000 * 1000000L;
+
+    token->deadline.tv_sec  += budget_ms / 1000 + nsec / 1000000000L;
+    token->deadline.tv_nsec  = nsec % 1000000000L;
+}
+
+void cancel_request(cancel_token *const token) {
+    __atomic_store_n(&token->cancelled, 1, __ATOMIC_RELEASE);
+}
+
+int cancel_check(cancel_token *const token) {
+    struct timespec now;
+
+    if (!token) {
+        return 0;
+    }
+    if (__atomic_load_n(&token->cancelled, __ATOMIC_ACQUIRE)) {
+        return 1;
+    }
+    if (!token->timed) {
+        return 0;
+    }
+
+    // The clock is only read while the job is on time
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if (now.tv_sec > token->deadline.tv_sec
+        || (now.tv_sec == token->deadline.tv_sec && now.tv_nsec >= token->deadline.tv_nsec)) {
+        cancel_request(token);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,31 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef CANCEL_H
+#define CANCEL_H
+
+#include <time.h>
+
+// Rows of the rescaled image between two polls of a cancel token, a
+// multiple of STEP
+#define CANCEL_BAND_ROWS 64
+
+// Cooperative cancellation of a job. The phases poll the token between
+// bands of their work and skip the rest once it is cancelled. Every thread
+// still goes through every barrier, so there is nothing to unwind, and a
+// token cancelled before a barrier is seen cancelled by every thread after.
+typedef struct {
+    int             cancelled;  // sticky, set by cancel_request() or past the deadline
+    int             timed;
+    struct timespec deadline;   // CLOCK_MONOTONIC
+} cancel_token;
+
+// A token with a deadline `budget_ms` from now, or none if it is 0
+void cancel_init(cancel_token *const token, const long budget_ms);
+
+// From any thread
+void cancel_request(cancel_token *const token);
+
+// Whether the job should stop, never for a NULL token
+int cancel_check(cancel_token *const token);
+
+#endif
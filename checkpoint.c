@@ -0,0 +1,171 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "checkpoint.h"
+
+// The band states start at a fixed offset, after a text header
+#define CHECKPOINT_HEADER_SIZE 256
+#define CHECKPOINT_MAGIC       "marching-squares checkpoint v1"
+
+static void pwrite_all(const int fd, const void *buf, size_t len, off_t offset,
+                       const char *filename) {
+    while (len) {
+        const ssize_t rc = pwrite(fd, buf, len, offset);
+
+        if (rc < 0) {
+            perror(filename);
+            exit(1);
+        }
+        buf     = (const char *) buf + rc;
+        len    -= rc;
+        offset += rc;
+    }
+}
+
+static void checkpoint_identity(char *const header,
+                                const char *filename_in,
+                                const char *filename_out,
+                                const int   x,
+                                const int   y,
+                                const long  nbands) {
+    struct stat st = { 0 };
+
+    if (filename_in && stat(filename_in, &st)) {
+        perror(filename_in);
+        exit(1);
+    }
+
+    memset(header, '\n', CHECKPOINT_HEADER_SIZE);
+    snprintf(header, CHECKPOINT_HEADER_SIZE, "%s\n%s\n%lld %lld %lld %d %d %ld\n",
+             CHECKPOINT_MAGIC, filename_out,
+             (long long) st.st_ino, (long long) st.st_size, (long long) st.st_mtime,
+             x, y, nbands);
+}
+
+// Returns 1 if the checkpoint on disk was left by the same job
+static int checkpoint_resume(checkpoint *const ckpt, const char *header) {
+    char stored[CHECKPOINT_HEADER_SIZE];
+
+    if ((ckpt->fd = open(ckpt->filename, O_RDWR)) < 0) {
+        return 0;
+    }
+
+    if (pread(ckpt->fd, stored, sizeof(stored), 0) != sizeof(stored)
+        || memcmp(stored, header, strlen(header))
+        || pread(ckpt->fd, ckpt->done, ckpt->nbands, sizeof(stored)) != ckpt->nbands) {
+        close(ckpt->fd);
+        return 0;
+    }
+
+    return 1;
+}
+
+checkpoint *checkpoint_open(const char *filename,
+                            const char *filename_in,
+                            const char *filename_out,
+                            const int   x,
+                            const int   y,
+                            const long  nbands) {
+    checkpoint *const ckpt = calloc(1, sizeof(checkpoint));
+    char header[CHECKPOINT_HEADER_SIZE];
+    char ppm_header[64];
+
+    ckpt->filename     = strdup(filename);
+    ckpt->filename_out = strdup(filename_out);
+    ckpt->nbands       = nbands;
+    ckpt->row_size     = (long) y * sizeof(ppm_pixel);
+    ckpt->done         = calloc(nbands, 1);
+    ckpt->header       = sprintf(ppm_header, "P6\n%d %d\n%d\n", x, y, RGB_COMPONENT_COLOR);
+
+    checkpoint_identity(header, filename_in, filename_out, x, y, nbands);
+
+    const off_t size_out = ckpt->header + ckpt->row_size * x;
+    struct stat st;
+
+    ckpt->fd_out = open(filename_out, O_RDWR);
+    if (ckpt->fd_out >= 0 && !fstat(ckpt->fd_out, &st) && st.st_size == size_out
+        && checkpoint_resume(ckpt, header)) {
+        long ndone = 0;
+
+        for (long i = 0; i < nbands; ++i) {
+            ndone += ckpt->done[i] = ckpt->done[i] == 1;
+        }
+        fprintf(stderr, "checkpoint: resuming '%s', %ld/%ld bands already done\n",
+                filename_out, ndone, nbands);
+        return ckpt;
+    }
+    if (ckpt->fd_out >= 0) {
+        close(ckpt->fd_out);
+    }
+
+    // Fresh start: the output gets its final size before any band is marked
+    ckpt->fd_out = open(filename_out, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (ckpt->fd_out < 0) {
+        fprintf(stderr, "Unable to open file '%s'\n", filename_out);
+        exit(1);
+    }
+    pwrite_all(ckpt->fd_out, ppm_header, ckpt->header, 0, filename_out);
+    if (ftruncate(ckpt->fd_out, size_out) || fsync(ckpt->fd_out)) {
+        perror(filename_out);
+        exit(1);
+    }
+
+    ckpt->fd = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (ckpt->fd < 0) {
+        fprintf(stderr, "Unable to open file '%s'\n", filename);
+        exit(1);
+    }
+    pwrite_all(ckpt->fd, header, sizeof(header), 0, filename);
+    pwrite_all(ckpt->fd, ckpt->done, nbands, sizeof(header), filename);
+    if (fsync(ckpt->fd)) {
+        perror(filename);
+        exit(1);
+    }
+
+    return ckpt;
+}
+
+void checkpoint_write_band(checkpoint *const ckpt,
+                           const long        band,
+                           const long        row,
+                           const long        nrows,
+                           const ppm_pixel  *pixels) {
+    static const unsigned char done = 1;
+
+    pwrite_all(ckpt->fd_out, pixels, nrows * ckpt->row_size,
+               ckpt->header + row * ckpt->row_size, ckpt->filename_out);
+    if (fdatasync(ckpt->fd_out)) {
+        perror(ckpt->filename_out);
+        exit(1);
+    }
+
+    pwrite_all(ckpt->fd, &done, 1, CHECKPOINT_HEADER_SIZE + band, ckpt->filename);
+    if (fdatasync(ckpt->fd)) {
+        perror(ckpt->filename);
+        exit(1);
+    }
+}
+
+static void checkpoint_free(checkpoint *const ckpt) {
+    close(ckpt->fd_out);
+    close(ckpt->fd);
+    free(ckpt->filename);
+    free(ckpt->filename_out);
+    free(ckpt->done);
+    free(ckpt);
+}
+
+void checkpoint_close(checkpoint *const ckpt) {
+    unlink(ckpt->filename);
+    checkpoint_free(ckpt);
+}
+
+void checkpoint_suspend(checkpoint *const ckpt) {
+    checkpoint_free(ckpt);
+}
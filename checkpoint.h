@@ -0,0 +1,47 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include "helpers.h"
+
+// Grid rows per band, the unit of work that survives a restart
+#define CHECKPOINT_BAND_CELLS 8
+
+typedef struct {
+    char          *filename;
+    char          *filename_out;
+    int            fd;       // band states, one byte each after the header
+    int            fd_out;   // output image, filled band by band
+    long           header;   // length of the PPM header in the output
+    long           row_size; // bytes in an output row
+    long           nbands;
+    unsigned char *done;     // bands already on disk when the job started
+} checkpoint;
+
+// Resumes the job recorded in `filename` if it was interrupted while marching
+// the same input into the same output, starts from scratch otherwise.
+// `filename_in` may be NULL for images not read from a file.
+checkpoint *checkpoint_open(const char *filename,
+                            const char *filename_in,
+                            const char *filename_out,
+                            const int   x,
+                            const int   y,
+                            const long  nbands);
+
+// Writes `nrows` output rows starting at `row`, then marks `band` as done.
+// Both go to stable storage before this returns.
+void checkpoint_write_band(checkpoint *const ckpt,
+                           const long        band,
+                           const long        row,
+                           const long        nrows,
+                           const ppm_pixel  *pixels);
+
+// Called once every band is done, removes the checkpoint file and frees `ckpt`
+void checkpoint_close(checkpoint *const ckpt);
+
+// Called when the job stops early, keeps the checkpoint file for the next
+// run to resume from, and frees `ckpt`
+void checkpoint_suspend(checkpoint *const ckpt);
+
+#endif
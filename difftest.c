@@ -0,0 +1,1628 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+// Differential tester: runs every kernel variant on every backend and thread
+// count over random and generated images, and diffs the results against
+// pipeline_reference().
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <getopt.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#include "helpers.h"
+#include "marching.h"
+#include "batch.h"
+#include "backend.h"
+#include "pipeline.h"
+#include "kernels.h"
+#include "archive.h"
+#include "server.h"
+#include "profiler.h"
+#include "pfm.h"
+#include "stream.h"
+
+#define MAX_THREADS     64
+#define OVERLAY_ALPHA   160
+#define ADAPTIVE_WINDOW 15
+#define ADAPTIVE_OFFSET 4
+#define NODATA_FILL     ((ppm_pixel) { 1, 2, 3 })
+#define FLOAT_THRESHOLD 127.3f
+#define FLOAT_NODATA    -9999.0f
+
+enum {
+    REFERENCE_TILES,
+    REFERENCE_OVERLAY,
+    REFERENCE_SMOOTH,
+    REFERENCE_MASKED,
+    REFERENCE_ADAPTIVE,
+    REFERENCE_FLOAT,
+    REFERENCE_FLOAT_MASKED,
+    REFERENCE_REMARCHED,
+    NREFERENCES
+};
+
+typedef struct {
+    const char *name;
+    int         tolerance;  // largest difference allowed on a channel
+    int         threaded;   // run on every backend and thread count
+    int         reference;  // REFERENCE_*, what the result must match
+    ppm_image *(*run)(ppm_image *const image,
+                      ppm_image **const cmap,
+                      const long nthreads,
+                      const backend *const engine);
+} variant;
+
+typedef struct {
+    char       name[64];
+    ppm_image *image;
+} test_input;
+
+static ppm_image *image_alloc(const int x, const int y) {
+    ppm_image *const image = malloc(sizeof(ppm_image));
+
+    image->x    = x;
+    image->y    = y;
+    image->data = malloc((size_t) x * y * sizeof(ppm_pixel));
+    return image;
+}
+
+static ppm_image *image_copy(const ppm_image *const image) {
+    ppm_image *const copy = image_alloc(image->x, image->y);
+
+    memcpy(copy->data, image->data, (size_t) image->x * image->y * sizeof(ppm_pixel));
+    return copy;
+}
+
+static void image_free(ppm_image *const image) {
+    free(image->data);
+    free(image);
+}
+
+// Runs `job` on `image`, marched in place unless it is rescaled
+static ppm_image *run_in_memory(ppm_image *const image, pipeline_job job) {
+    job.image = image;
+
+    ppm_image *const result = pipeline_run(&job);
+
+    if (result && result != image) {
+        image_free(image);
+    }
+    return result;
+}
+
+static ppm_image *run_worker(ppm_image *const image,
+                             ppm_image **const cmap,
+                             const long nthreads,
+                             const backend *const engine) {
+    return run_in_memory(image, (pipeline_job) {
+        .cmap     = cmap,
+        .nthreads = nthreads,
+        .engine   = engine
+    });
+}
+
+// Runs `job` on `image`, and reads back the output it writes to a file
+static ppm_image *run_to_file(ppm_image *const image, pipeline_job job) {
+    char filename_out[64], filename_checkpoint[64];
+
+    sprintf(filename_out,        "/tmp/difftest-%d.ppm",  getpid());
+    sprintf(filename_checkpoint, "/tmp/difftest-%d.ckpt", getpid());
+    unlink(filename_checkpoint);
+
+    job.image        = image;
+    job.filename_out = filename_out;
+    if (job.filename_checkpoint) {
+        job.filename_checkpoint = filename_checkpoint;
+    }
+
+    ppm_image *const marched = pipeline_run(&job);
+
+    if (!marched) {
+        return NULL;
+    }
+    if (marched != image) {
+        image_free(marched);
+    }
+    image_free(image);
+
+    ppm_image *const result = read_ppm(filename_out);
+    unlink(filename_out);
+    return result;
+}
+
+static ppm_image *run_checkpoint(ppm_image *const image,
+                                 ppm_image **const cmap,
+                                 const long nthreads,
+                                 const backend *const engine) {
+    return run_to_file(image, (pipeline_job) {
+        .filename_checkpoint = "",
+        .cmap                = cmap,
+        .nthreads            = nthreads,
+        .engine              = engine
+    });
+}
+
+typedef struct {
+    const char   *filename;
+    cancel_token *cancel;
+    int           finished;
+} checkpoint_watch;
+
+// Cancels the job as soon as its checkpoint records a band as done
+static void *interrupt_checkpoint(void *arg) {
+    checkpoint_watch *const watch = arg;
+
+    while (!__atomic_load_n(&watch->finished, __ATOMIC_ACQUIRE)) {
+        FILE *const fp   = fopen(watch->filename, "rb");
+        int         done = 0;
+
+        if (fp) {
+            for (int c; !done && (c = getc(fp)) != EOF; ) {
+                done = c == 1;
+            }
+            fclose(fp);
+        }
+        if (done) {
+            cancel_request(watch->cancel);
+            break;
+        }
+        usleep(100);
+    }
+    return NULL;
+}
+
+// Interrupts a checkpointed job once it has written a band, then runs it
+// again to resume from the checkpoint. Jobs too small to be interrupted in
+// time simply finish on the first run.
+static ppm_image *run_checkpoint_resumed(ppm_image *const image,
+                                         ppm_image **const cmap,
+                                         const long nthreads,
+                                         const backend *const engine) {
+    char filename_out[64], filename_checkpoint[64];
+
+    sprintf(filename_out,        "/tmp/difftest-%d.ppm",  getpid());
+    sprintf(filename_checkpoint, "/tmp/difftest-%d.ckpt", getpid());
+    unlink(filename_checkpoint);
+
+    ppm_image *const   copy  = image_copy(image);
+    cancel_token       cancel;
+    checkpoint_watch   watch = { .filename = filename_checkpoint, .cancel = &cancel };
+    pthread_t          thread;
+    pipeline_job       job   = {
+        .image               = image,
+        .filename_out        = filename_out,
+        .filename_checkpoint = filename_checkpoint,
+        .cancel              = &cancel,
+        .cmap                = cmap,
+        .nthreads            = nthreads,
+        .engine              = engine
+    };
+
+    cancel_init(&cancel, 0);
+    pthread_create(&thread, NULL, interrupt_checkpoint, &watch);
+
+    ppm_image *marched = pipeline_run(&job);
+
+    __atomic_store_n(&watch.finished, 1, __ATOMIC_RELEASE);
+    pthread_join(thread, NULL);
+
+    // A cancelled job must have kept its checkpoint
+    if (!marched && access(filename_checkpoint, F_OK)) {
+        image_free(image);
+        image_free(copy);
+        return NULL;
+    }
+    if (!marched) {
+        job.image  = copy;
+        job.cancel = NULL;
+        marched    = pipeline_run(&job);
+    }
+    if (marched && marched != job.image) {
+        image_free(marched);
+    }
+    image_free(image);
+    image_free(copy);
+    if (!marched) {
+        return NULL;
+    }
+
+    ppm_image *const result = read_ppm(filename_out);
+    unlink(filename_out);
+    return result;
+}
+
+// Writes the tiles of `image` into `dirname`, 2 x 3 cells each
+static int write_tiles(ppm_image *const image,
+                       const char *const dirname,
+                       ppm_image **const cmap,
+                       const long nthreads,
+                       const backend *const engine) {
+    ppm_image *const handle = pipeline_run(&(pipeline_job) {
+        .image        = image,
+        .filename_out = dirname,
+        .tile_size    = { 3 * STEP, 2 * STEP },
+        .cmap         = cmap,
+        .nthreads     = nthreads,
+        .engine       = engine
+    });
+
+    image_free(image);
+    free(handle);
+    return handle != NULL;
+}
+
+// Removes the tiles and manifest of `dirname`
+static void remove_tiles(const char *const dirname) {
+    char  filename[128], name[64];
+    long  x, y, w, h;
+    FILE *fp;
+
+    sprintf(filename, "%s/manifest.txt", dirname);
+    if ((fp = fopen(filename, "r"))) {
+        fscanf(fp, "size %ld %ld tiles %ld %ld", &x, &y, &w, &h);
+        while (fscanf(fp, "%63s %ld %ld %ld %ld", name, &x, &y, &w, &h) == 5) {
+            sprintf(filename, "%s/%s", dirname, name);
+            unlink(filename);
+        }
+        fclose(fp);
+    }
+    sprintf(filename, "%s/manifest.txt", dirname);
+    unlink(filename);
+    rmdir(dirname);
+}
+
+// The tiles are stitched back by their manifest, in the geometry of the
+// file, so that a tile cut across the cells shows
+static ppm_image *run_tiles(ppm_image *const image,
+                            ppm_image **const cmap,
+                            const long nthreads,
+                            const backend *const engine) {
+    char dirname[64], filename[128], name[64];
+
+    sprintf(dirname, "/tmp/difftest-%d-tiles", getpid());
+    if (!write_tiles(image, dirname, cmap, nthreads, engine)) {
+        return NULL;
+    }
+
+    sprintf(filename, "%s/manifest.txt", dirname);
+
+    FILE      *const fp = fopen(filename, "r");
+    int        width, height, cols, rows;
+    ppm_image *result = NULL;
+
+    if (fp && fscanf(fp, "size %d %d tiles %d %d", &width, &height, &cols, &rows) == 4) {
+        int x, y, w, h;
+
+        result = image_alloc(width, height);
+        for (long t = 0; t < (long) cols * rows
+                         && fscanf(fp, "%63s %d %d %d %d", name, &x, &y, &w, &h) == 5; ++t) {
+            sprintf(filename, "%s/%s", dirname, name);
+
+            ppm_image *const tile = read_ppm(filename);
+
+            for (int r = 0; r < h && tile->x == w && tile->y == h; ++r) {
+                memcpy(&result->data[(long) (y + r) * width + x], &tile->data[(long) r * w],
+                       w * sizeof(ppm_pixel));
+            }
+            image_free(tile);
+        }
+    }
+    if (fp) {
+        fclose(fp);
+    }
+    remove_tiles(dirname);
+    return result;
+}
+
+// The tiles read back as a mosaic, which marches the contours once more
+static ppm_image *run_tiles_mosaic(ppm_image *const image,
+                                   ppm_image **const cmap,
+                                   const long nthreads,
+                                   const backend *const engine) {
+    char dirname[64], filename[128];
+
+    sprintf(dirname, "/tmp/difftest-%d-tiles", getpid());
+    if (!write_tiles(image, dirname, cmap, nthreads, engine)) {
+        return NULL;
+    }
+
+    sprintf(filename, "%s/manifest.txt", dirname);
+
+    ppm_image *const result = pipeline_run(&(pipeline_job) {
+        .filename_in = filename,
+        .mosaic      = 1,
+        .cmap        = cmap,
+        .nthreads    = nthreads,
+        .engine      = engine
+    });
+
+    remove_tiles(dirname);
+    return result;
+}
+
+static ppm_image *run_mmap(ppm_image *const image,
+                           ppm_image **const cmap,
+                           const long nthreads,
+                           const backend *const engine) {
+    return run_to_file(image, (pipeline_job) {
+        .mmap_out = 1,
+        .cmap     = cmap,
+        .nthreads = nthreads,
+        .engine   = engine
+    });
+}
+
+static ppm_image *run_rle(ppm_image *const image,
+                          ppm_image **const cmap,
+                          const long nthreads,
+                          const backend *const engine) {
+    return run_in_memory(image, (pipeline_job) {
+        .rle_grid = 1,
+        .cmap     = cmap,
+        .nthreads = nthreads,
+        .engine   = engine
+    });
+}
+
+// A budget no run comes close to, polled all along
+static ppm_image *run_deadline(ppm_image *const image,
+                               ppm_image **const cmap,
+                               const long nthreads,
+                               const backend *const engine) {
+    cancel_token cancel;
+
+    cancel_init(&cancel, 600000);
+    return run_in_memory(image, (pipeline_job) {
+        .cancel   = &cancel,
+        .partial  = 1,
+        .cmap     = cmap,
+        .nthreads = nthreads,
+        .engine   = engine
+    });
+}
+
+// The same, through the blocked rescale and march
+static ppm_image *run_deadline_blocked(ppm_image *const image,
+                                       ppm_image **const cmap,
+                                       const long nthreads,
+                                       const backend *const engine) {
+    cancel_token cancel;
+
+    cancel_init(&cancel, 600000);
+    return run_in_memory(image, (pipeline_job) {
+        .blocked  = 1,
+        .cancel   = &cancel,
+        .partial  = 1,
+        .cmap     = cmap,
+        .nthreads = nthreads,
+        .engine   = engine
+    });
+}
+
+static ppm_image *run_in_place(ppm_image *const image,
+                               ppm_image **const cmap,
+                               const long nthreads,
+                               const backend *const engine) {
+    return run_in_memory(image, (pipeline_job) {
+        .in_place = 1,
+        .cmap     = cmap,
+        .nthreads = nthreads,
+        .engine   = engine
+    });
+}
+
+static ppm_image *run_blocked(ppm_image *const image,
+                              ppm_image **const cmap,
+                              const long nthreads,
+                              const backend *const engine) {
+    return run_in_memory(image, (pipeline_job) {
+        .blocked  = 1,
+        .cmap     = cmap,
+        .nthreads = nthreads,
+        .engine   = engine
+    });
+}
+
+static ppm_image *run_blocked_mmap(ppm_image *const image,
+                                   ppm_image **const cmap,
+                                   const long nthreads,
+                                   const backend *const engine) {
+    return run_to_file(image, (pipeline_job) {
+        .blocked  = 1,
+        .mmap_out = 1,
+        .cmap     = cmap,
+        .nthreads = nthreads,
+        .engine   = engine
+    });
+}
+
+static ppm_image *run_overlay(ppm_image *const image,
+                              ppm_image **const cmap,
+                              const long nthreads,
+                              const backend *const engine) {
+    return run_in_memory(image, (pipeline_job) {
+        .overlay  = OVERLAY_ALPHA,
+        .cmap     = cmap,
+        .nthreads = nthreads,
+        .engine   = engine
+    });
+}
+
+static ppm_image *run_smooth(ppm_image *const image,
+                             ppm_image **const cmap,
+                             const long nthreads,
+                             const backend *const engine) {
+    return run_in_memory(image, (pipeline_job) {
+        .smooth   = 1,
+        .cmap     = cmap,
+        .nthreads = nthreads,
+        .engine   = engine
+    });
+}
+
+static ppm_image *run_adaptive(ppm_image *const image,
+                               ppm_image **const cmap,
+                               const long nthreads,
+                               const backend *const engine) {
+    return run_in_memory(image, (pipeline_job) {
+        .adaptive_window = ADAPTIVE_WINDOW,
+        .adaptive_offset = ADAPTIVE_OFFSET,
+        .cmap            = cmap,
+        .nthreads        = nthreads,
+        .engine          = engine
+    });
+}
+
+// The image is split into a grid of uneven tiles, which the worker reads
+// back through their manifest
+static ppm_image *run_mosaic(ppm_image *const image,
+                             ppm_image **const cmap,
+                             const long nthreads,
+                             const backend *const engine) {
+    const int tile_x = image->x / 3 + 1;
+    const int tile_y = image->y / 2 + 1;
+    char      dirname[64], filename[128];
+
+    sprintf(dirname, "/tmp/difftest-%d-mosaic", getpid());
+    mkdir(dirname, 0755);
+    sprintf(filename, "%s/manifest.txt", dirname);
+
+    FILE *const fp = fopen(filename, "w");
+    fprintf(fp, "size %d %d\ntiles %d %d\n", image->x, image->y,
+            (image->x + tile_x - 1) / tile_x, (image->y + tile_y - 1) / tile_y);
+
+    for (int y = 0; y < image->y; y += tile_y) {
+        for (int x = 0; x < image->x; x += tile_x) {
+            ppm_image *const tile = image_alloc(MIN(tile_x, image->x - x), MIN(tile_y, image->y - y));
+
+            for (int r = 0; r < tile->y; ++r) {
+                memcpy(&tile->data[r * tile->x], &image->data[(y + r) * image->x + x],
+                       tile->x * sizeof(ppm_pixel));
+            }
+            sprintf(filename, "%s/%d_%d.ppm", dirname, y, x);
+            write_ppm(tile, filename);
+            fprintf(fp, "%d_%d.ppm %d %d %d %d\n", y, x, x, y, tile->x, tile->y);
+            image_free(tile);
+        }
+    }
+    fclose(fp);
+
+    sprintf(filename, "%s/manifest.txt", dirname);
+    ppm_image *const result = pipeline_run(&(pipeline_job) {
+        .filename_in = filename,
+        .mosaic      = 1,
+        .cmap        = cmap,
+        .nthreads    = nthreads,
+        .engine      = engine
+    });
+
+    unlink(filename);
+    for (int y = 0; y < image->y; y += tile_y) {
+        for (int x = 0; x < image->x; x += tile_x) {
+            sprintf(filename, "%s/%d_%d.ppm", dirname, y, x);
+            unlink(filename);
+        }
+    }
+    rmdir(dirname);
+    image_free(image);
+    return result;
+}
+
+// No data in a disc, in a band along the last columns and in scattered
+// pixels, so that both whole regions and lone grid points are masked
+static unsigned char *gen_mask(const int x, const int y) {
+    unsigned char *const mask = malloc((size_t) x * y);
+
+    for (long i = 0; i < (long) x * y; ++i) {
+        const float d = hypotf(i % x - x / 3.0f, i / x - y / 3.0f);
+
+        mask[i] = d > MIN(x, y) / 4.0f && i % x < x - x / 5 && i % 97;
+    }
+    return mask;
+}
+
+static ppm_image *run_masked(ppm_image *const image,
+                             ppm_image **const cmap,
+                             const long nthreads,
+                             const backend *const engine) {
+    unsigned char *const mask   = gen_mask(image->x, image->y);
+    ppm_image     *const result = run_in_memory(image, (pipeline_job) {
+        .mask     = mask,
+        .nodata   = NODATA_FILL,
+        .cmap     = cmap,
+        .nthreads = nthreads,
+        .engine   = engine
+    });
+
+    free(mask);
+    return result;
+}
+
+static ppm_image *run_masked_mmap(ppm_image *const image,
+                                  ppm_image **const cmap,
+                                  const long nthreads,
+                                  const backend *const engine) {
+    unsigned char *const mask   = gen_mask(image->x, image->y);
+    ppm_image     *const result = run_to_file(image, (pipeline_job) {
+        .mmap_out = 1,
+        .mask     = mask,
+        .nodata   = NODATA_FILL,
+        .cmap     = cmap,
+        .nthreads = nthreads,
+        .engine   = engine
+    });
+
+    free(mask);
+    return result;
+}
+
+// Float field of the mean of the channels, off the integers so that the
+// threshold falls between values, with a NaN cell in the middle
+static float_image *gen_field(const ppm_image *const image) {
+    float_image *const field = malloc(sizeof(float_image));
+
+    field->x    = image->x;
+    field->y    = image->y;
+    field->data = malloc((size_t) image->x * image->y * sizeof(float));
+    for (long i = 0; i < (long) image->x * image->y; ++i) {
+        const ppm_pixel pix = image->data[i];
+
+        field->data[i] = (pix.red + pix.green + pix.blue) / 3.0f - 0.2f;
+    }
+    field->data[(long) image->x * image->y / 2] = NAN;
+    return field;
+}
+
+// The same, with FLOAT_NODATA where `mask` has no data
+static float_image *gen_field_masked(const ppm_image *const image, const unsigned char *const mask) {
+    float_image *const field = gen_field(image);
+
+    for (long i = 0; i < (long) image->x * image->y; ++i) {
+        field->data[i] = mask[i] ? field->data[i] : FLOAT_NODATA;
+    }
+    return field;
+}
+
+static void field_free(float_image *const field) {
+    free(field->data);
+    free(field);
+}
+
+static ppm_image *run_float(ppm_image *const image,
+                            ppm_image **const cmap,
+                            const long nthreads,
+                            const backend *const engine) {
+    float_image *const field  = gen_field(image);
+    ppm_image   *const result = pipeline_run(&(pipeline_job) {
+        .field     = field,
+        .threshold = FLOAT_THRESHOLD,
+        .cmap      = cmap,
+        .nthreads  = nthreads,
+        .engine    = engine
+    });
+
+    field_free(field);
+    image_free(image);
+    return result;
+}
+
+static ppm_image *run_float_masked(ppm_image *const image,
+                                   ppm_image **const cmap,
+                                   const long nthreads,
+                                   const backend *const engine) {
+    unsigned char *const mask   = gen_mask(image->x, image->y);
+    float_image   *const field  = gen_field_masked(image, mask);
+    ppm_image     *const result = pipeline_run(&(pipeline_job) {
+        .field     = field,
+        .threshold = FLOAT_THRESHOLD,
+        .mask      = mask,
+        .nodata    = NODATA_FILL,
+        .cmap      = cmap,
+        .nthreads  = nthreads,
+        .engine    = engine
+    });
+
+    free(mask);
+    field_free(field);
+    image_free(image);
+    return result;
+}
+
+// With a budget no run comes close to, as for "deadline"
+static ppm_image *run_deadline_float(ppm_image *const image,
+                                     ppm_image **const cmap,
+                                     const long nthreads,
+                                     const backend *const engine) {
+    float_image *const field = gen_field(image);
+    cancel_token       cancel;
+
+    cancel_init(&cancel, 600000);
+
+    ppm_image *const result = pipeline_run(&(pipeline_job) {
+        .field     = field,
+        .threshold = FLOAT_THRESHOLD,
+        .cancel    = &cancel,
+        .partial   = 1,
+        .cmap      = cmap,
+        .nthreads  = nthreads,
+        .engine    = engine
+    });
+
+    field_free(field);
+    image_free(image);
+    return result;
+}
+
+// Through a big endian PFM, bottom row first, marched into a mapped output
+static ppm_image *run_float_file(ppm_image *const image,
+                                 ppm_image **const cmap,
+                                 const long nthreads,
+                                 const backend *const engine) {
+    char filename_in[64], filename_out[64];
+
+    sprintf(filename_in,  "/tmp/difftest-%d.pfm", getpid());
+    sprintf(filename_out, "/tmp/difftest-%d.ppm", getpid());
+
+    float_image *const field = gen_field(image);
+    FILE        *const fp    = fopen(filename_in, "wb");
+
+    fprintf(fp, "Pf\n%d %d\n1.0\n", field->x, field->y);
+    for (long r = field->y - 1; r >= 0; --r) {
+        for (long c = 0; c < field->x; ++c) {
+            uint32_t bits;
+
+            memcpy(&bits, &field->data[r * field->x + c], sizeof(bits));
+            bits = __builtin_bswap32(bits);
+            fwrite(&bits, sizeof(bits), 1, fp);
+        }
+    }
+    fclose(fp);
+    field_free(field);
+    image_free(image);
+
+    ppm_image *const result = pipeline_run(&(pipeline_job) {
+        .filename_in  = filename_in,
+        .filename_out = filename_out,
+        .mmap_out     = 1,
+        .threshold    = FLOAT_THRESHOLD,
+        .cmap         = cmap,
+        .nthreads     = nthreads,
+        .engine       = engine
+    });
+
+    unlink(filename_in);
+    if (!result) {
+        return NULL;
+    }
+
+    ppm_image *const marched = read_ppm(filename_out);
+    unlink(filename_out);
+    return marched;
+}
+
+// Through a text raster of `field`, parsed on the job's threads: an ESRI
+// ASCII grid, whose NODATA_value cells are masked, or a CSV matrix with a
+// header and CRLF line ends
+static ppm_image *run_text_file(float_image *const field,
+                                const int esri,
+                                ppm_image **const cmap,
+                                const long nthreads,
+                                const backend *const engine) {
+    char filename_in[64];
+
+    sprintf(filename_in, "/tmp/difftest-%d.%s", getpid(), esri ? "asc" : "csv");
+
+    FILE *const fp = fopen(filename_in, "w");
+
+    if (esri) {
+        fprintf(fp, "ncols %d\nnrows %d\nxllcorner 0\nyllcorner 0\ncellsize 1\n"
+                    "NODATA_value %.9g\n", field->x, field->y, FLOAT_NODATA);
+    } else {
+        for (long c = 0; c < field->x; ++c) {
+            fprintf(fp, "%sv%ld", c ? "," : "", c);
+        }
+        fprintf(fp, "\r\n");
+    }
+    for (long r = 0; r < field->y; ++r) {
+        for (long c = 0; c < field->x; ++c) {
+            fprintf(fp, "%s%.9g", c ? (esri ? " " : ",") : "", field->data[r * field->x + c]);
+        }
+        fprintf(fp, esri ? "\n" : "\r\n");
+    }
+    fclose(fp);
+    field_free(field);
+
+    ppm_image *const result = pipeline_run(&(pipeline_job) {
+        .filename_in = filename_in,
+        .threshold   = FLOAT_THRESHOLD,
+        .nodata      = NODATA_FILL,
+        .cmap        = cmap,
+        .nthreads    = nthreads,
+        .engine      = engine
+    });
+
+    unlink(filename_in);
+    return result;
+}
+
+// An ESRI grid for odd thread counts, a CSV matrix for even ones, with no
+// cell holding the NODATA_value
+static ppm_image *run_float_text(ppm_image *const image,
+                                 ppm_image **const cmap,
+                                 const long nthreads,
+                                 const backend *const engine) {
+    float_image *const field = gen_field(image);
+
+    image_free(image);
+    return run_text_file(field, nthreads % 2, cmap, nthreads, engine);
+}
+
+// An ESRI grid with NODATA_value cells where gen_mask() has no data
+static ppm_image *run_float_text_nodata(ppm_image *const image,
+                                        ppm_image **const cmap,
+                                        const long nthreads,
+                                        const backend *const engine) {
+    unsigned char *const mask  = gen_mask(image->x, image->y);
+    float_image   *const field = gen_field_masked(image, mask);
+
+    free(mask);
+    image_free(image);
+    return run_text_file(field, 1, cmap, nthreads, engine);
+}
+
+// The image under test shares its chunk with inverted copies of itself, so
+// that results leaking between lanes show up
+static ppm_image *run_batch(ppm_image *image,
+                            ppm_image **const cmap,
+                            const long nthreads,
+                            const backend *const engine) {
+    (void) nthreads;
+    (void) engine;
+
+    if (image->x > RESCALE_X || image->y > RESCALE_Y) {
+        ppm_image *const scaled = image_alloc(RESCALE_X, RESCALE_Y);
+
+        rescale_image(image, scaled, NULL, 0, 1);
+        image_free(image);
+        image = scaled;
+    }
+
+    ppm_image *images[16];
+    const long n = sizeof(images) / sizeof(images[0]);
+
+    for (long l = 0; l < n - 1; ++l) {
+        images[l] = image_copy(image);
+        for (long i = 0; i < (long) image->x * image->y; ++i) {
+            images[l]->data[i].red   ^= 0xff;
+            images[l]->data[i].green ^= 0xff;
+            images[l]->data[i].blue  ^= 0xff;
+        }
+    }
+    images[n - 1] = image;
+
+    batch_march(images, n, cmap);
+
+    for (long l = 0; l < n - 1; ++l) {
+        image_free(images[l]);
+    }
+    return image;
+}
+
+// Entry `l` of the input archive: the same base name in every directory,
+// the first one too deep for the name field of a tar header
+static char *batch_archive_name(char *const name, const long l) {
+    name[0] = '\0';
+    for (long d = 0; !l && d < 16; ++d) {
+        strcat(name, "nested/");
+    }
+    sprintf(name + strlen(name), "%ld/image.ppm", l);
+    return name;
+}
+
+// The image goes through an archive on both sides, along with inverted
+// copies and an odd-sized image, all marched by batch_run()
+static ppm_image *run_batch_archive(ppm_image *const image,
+                                    ppm_image **const cmap,
+                                    const long nthreads,
+                                    const backend *const engine) {
+    ppm_image *images[5] = { image, image_copy(image), image_copy(image), image_copy(image),
+                             image_alloc(13, 7) };
+    const long n = sizeof(images) / sizeof(images[0]);
+    char       filename_in[64], filename_out[64], name[160];
+    size_t     size = 0;
+
+    for (long i = 0; i < 13 * 7; ++i) {
+        images[4]->data[i] = (ppm_pixel) { rand() & 0xff, rand() & 0xff, rand() & 0xff };
+    }
+
+    for (long l = 1; l < 4; ++l) {
+        for (long i = 0; i < (long) image->x * image->y; ++i) {
+            images[l]->data[i].red   ^= 0xff;
+            images[l]->data[i].green ^= 0xff;
+            images[l]->data[i].blue  ^= 0xff;
+        }
+    }
+    for (long l = 0; l < n; ++l) {
+        size += archive_entry_size(batch_archive_name(name, l), ppm_size(images[l]));
+    }
+
+    sprintf(filename_in,  "/tmp/difftest-%d-in.tar",  getpid());
+    sprintf(filename_out, "/tmp/difftest-%d-out.tar", getpid());
+
+    archive_writer *const writer = archive_create(filename_in, size);
+    size = 0;
+    for (long l = 0; l < n; ++l) {
+        batch_archive_name(name, l);
+        ppm_store(images[l], archive_add(writer, size, name, ppm_size(images[l])));
+        size += archive_entry_size(name, ppm_size(images[l]));
+        image_free(images[l]);
+    }
+    archive_close(writer);
+
+    if (batch_run(filename_in, filename_out, nthreads, engine, cmap)) {
+        return NULL;
+    }
+
+    archive   *const ar     = archive_read(filename_out);
+    ppm_image       *result = NULL;
+
+    for (long i = 0; i < ar->nentries; ++i) {
+        if (!strcmp(ar->entries[i].name, batch_archive_name(name, 0))) {
+            int x, y;
+            const ppm_pixel *const data = ppm_parse(ar->entries[i].data, ar->entries[i].size, &x, &y);
+
+            result = image_alloc(x, y);
+            memcpy(result->data, data, (size_t) x * y * sizeof(ppm_pixel));
+        }
+    }
+
+    archive_free(ar);
+    unlink(filename_in);
+    unlink(filename_out);
+    return result;
+}
+
+typedef struct {
+    char           socket_path[64];
+    ppm_image    **cmap;
+    long           nthreads;
+    const backend *engine;
+} server_args;
+
+static void *serve(void *arg) {
+    const server_args *const args = arg;
+
+    server_run(args->socket_path, NULL, 1, args->nthreads, args->engine, args->cmap);
+    return NULL;
+}
+
+// A server of its own takes the image as a job, among two other jobs that
+// must not be mixed up with it
+static ppm_image *run_server(ppm_image *const image,
+                             ppm_image **const cmap,
+                             const long nthreads,
+                             const backend *const engine) {
+    server_args    args = { .cmap = cmap, .nthreads = nthreads, .engine = engine };
+    server_client *client;
+    pthread_t      thread;
+
+    sprintf(args.socket_path, "/tmp/difftest-%d.sock", getpid());
+    unlink(args.socket_path);
+    pthread_create(&thread, NULL, serve, &args);
+    while (!(client = server_connect(args.socket_path))) {
+        usleep(1000);
+    }
+
+    ppm_image *const other = image_alloc(13, 7);
+
+    for (long i = 0; i < 13 * 7; ++i) {
+        other->data[i] = (ppm_pixel) { rand() & 0xff, rand() & 0xff, rand() & 0xff };
+    }
+
+    ppm_image *const before = server_request(client, 0, 0, other, NULL, NULL, NULL);
+    ppm_image *const result = server_request(client, 1, 600000, image, NULL, NULL, NULL);
+    ppm_image *const after  = server_request(client, 0, 0, other, NULL, NULL, NULL);
+
+    if (server_quit(client)) {
+        printf("server: didn't quit\n");
+    }
+    server_disconnect(client);
+    pthread_join(thread, NULL);
+
+    image_free(other);
+    image_free(image);
+    if (!before || !after) {
+        return NULL;
+    }
+    image_free(before);
+    image_free(after);
+    return result;
+}
+
+#define SERVER_CLIENTS 4
+
+typedef struct {
+    const char      *socket_path;
+    const ppm_image *image;
+    ppm_image       *result;
+} server_client_args;
+
+static void *request(void *arg) {
+    server_client_args *const args   = arg;
+    server_client *const      client = server_connect(args->socket_path);
+
+    if (client) {
+        args->result = server_request(client, 0, 0, args->image, NULL, NULL, NULL);
+        server_disconnect(client);
+    }
+    return NULL;
+}
+
+// Clients sending the image at once, whose jobs the server may coalesce.
+// Every one must get the whole result.
+static ppm_image *run_server_coalesced(ppm_image *const image,
+                                       ppm_image **const cmap,
+                                       const long nthreads,
+                                       const backend *const engine) {
+    server_args        args = { .cmap = cmap, .nthreads = nthreads, .engine = engine };
+    server_client_args clients[SERVER_CLIENTS];
+    server_client     *client;
+    pthread_t          thread, threads[SERVER_CLIENTS];
+    ppm_image         *result = NULL;
+    int                same   = 1;
+
+    sprintf(args.socket_path, "/tmp/difftest-%d.sock", getpid());
+    unlink(args.socket_path);
+    pthread_create(&thread, NULL, serve, &args);
+    while (!(client = server_connect(args.socket_path))) {
+        usleep(1000);
+    }
+
+    for (long c = 0; c < SERVER_CLIENTS; ++c) {
+        clients[c] = (server_client_args) { .socket_path = args.socket_path, .image = image };
+        pthread_create(&threads[c], NULL, request, &clients[c]);
+    }
+    for (long c = 0; c < SERVER_CLIENTS; ++c) {
+        pthread_join(threads[c], NULL);
+    }
+
+    if (server_quit(client)) {
+        printf("server: didn't quit\n");
+    }
+    server_disconnect(client);
+    pthread_join(thread, NULL);
+
+    for (long c = 0; c < SERVER_CLIENTS; ++c) {
+        const ppm_image *const other = clients[c].result;
+
+        same = same && other && other->x == clients[0].result->x && other->y == clients[0].result->y
+            && !memcmp(other->data, clients[0].result->data,
+                       (size_t) other->x * other->y * sizeof(ppm_pixel));
+    }
+    for (long c = 0; c < SERVER_CLIENTS; ++c) {
+        if (same && !result) {
+            result = clients[c].result;
+        } else if (clients[c].result) {
+            image_free(clients[c].result);
+        }
+    }
+    image_free(image);
+    return result;
+}
+
+// The image as the middle frame of a stream, between frames that must not
+// be mixed up with it and that must come out the same
+static ppm_image *run_stream(ppm_image *const image,
+                             ppm_image **const cmap,
+                             const long nthreads,
+                             const backend *const engine) {
+    char       filename_in[64], filename_out[64];
+    ppm_image *frames[3];
+    FILE      *fp;
+
+    sprintf(filename_in,  "/tmp/difftest-%d-in.ppm",  getpid());
+    sprintf(filename_out, "/tmp/difftest-%d-out.ppm", getpid());
+
+    ppm_image *const other = image_alloc(13, 7);
+
+    for (long i = 0; i < 13 * 7; ++i) {
+        other->data[i] = (ppm_pixel) { rand() & 0xff, rand() & 0xff, rand() & 0xff };
+    }
+
+    fp = fopen(filename_in, "wb");
+    stream_write_ppm(fp, other);
+    stream_write_ppm(fp, image);
+    stream_write_ppm(fp, other);
+    fclose(fp);
+    image_free(other);
+    image_free(image);
+
+    const int rc = stream_run(filename_in, filename_out, &(pipeline_job) {
+        .cmap     = cmap,
+        .nthreads = nthreads,
+        .engine   = engine
+    });
+
+    fp = fopen(filename_out, "rb");
+    for (long f = 0; f < 3; ++f) {
+        frames[f] = fp ? stream_read_ppm(fp) : NULL;
+    }
+    if (fp) {
+        fclose(fp);
+    }
+    unlink(filename_in);
+    unlink(filename_out);
+
+    const int same = frames[0] && frames[2] && frames[0]->x == 13 && frames[2]->x == 13
+                  && !memcmp(frames[0]->data, frames[2]->data, 13 * 7 * sizeof(ppm_pixel));
+
+    for (long f = 0; f < 3; f += 2) {
+        if (frames[f]) {
+            image_free(frames[f]);
+        }
+    }
+    if (rc || !same) {
+        if (frames[1]) {
+            image_free(frames[1]);
+        }
+        return NULL;
+    }
+    return frames[1];
+}
+
+// Sampled far more often than --profile does, so that the signals land in
+// every phase and interrupt the barriers and the writes
+static ppm_image *run_profiled(ppm_image *const image,
+                               ppm_image **const cmap,
+                               const long nthreads,
+                               const backend *const engine) {
+    char filename[64];
+
+    sprintf(filename, "/tmp/difftest-%d.folded", getpid());
+    profiler_start(filename, 20 * PROFILER_HZ);
+
+    ppm_image *const result = run_to_file(image, (pipeline_job) {
+        .cmap     = cmap,
+        .nthreads = nthreads,
+        .engine   = engine
+    });
+
+    profiler_stop();
+    unlink(filename);
+    return result;
+}
+
+static const variant variants[] = {
+    { .name = "worker",      .tolerance = 0, .threaded = 1, .run = run_worker        },
+    { .name = "checkpoint",  .tolerance = 0, .threaded = 1, .run = run_checkpoint    },
+    { .name = "checkpoint-resumed", .tolerance = 0, .threaded = 1, .run = run_checkpoint_resumed },
+    { .name = "tiles",       .tolerance = 0, .threaded = 1, .run = run_tiles         },
+    { .name = "tiles-mosaic", .tolerance = 0, .threaded = 1, .run = run_tiles_mosaic,
+      .reference = REFERENCE_REMARCHED },
+    { .name = "mmap",        .tolerance = 0, .threaded = 1, .run = run_mmap          },
+    { .name = "rle",         .tolerance = 0, .threaded = 1, .run = run_rle           },
+    { .name = "deadline",    .tolerance = 0, .threaded = 1, .run = run_deadline      },
+    { .name = "deadline-blocked", .tolerance = 0, .threaded = 1, .run = run_deadline_blocked },
+    { .name = "in-place",    .tolerance = 0, .threaded = 1, .run = run_in_place      },
+    { .name = "blocked",     .tolerance = 0, .threaded = 1, .run = run_blocked       },
+    { .name = "blocked-mmap", .tolerance = 0, .threaded = 1, .run = run_blocked_mmap },
+    { .name = "overlay",     .tolerance = 0, .threaded = 1, .run = run_overlay,
+      .reference = REFERENCE_OVERLAY },
+    { .name = "smooth",      .tolerance = 0, .threaded = 1, .run = run_smooth,
+      .reference = REFERENCE_SMOOTH },
+    { .name = "masked",      .tolerance = 0, .threaded = 1, .run = run_masked,
+      .reference = REFERENCE_MASKED },
+    { .name = "masked-mmap", .tolerance = 0, .threaded = 1, .run = run_masked_mmap,
+      .reference = REFERENCE_MASKED },
+    { .name = "adaptive",    .tolerance = 0, .threaded = 1, .run = run_adaptive,
+      .reference = REFERENCE_ADAPTIVE },
+    { .name = "float",       .tolerance = 0, .threaded = 1, .run = run_float,
+      .reference = REFERENCE_FLOAT },
+    { .name = "deadline-float", .tolerance = 0, .threaded = 1, .run = run_deadline_float,
+      .reference = REFERENCE_FLOAT },
+    { .name = "float-file",  .tolerance = 0, .threaded = 1, .run = run_float_file,
+      .reference = REFERENCE_FLOAT },
+    { .name = "float-text",  .tolerance = 0, .threaded = 1, .run = run_float_text,
+      .reference = REFERENCE_FLOAT },
+    { .name = "float-masked", .tolerance = 0, .threaded = 1, .run = run_float_masked,
+      .reference = REFERENCE_FLOAT_MASKED },
+    { .name = "float-text-nodata", .tolerance = 0, .threaded = 1, .run = run_float_text_nodata,
+      .reference = REFERENCE_FLOAT_MASKED },
+    { .name = "mosaic",      .tolerance = 0, .threaded = 1, .run = run_mosaic        },
+    { .name = "batch",       .tolerance = 0, .threaded = 0, .run = run_batch         },
+    { .name = "batch-tar",   .tolerance = 0, .threaded = 1, .run = run_batch_archive },
+    { .name = "server",      .tolerance = 0, .threaded = 1, .run = run_server        },
+    { .name = "server-coalesced", .tolerance = 0, .threaded = 1, .run = run_server_coalesced },
+    { .name = "stream",      .tolerance = 0, .threaded = 1, .run = run_stream        },
+    { .name = "profiled",    .tolerance = 0, .threaded = 1, .run = run_profiled      },
+};
+
+static const char *const backend_names[] = { "pthread", "openmp", "serial" };
+
+static ppm_image *gen_noise(const int x, const int y) {
+    ppm_image *const image = image_alloc(x, y);
+
+    for (long i = 0; i < (long) x * y; ++i) {
+        image->data[i] = (ppm_pixel) { rand() & 0xff, rand() & 0xff, rand() & 0xff };
+    }
+    return image;
+}
+
+static ppm_image *gen_rings(const int x, const int y) {
+    ppm_image *const image = image_alloc(x, y);
+
+    for (long i = 0; i < (long) x * y; ++i) {
+        const float         d = hypotf(i % x - x / 2.0f, i / x - y / 2.0f);
+        const unsigned char v = 127.5f + 127.5f * sinf(d / 5.0f);
+
+        image->data[i] = (ppm_pixel) { v, v, v };
+    }
+    return image;
+}
+
+static ppm_image *gen_gradient(const int x, const int y) {
+    ppm_image *const image = image_alloc(x, y);
+
+    for (long i = 0; i < (long) x * y; ++i) {
+        const unsigned char v = 255 * (i % x + i / x) / (x + y);
+
+        image->data[i] = (ppm_pixel) { v, 255 - v, v / 2 };
+    }
+    return image;
+}
+
+static ppm_image *gen_uniform(const int x, const int y, const unsigned char v) {
+    ppm_image *const image = image_alloc(x, y);
+
+    memset(image->data, v, (size_t) x * y * sizeof(ppm_pixel));
+    return image;
+}
+
+static long gen_inputs(test_input *const inputs) {
+    static const int sizes[][2] = {
+        { 1, 1 }, { 8, 8 }, { 13, 29 }, { 64, 64 }, { 100, 60 }, { 60, 100 }, { 257, 257 }
+    };
+    long n = 0;
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        const int x = sizes[i][0], y = sizes[i][1];
+
+        sprintf(inputs[n].name, "noise %dx%d", x, y);
+        inputs[n++].image = gen_noise(x, y);
+        sprintf(inputs[n].name, "rings %dx%d", x, y);
+        inputs[n++].image = gen_rings(x, y);
+    }
+
+    sprintf(inputs[n].name, "gradient 300x200");
+    inputs[n++].image = gen_gradient(300, 200);
+    sprintf(inputs[n].name, "black 64x64");
+    inputs[n++].image = gen_uniform(64, 64, 0);
+    sprintf(inputs[n].name, "white 64x64");
+    inputs[n++].image = gen_uniform(64, 64, 255);
+
+    // Rescaled inputs
+    sprintf(inputs[n].name, "rings 2500x2100");
+    inputs[n++].image = gen_rings(2500, 2100);
+    sprintf(inputs[n].name, "noise 2049x100");
+    inputs[n++].image = gen_noise(2049, 100);
+
+    return n;
+}
+
+// Random tiles, different enough that any wrong configuration index shows.
+// Half of their pixels get the outside or inside colour, so that the overlay
+// has something to leave alone.
+static ppm_image **gen_cmap(void) {
+    ppm_image **const cmap = malloc(CONTOUR_CONFIG_COUNT * sizeof(ppm_image *));
+
+    for (long k = 0; k < CONTOUR_CONFIG_COUNT; ++k) {
+        cmap[k] = gen_noise(STEP, STEP);
+    }
+    for (long k = 0; k < CONTOUR_CONFIG_COUNT; ++k) {
+        for (long i = 1; i < STEP * STEP; ++i) {
+            if (rand() & 1) {
+                cmap[k]->data[i] = cmap[rand() & 1 ? 0 : CONTOUR_CONFIG_COUNT - 1]->data[0];
+            }
+        }
+    }
+    return cmap;
+}
+
+// Prints the first mismatching pixel and returns 1 if the images differ
+// Runs `image` with a PFM distance field, which it reads back along with the
+// grid it was computed from
+static float_image *run_sdf(ppm_image *const image,
+                            ppm_image **const cmap,
+                            const long nthreads,
+                            const backend *const engine,
+                            unsigned char **const grid) {
+    char filename_sdf[64];
+
+    sprintf(filename_sdf, "/tmp/difftest-%d-sdf.pfm", getpid());
+    *grid = NULL;
+
+    ppm_image *const result = pipeline_run(&(pipeline_job) {
+        .image        = image,
+        .filename_sdf = filename_sdf,
+        .grid_out     = grid,
+        .cmap         = cmap,
+        .nthreads     = nthreads,
+        .engine       = engine
+    });
+
+    if (!result) {
+        image_free(image);
+        return NULL;
+    }
+    if (result != image) {
+        image_free(image);
+    }
+    image_free(result);
+
+    float_image *const sdf = read_pfm(filename_sdf);
+    unlink(filename_sdf);
+    return sdf;
+}
+
+// Signed distance field of a rows x cols grid, the naive way: the distance
+// from every point to every point of the other kind, in output pixels and
+// negative inside. Without any point of the other kind, 1e10 grid steps.
+static float *sdf_brute_force(const unsigned char *const grid, const long rows, const long cols) {
+    float *const sdf = malloc(rows * cols * sizeof(float));
+
+    for (long i = 0; i < rows * cols; ++i) {
+        float d_in = 1e20f, d_out = 1e20f;
+
+        for (long k = 0; k < rows * cols; ++k) {
+            const long  di = i / cols - k / cols, dj = i % cols - k % cols;
+            const float d  = di * di + dj * dj;
+
+            if (grid[k] && d < d_in) {
+                d_in = d;
+            } else if (!grid[k] && d < d_out) {
+                d_out = d;
+            }
+        }
+        sdf[i] = (sqrtf(d_in) - sqrtf(d_out)) * STEP;
+    }
+    return sdf;
+}
+
+static int diff_sdf(const float *const expected,
+                    const long rows,
+                    const long cols,
+                    const float_image *const actual,
+                    const char *const what) {
+    if (actual->y != rows || actual->x != cols) {
+        printf("FAIL %s: distance field %dx%d, expected %ldx%ld\n",
+               what, actual->x, actual->y, cols, rows);
+        return 1;
+    }
+
+    for (long i = 0; i < rows * cols; ++i) {
+        if (fabsf(expected[i] - actual->data[i]) > 1e-5f * fmaxf(1.0f, fabsf(expected[i]))) {
+            printf("FAIL %s: first distance mismatch at row %ld column %ld, expected %g got %g\n",
+                   what, i / cols, i % cols, expected[i], actual->data[i]);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static int diff(const ppm_image *const expected,
+                const ppm_image *const actual,
+                const int tolerance,
+                const char *const what) {
+    if (expected->x != actual->x || expected->y != actual->y) {
+        printf("FAIL %s: size %dx%d, expected %dx%d\n",
+               what, actual->x, actual->y, expected->x, expected->y);
+        return 1;
+    }
+
+    for (long i = 0; i < (long) expected->x * expected->y; ++i) {
+        const ppm_pixel e = expected->data[i];
+        const ppm_pixel a = actual->data[i];
+
+        if (abs(e.red - a.red) > tolerance
+            || abs(e.green - a.green) > tolerance
+            || abs(e.blue - a.blue) > tolerance) {
+            printf("FAIL %s: first mismatch at row %ld column %ld, "
+                   "expected (%d, %d, %d) got (%d, %d, %d)\n",
+                   what, i / expected->y, i % expected->y,
+                   e.red, e.green, e.blue, a.red, a.green, a.blue);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    static const struct option long_options[] = {
+        { "seed", required_argument, NULL, 's' },
+        { "full", no_argument,       NULL, 'f' },
+        { NULL,   0,                 NULL, 0   }
+    };
+
+    unsigned seed = 1;
+    int      full = 0;
+    int      opt;
+
+    while ((opt = getopt_long(argc, argv, "", long_options, NULL)) != -1) {
+        switch (opt) {
+        case 's':
+            seed = atoi(optarg);
+            break;
+        case 'f':
+            full = 1;
+            break;
+        default:
+            fprintf(stderr, "Usage: %s [--seed N] [--full]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    // Keep the report up to date should a kernel crash
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    srand(seed);
+    kernels_init(NULL, 0, NULL, 0);
+
+    test_input         inputs[32];
+    const long         ninputs = gen_inputs(inputs);
+    ppm_image **const  cmap    = gen_cmap();
+    long               runs    = 0;
+    long               failed  = 0;
+
+    for (long i = 0; i < ninputs; ++i) {
+        unsigned char *const mask         = gen_mask(inputs[i].image->x, inputs[i].image->y);
+        float_image   *const field        = gen_field(inputs[i].image);
+        float_image   *const field_masked = gen_field_masked(inputs[i].image, mask);
+        ppm_image     *const marched      = pipeline_reference(inputs[i].image, &(pipeline_job) {
+            .cmap = cmap
+        });
+        ppm_image *const expected[NREFERENCES] = {
+            [REFERENCE_TILES]    = marched,
+            [REFERENCE_OVERLAY]  = pipeline_reference(inputs[i].image, &(pipeline_job) {
+                .cmap = cmap, .overlay = OVERLAY_ALPHA
+            }),
+            [REFERENCE_SMOOTH]   = pipeline_reference(inputs[i].image, &(pipeline_job) {
+                .cmap = cmap, .smooth = 1
+            }),
+            [REFERENCE_MASKED]   = pipeline_reference(inputs[i].image, &(pipeline_job) {
+                .cmap = cmap, .mask = mask, .nodata = NODATA_FILL
+            }),
+            [REFERENCE_ADAPTIVE] = pipeline_reference(inputs[i].image, &(pipeline_job) {
+                .cmap            = cmap,
+                .adaptive_window = ADAPTIVE_WINDOW,
+                .adaptive_offset = ADAPTIVE_OFFSET
+            }),
+            [REFERENCE_FLOAT]    = pipeline_reference(inputs[i].image, &(pipeline_job) {
+                .cmap = cmap, .field = field, .threshold = FLOAT_THRESHOLD
+            }),
+            [REFERENCE_FLOAT_MASKED] = pipeline_reference(inputs[i].image, &(pipeline_job) {
+                .cmap      = cmap,
+                .field     = field_masked,
+                .threshold = FLOAT_THRESHOLD,
+                .mask      = mask,
+                .nodata    = NODATA_FILL
+            }),
+            [REFERENCE_REMARCHED] = pipeline_reference(marched, &(pipeline_job) {
+                .cmap = cmap
+            })
+        };
+        const int        rescaled = inputs[i].image->x > RESCALE_X
+                                 || inputs[i].image->y > RESCALE_Y;
+
+        for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); ++v) {
+            for (size_t b = 0; b < sizeof(backend_names) / sizeof(backend_names[0]); ++b) {
+                const backend *const engine = backend_find(backend_names[b]);
+
+                if (!engine || (!variants[v].threaded && b)) {
+                    continue;
+                }
+
+                for (long t = 1; t <= MAX_THREADS; ++t) {
+                    // Rescaling is slow, only a spread of thread counts for those
+                    if (!variants[v].threaded ? t > 1
+                        : rescaled && !full && t != 1 && t != 2 && t != 3 && t != 7 && t != 64) {
+                        continue;
+                    }
+
+                    char what[128];
+                    snprintf(what, sizeof(what), "%s/%s/%ld threads on %s",
+                             variants[v].name, engine->name, t, inputs[i].name);
+
+                    ppm_image *const actual = variants[v].run(image_copy(inputs[i].image),
+                                                              cmap, t, engine);
+                    ++runs;
+                    if (!actual) {
+                        printf("FAIL %s: did not run\n", what);
+                        ++failed;
+                        continue;
+                    }
+
+                    failed += diff(expected[variants[v].reference], actual, variants[v].tolerance, what);
+                    image_free(actual);
+                }
+            }
+        }
+
+        // A job cancelled before it starts returns nothing, or with `partial`
+        // at most an image of the right size. One whose deadline passes
+        // somewhere in its phases, as the plain, blocked or float job, may
+        // also have finished in time.
+        for (size_t b = 0; b < sizeof(backend_names) / sizeof(backend_names[0]); ++b) {
+            static const char *const kinds[]         = { "", "-blocked", "-float" };
+            static const long        thread_counts[] = { 1, 3, MAX_THREADS };
+            const backend *const engine = backend_find(backend_names[b]);
+
+            for (size_t n = 0; engine && n < sizeof(thread_counts) / sizeof(thread_counts[0]); ++n) {
+                for (int kind = 0; kind < 3; ++kind) {
+                    for (int c = 0; c < 4; ++c) {
+                        const int          partial = c & 1;
+                        const int          expired = c >> 1;
+                        ppm_image   *const image   = image_copy(inputs[i].image);
+                        float_image *const field   = kind == 2 ? gen_field(image) : NULL;
+                        cancel_token       cancel;
+                        char               what[128];
+
+                        snprintf(what, sizeof(what), "%s%s%s/%s/%ld threads on %s",
+                                 expired ? "expired" : "cancelled", kinds[kind],
+                                 partial ? "-partial" : "", engine->name, thread_counts[n],
+                                 inputs[i].name);
+                        cancel_init(&cancel, expired ? 1 : 0);
+                        if (!expired) {
+                            cancel_request(&cancel);
+                        }
+
+                        ppm_image *const actual = pipeline_run(&(pipeline_job) {
+                            .image     = field ? NULL : image,
+                            .field     = field,
+                            .threshold = FLOAT_THRESHOLD,
+                            .blocked   = kind == 1,
+                            .cancel    = &cancel,
+                            .partial   = partial,
+                            .cmap      = cmap,
+                            .nthreads  = thread_counts[n],
+                            .engine    = engine
+                        });
+
+                        ++runs;
+                        if (actual && ((!partial && !expired) || actual->x != expected[REFERENCE_TILES]->x
+                                       || actual->y != expected[REFERENCE_TILES]->y)) {
+                            printf("FAIL %s: returned a %dx%d image\n", what, actual->x, actual->y);
+                            ++failed;
+                        }
+                        if (actual && actual != image) {
+                            image_free(actual);
+                        }
+                        if (field) {
+                            field_free(field);
+                        }
+                        image_free(image);
+                    }
+                }
+            }
+        }
+
+        // The distance field on every backend against a brute force one, over
+        // the grid of the first run, which every other run must agree with
+        {
+            static const long  thread_counts[] = { 1, 3, MAX_THREADS };
+            const long         rows = expected[REFERENCE_TILES]->x / STEP + 1;
+            const long         cols = expected[REFERENCE_TILES]->y / STEP + 1;
+            unsigned char     *grid_first = NULL;
+            float             *expected_sdf = NULL;
+
+            for (size_t b = 0; b < sizeof(backend_names) / sizeof(backend_names[0]); ++b) {
+                const backend *const engine = backend_find(backend_names[b]);
+
+                for (size_t n = 0; engine && n < sizeof(thread_counts) / sizeof(thread_counts[0]); ++n) {
+                    unsigned char *grid;
+                    char           what[128];
+
+                    snprintf(what, sizeof(what), "sdf/%s/%ld threads on %s",
+                             engine->name, thread_counts[n], inputs[i].name);
+
+                    float_image *const sdf = run_sdf(image_copy(inputs[i].image), cmap,
+                                                     thread_counts[n], engine, &grid);
+                    ++runs;
+                    if (!sdf || !grid) {
+                        printf("FAIL %s: did not run\n", what);
+                        ++failed;
+                        if (sdf) {
+                            field_free(sdf);
+                        }
+                        continue;
+                    }
+
+                    int grid_differs = 0;
+
+                    if (!grid_first) {
+                        grid_first   = grid;
+                        expected_sdf = sdf_brute_force(grid, rows, cols);
+                    } else {
+                        grid_differs = memcmp(grid, grid_first, rows * cols) != 0;
+                        if (grid_differs) {
+                            printf("FAIL %s: the grid differs from the first run's\n", what);
+                        }
+                        free(grid);
+                    }
+                    failed += grid_differs || diff_sdf(expected_sdf, rows, cols, sdf, what);
+                    field_free(sdf);
+                }
+            }
+            free(grid_first);
+            free(expected_sdf);
+        }
+
+        // Every variant of every kernel, bound one at a time in the worker
+        for (long k = 0; k < kernel_count(); ++k) {
+            const int is_float = !strcmp(kernel_name(k), "rescale_float");
+
+            for (long kv = 0; kv < kernel_variant_count(k); ++kv) {
+                static const long thread_counts[] = { 1, 3, MAX_THREADS };
+
+                if (!kernel_bind(k, kv)) {
+                    continue;
+                }
+
+                for (size_t n = 0; n < sizeof(thread_counts) / sizeof(thread_counts[0]); ++n) {
+                    char what[128];
+                    snprintf(what, sizeof(what), "%s/%s=%s/%ld threads on %s",
+                             is_float ? "float" : "worker", kernel_name(k), kernel_variant_name(k, kv),
+                             thread_counts[n], inputs[i].name);
+
+                    ppm_image *const actual = (is_float ? run_float : run_worker)(
+                        image_copy(inputs[i].image), cmap, thread_counts[n], backend_find(NULL));
+                    ++runs;
+                    if (!actual) {
+                        printf("FAIL %s: did not run\n", what);
+                        ++failed;
+                        continue;
+                    }
+
+                    failed += diff(expected[is_float ? REFERENCE_FLOAT : REFERENCE_TILES],
+                                   actual, 0, what);
+                    image_free(actual);
+                }
+            }
+            kernels_init(NULL, 0, NULL, 0);
+        }
+
+        for (long r = 0; r < NREFERENCES; ++r) {
+            image_free(expected[r]);
+        }
+        free(mask);
+        field_free(field);
+        field_free(field_masked);
+    }
+
+    printf("%ld/%ld runs match the reference (seed %u)\n", runs - failed, runs, seed);
+    return failed != 0;
+}
@@ -0,0 +1,45 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+// Writes smooth_table.h: for every configuration and every level of the 4
+// edge crossings, the inside and line pixels of the tile as bit masks.
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "smooth.h"
+
+int main(void) {
+    printf("/* Generated by gen_smooth, do not edit */\n\n"
+           "#ifndef SMOOTH_TABLE_H\n"
+           "#define SMOOTH_TABLE_H\n\n"
+           "#include <stdint.h>\n\n"
+           "// Bit r * STEP + c of each entry: pixel (r, c) is inside, is on the line\n"
+           "static const uint64_t smooth_table[%d][2] = {\n",
+           CONTOUR_CONFIG_COUNT * SMOOTH_VARIANTS);
+
+    for (int k = 0; k < CONTOUR_CONFIG_COUNT; ++k) {
+        for (int v = 0; v < SMOOTH_VARIANTS; ++v) {
+            const int levels[4] = {
+                v / (SMOOTH_LEVELS * SMOOTH_LEVELS * SMOOTH_LEVELS),
+                v / (SMOOTH_LEVELS * SMOOTH_LEVELS) % SMOOTH_LEVELS,
+                v / SMOOTH_LEVELS % SMOOTH_LEVELS,
+                v % SMOOTH_LEVELS
+            };
+            uint64_t inside = 0, line = 0;
+
+            for (int r = 0; r < STEP; ++r) {
+                for (int c = 0; c < STEP; ++c) {
+                    const int color = smooth_classify(k, levels, r, c);
+
+                    inside |= (uint64_t) (color == SMOOTH_INSIDE) << (r * STEP + c);
+                    line   |= (uint64_t) (color == SMOOTH_LINE)   << (r * STEP + c);
+                }
+            }
+
+            printf("    { 0x%016" PRIx64 ", 0x%016" PRIx64 " },\n", inside, line);
+        }
+    }
+
+    printf("};\n\n#endif\n");
+    return 0;
+}
@@ -0,0 +1,113 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "marching.h"
+#include "inplace.h"
+
+// Scratch buffers above this many blocks aren't worth the trouble, and
+// waves below this many would mean too many barriers
+#define INPLACE_MAX_BLOCKS (RESCALE_Y / 4)
+#define INPLACE_MIN_BLOCKS (RESCALE_Y / 64)
+
+// First source row the bicubic footprint of block `b` reads, as
+// sample_bicubic() computes it
+static long inplace_first_row(const ppm_image *const image, const long b) {
+    const float v    = (float) b / (RESCALE_Y - 1);
+    const float y    = (v * image->y) - 0.5;
+    const long  yint = (int) y;
+
+    return yint - 1 > 0 ? yint - 1 : 0;
+}
+
+int inplace_plan_create(const ppm_image *const image, inplace_plan *const plan) {
+    // The transpose at the end swaps in place, which needs a square output
+    if (RESCALE_X != RESCALE_Y || (long) image->x * image->y <= (long) RESCALE_X * RESCALE_Y) {
+        return 0;
+    }
+
+    for (long blocks = INPLACE_MIN_BLOCKS; blocks <= INPLACE_MAX_BLOCKS; ++blocks) {
+        int fits = 1;
+
+        // The waves written so far must end before the rows the next one reads
+        for (long b = blocks; b < RESCALE_Y && fits; b += blocks) {
+            fits = b * RESCALE_X <= inplace_first_row(image, b) * image->x;
+        }
+
+        if (fits) {
+            plan->blocks = blocks;
+            plan->nwaves = (RESCALE_Y + blocks - 1) / blocks;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+void inplace_rescale_wave(ppm_image          *const image,
+                          const inplace_plan *const plan,
+                          ppm_pixel          *const scratch,
+                          const long w,
+                          const long tid,
+                          const long nthreads) {
+    const long first = w * plan->blocks;
+    const long count = MIN(plan->blocks, RESCALE_Y - first);
+
+    const thread_slice slice = thread_get_slice(tid, nthreads, count * RESCALE_X);
+
+    for (long n = slice.start; n < slice.end; ++n) {
+        const long b = first + n / RESCALE_X;
+        const long a = n % RESCALE_X;
+
+        sample_bicubic(image,
+                      (float) a / (RESCALE_X - 1),
+                      (float) b / (RESCALE_Y - 1),
+                      (uint8_t *) &scratch[n]);
+    }
+}
+
+void inplace_flush_wave(ppm_image          *const image,
+                        const inplace_plan *const plan,
+                        const ppm_pixel    *const scratch,
+                        const long w,
+                        const long tid,
+                        const long nthreads) {
+    const long first = w * plan->blocks;
+    const long count = MIN(plan->blocks, RESCALE_Y - first);
+
+    const thread_slice slice = thread_get_slice(tid, nthreads, count * RESCALE_X);
+
+    memcpy(&image->data[first * RESCALE_X + slice.start], &scratch[slice.start],
+           (slice.end - slice.start) * sizeof(ppm_pixel));
+}
+
+void inplace_shrink(ppm_image *const image) {
+    image->x    = RESCALE_X;
+    image->y    = RESCALE_Y;
+    image->data = realloc(image->data, RESCALE_X * RESCALE_Y * sizeof(ppm_pixel));
+}
+
+static void inplace_transpose_row(ppm_image *const image, const long r) {
+    for (long c = 0; c < r; ++c) {
+        const ppm_pixel tmp = image->data[r * RESCALE_Y + c];
+
+        image->data[r * RESCALE_Y + c] = image->data[c * RESCALE_Y + r];
+        image->data[c * RESCALE_Y + r] = tmp;
+    }
+}
+
+void inplace_transpose(ppm_image *const image,
+                       const long tid,
+                       const long nthreads) {
+    // Every pair below the diagonal is swapped by the owner of its row. Rows
+    // r and N - 1 - r go together, so that the slices get as many swaps.
+    const thread_slice slice = thread_get_slice(tid, nthreads, (RESCALE_X + 1) / 2);
+
+    for (long r = slice.start; r < slice.end; ++r) {
+        inplace_transpose_row(image, r);
+        if (RESCALE_X - 1 - r != r) {
+            inplace_transpose_row(image, RESCALE_X - 1 - r);
+        }
+    }
+}
@@ -0,0 +1,47 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef INPLACE_H
+#define INPLACE_H
+
+#include "helpers.h"
+
+// Rescaling into the input buffer. The output is produced transposed, one
+// block of RESCALE_X pixels per output column, since those go down the
+// source rows in order. A wave of `blocks` blocks is computed into a scratch
+// buffer, then copied to the front of the input, over rows the following
+// waves no longer read.
+typedef struct {
+    long blocks;   // per wave
+    long nwaves;
+} inplace_plan;
+
+// Simulates the waves for `image`. Returns 0 if the output doesn't fit in
+// the input, or only with a scratch buffer too large to be worth it.
+int inplace_plan_create(const ppm_image *const image, inplace_plan *const plan);
+
+// Rescales the blocks of wave `w` into `scratch`
+void inplace_rescale_wave(ppm_image          *const image,
+                          const inplace_plan *const plan,
+                          ppm_pixel          *const scratch,
+                          const long w,
+                          const long tid,
+                          const long nthreads);
+
+// Copies wave `w` from `scratch` to its place at the front of the input
+void inplace_flush_wave(ppm_image          *const image,
+                        const inplace_plan *const plan,
+                        const ppm_pixel    *const scratch,
+                        const long w,
+                        const long tid,
+                        const long nthreads);
+
+// Once every wave is flushed: shrinks the buffer of `image` to the output
+// and gives it the rescaled size. Single threaded.
+void inplace_shrink(ppm_image *const image);
+
+// Transposes the shrunk output into the usual layout
+void inplace_transpose(ppm_image *const image,
+                       const long tid,
+                       const long nthreads);
+
+#endif
@@ -0,0 +1,706 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <emmintrin.h>
+#define KERNELS_X86
+#endif
+
+#include "marching.h"
+#include "kernels.h"
+
+#define KERNEL_BENCH_RUNS 3
+
+typedef float v4f  __attribute__((vector_size(16)));
+typedef float v8f  __attribute__((vector_size(32)));
+typedef float v16f __attribute__((vector_size(64)));
+
+typedef uint8_t  lanes_u8  __attribute__((vector_size(16)));
+typedef uint16_t lanes_u16 __attribute__((vector_size(32)));
+
+enum {
+    KERNEL_RESCALE,
+    KERNEL_RESCALE_FLOAT,
+    KERNEL_SAMPLE_GRID,
+    KERNEL_MARCH,
+    NKERNELS
+};
+
+typedef struct {
+    const char *name;
+    const char *cpu;   // feature the CPU needs, NULL if none
+    void      (*fn)(void);
+} kernel_variant;
+
+typedef struct {
+    const char           *name;
+    const kernel_variant *variants;   // in order of preference
+    long                  nvariants;
+    double              (*benchmark)(void);
+} kernel;
+
+/* Rescaling */
+
+static void rescale_scalar(ppm_image *const image,
+                           ppm_pixel *const out,
+                           const long start,
+                           const long end) {
+    uint8_t sample[3];
+
+    for (long i = start; i < end; ++i) {
+        sample_bicubic(image,
+                      (float)(i / RESCALE_Y) / (RESCALE_X - 1),
+                      (float)(i % RESCALE_Y) / (RESCALE_Y - 1),
+                      sample);
+
+        out[i - start] = *((ppm_pixel *) sample);
+    }
+}
+
+// Same arithmetic as sample_bicubic(), in the same order, with the three
+// channels of one or more pixels in the lanes of a vector. Every lane gets
+// exactly the scalar result.
+#define DEFINE_RESCALE_VECTOR(vec, npix, attributes)                                   \
+attributes static inline vec hermite_##vec(const vec A, const vec B, const vec C,     \
+                                           const vec D, const vec t) {                 \
+    const vec a = -A / 2.0f + (3.0f * B) / 2.0f - (3.0f * C) / 2.0f + D / 2.0f;        \
+    const vec b = A - (5.0f * B) / 2.0f + 2.0f * C - D / 2.0f;                         \
+    const vec c = -A / 2.0f + C / 2.0f;                                                \
+    const vec d = B;                                                                   \
+                                                                                       \
+    return a * t * t * t + b * t * t + c * t + d;                                      \
+}                                                                                      \
+                                                                                       \
+attributes static void rescale_##vec(ppm_image *const image,                           \
+                                     ppm_pixel *const out,                             \
+                                     const long start,                                 \
+                                     const long end) {                                 \
+    long i = start;                                                                    \
+                                                                                       \
+    for (; i + npix <= end; i += npix) {                                               \
+        vec p[4][4], tx, ty;                                                           \
+                                                                                       \
+        for (int l = 0; l < npix; ++l) {                                               \
+            const float u = (float)((i + l) / RESCALE_Y) / (RESCALE_X - 1);            \
+            const float v = (float)((i + l) % RESCALE_Y) / (RESCALE_Y - 1);            \
+            const float x = (u * image->x) - 0.5;                                      \
+            const float y = (v * image->y) - 0.5;                                      \
+            const int   xint = (int) x, yint = (int) y;                                \
+            const float xfract = x - floor(x), yfract = y - floor(y);                  \
+                                                                                       \
+            for (int n = 0; n < 4; ++n) {                                              \
+                for (int m = 0; m < 4; ++m) {                                          \
+                    int px = xint - 1 + m, py = yint - 1 + n;                          \
+                                                                                       \
+                    px = px < 0 ? 0 : px > image->x - 1 ? image->x - 1 : px;           \
+                    py = py < 0 ? 0 : py > image->y - 1 ? image->y - 1 : py;           \
+                                                                                       \
+                    const ppm_pixel pix = image->data[px + image->x * py];             \
+                    p[n][m][4 * l]     = pix.red;                                      \
+                    p[n][m][4 * l + 1] = pix.green;                                    \
+                    p[n][m][4 * l + 2] = pix.blue;                                     \
+                    p[n][m][4 * l + 3] = 0;                                            \
+                }                                                                      \
+            }                                                                          \
+            for (int c = 0; c < 4; ++c) {                                              \
+                tx[4 * l + c] = xfract;                                                \
+                ty[4 * l + c] = yfract;                                                \
+            }                                                                          \
+        }                                                                              \
+                                                                                       \
+        vec col[4];                                                                    \
+        for (int n = 0; n < 4; ++n) {                                                  \
+            col[n] = hermite_##vec(p[n][0], p[n][1], p[n][2], p[n][3], tx);            \
+        }                                                                              \
+        const vec value = hermite_##vec(col[0], col[1], col[2], col[3], ty);           \
+                                                                                       \
+        for (int l = 0; l < npix; ++l) {                                               \
+            uint8_t *const dst = (uint8_t *) &out[i + l - start];                      \
+                                                                                       \
+            for (int c = 0; c < 3; ++c) {                                              \
+                const float f = value[4 * l + c];                                      \
+                dst[c] = f < 0.0f ? 0 : f > 255.0f ? 255 : (uint8_t) f;                \
+            }                                                                          \
+        }                                                                              \
+    }                                                                                  \
+                                                                                       \
+    rescale_scalar(image, &out[i - start], i, end);                                    \
+}
+
+DEFINE_RESCALE_VECTOR(v4f, 1, )
+#ifdef KERNELS_X86
+DEFINE_RESCALE_VECTOR(v8f, 2, __attribute__((target("avx2"))))
+DEFINE_RESCALE_VECTOR(v16f, 4, __attribute__((target("avx512f"))))
+#endif
+
+static void rescale_float_scalar(const float_image *const image,
+                                 float             *const out,
+                                 const long start,
+                                 const long end) {
+    for (long i = start; i < end; ++i) {
+        out[i - start] = sample_bicubic_float(image,
+                                              (float)(i / RESCALE_Y) / (RESCALE_X - 1),
+                                              (float)(i % RESCALE_Y) / (RESCALE_Y - 1));
+    }
+}
+
+// Same arithmetic as sample_bicubic_float(), one value per lane. There's a
+// single channel, so every lane is a pixel of its own.
+#define DEFINE_RESCALE_FLOAT_VECTOR(vec, npix, attributes)                             \
+attributes static void rescale_float_##vec(const float_image *const image,             \
+                                           float             *const out,               \
+                                           const long start,                           \
+                                           const long end) {                           \
+    long i = start;                                                                    \
+                                                                                       \
+    for (; i + npix <= end; i += npix) {                                               \
+        vec p[4][4], tx, ty;                                                           \
+                                                                                       \
+        for (int l = 0; l < npix; ++l) {                                               \
+            const float u = (float)((i + l) / RESCALE_Y) / (RESCALE_X - 1);            \
+            const float v = (float)((i + l) % RESCALE_Y) / (RESCALE_Y - 1);            \
+            const float x = (u * image->x) - 0.5;                                      \
+            const float y = (v * image->y) - 0.5;                                      \
+            const int   xint = (int) x, yint = (int) y;                                \
+                                                                                       \
+            for (int n = 0; n < 4; ++n) {                                              \
+                int py = yint - 1 + n;                                                 \
+                                                                                       \
+                py = py < 0 ? 0 : py > image->y - 1 ? image->y - 1 : py;               \
+                for (int m = 0; m < 4; ++m) {                                          \
+                    int px = xint - 1 + m;                                             \
+                                                                                       \
+                    px = px < 0 ? 0 : px > image->x - 1 ? image->x - 1 : px;           \
+                    p[n][m][l] = image->data[px + image->x * py];                      \
+                }                                                                      \
+            }                                                                          \
+            tx[l] = x - floor(x);                                                      \
+            ty[l] = y - floor(y);                                                      \
+        }                                                                              \
+                                                                                       \
+        vec col[4];                                                                    \
+        for (int n = 0; n < 4; ++n) {                                                  \
+            col[n] = hermite_##vec(p[n][0], p[n][1], p[n][2], p[n][3], tx);            \
+        }                                                                              \
+        const vec value = hermite_##vec(col[0], col[1], col[2], col[3], ty);           \
+                                                                                       \
+        memcpy(&out[i - start], &value, sizeof(value));                                \
+    }                                                                                  \
+                                                                                       \
+    rescale_float_scalar(image, &out[i - start], i, end);                              \
+}
+
+DEFINE_RESCALE_FLOAT_VECTOR(v4f, 4, )
+#ifdef KERNELS_X86
+DEFINE_RESCALE_FLOAT_VECTOR(v8f, 8, __attribute__((target("avx2"))))
+DEFINE_RESCALE_FLOAT_VECTOR(v16f, 16, __attribute__((target("avx512f"))))
+#endif
+
+/* Grid sampling */
+
+static void sample_row_scalar(unsigned char   *const row,
+                              const ppm_image *const image,
+                              const long i) {
+    const long q = image->y / STEP;
+
+    for (long j = 0; j <= q; ++j) {
+        row[j] = pixel_luminance(image->data[grid_sample_offset(image, i, j)]) <= SIGMA;
+    }
+}
+
+// 16 grid points at a time, as the batch kernel does for 16 images
+static void sample_row_vector(unsigned char   *const row,
+                              const ppm_image *const image,
+                              const long i) {
+    const long q = image->y / STEP;
+    long       j = 0;
+
+    for (; j + 16 <= q + 1; j += 16) {
+        lanes_u16 red, green, blue;
+
+        for (long l = 0; l < 16; ++l) {
+            const ppm_pixel pix = image->data[grid_sample_offset(image, i, j + l)];
+
+            red[l]   = pix.red;
+            green[l] = pix.green;
+            blue[l]  = pix.blue;
+        }
+
+        const lanes_u8 values = __builtin_convertvector((red + green + blue) / 3 <= SIGMA,
+                                                        lanes_u8) & 1;
+        memcpy(&row[j], &values, sizeof(values));
+    }
+
+    for (; j <= q; ++j) {
+        row[j] = pixel_luminance(image->data[grid_sample_offset(image, i, j)]) <= SIGMA;
+    }
+}
+
+/* Marching */
+
+static inline unsigned char march_config(const unsigned char *const top,
+                                         const unsigned char *const bottom,
+                                         const long j) {
+    return 8 * top[j] + 4 * top[j + 1] + 2 * bottom[j + 1] + bottom[j];
+}
+
+static void march_row_scalar(ppm_image           *const image,
+                             const unsigned char *const top,
+                             const unsigned char *const bottom,
+                             ppm_image     *const *const cmap,
+                             const long i) {
+    for (long j = 0; j < image->y / STEP; ++j) {
+        march_update(image, cmap[march_config(top, bottom, j)], i * STEP, j * STEP);
+    }
+}
+
+// One memcpy per tile row
+static void march_row_memcpy(ppm_image           *const image,
+                             const unsigned char *const top,
+                             const unsigned char *const bottom,
+                             ppm_image     *const *const cmap,
+                             const long i) {
+    for (long j = 0; j < image->y / STEP; ++j) {
+        const ppm_image *const c = cmap[march_config(top, bottom, j)];
+
+        for (int r = 0; r < c->x; ++r) {
+            memcpy(&image->data[(i * STEP + r) * image->y + j * STEP],
+                   &c->data[c->x * r], c->y * sizeof(ppm_pixel));
+        }
+    }
+}
+
+#ifdef KERNELS_X86
+// Non-temporal stores, so that writing the output doesn't evict the grid and
+// the tiles from the cache. The pixels aren't aligned, so only the aligned
+// 4 byte words of every tile row are streamed.
+static void march_row_stream(ppm_image           *const image,
+                             const unsigned char *const top,
+                             const unsigned char *const bottom,
+                             ppm_image     *const *const cmap,
+                             const long i) {
+    for (long j = 0; j < image->y / STEP; ++j) {
+        const ppm_image *const c = cmap[march_config(top, bottom, j)];
+
+        for (int r = 0; r < c->x; ++r) {
+            unsigned char       *dst = (unsigned char *) &image->data[(i * STEP + r) * image->y + j * STEP];
+            const unsigned char *src = (const unsigned char *) &c->data[c->x * r];
+            long                 n   = c->y * sizeof(ppm_pixel);
+
+            for (; n && ((uintptr_t) dst & 3); --n) {
+                *dst++ = *src++;
+            }
+            for (; n >= 4; n -= 4, dst += 4, src += 4) {
+                int word;
+
+                memcpy(&word, src, sizeof(word));
+                _mm_stream_si32((int *) dst, word);
+            }
+            for (; n; --n) {
+                *dst++ = *src++;
+            }
+        }
+    }
+
+    // Streamed stores aren't ordered with the others, so make them visible
+    // before the barrier that ends the phase
+    _mm_sfence();
+}
+#endif
+
+/* Benchmarks, timing the bound variant on synthetic data */
+
+static ppm_image *bench_image(const int x, const int y) {
+    ppm_image *const image = malloc(sizeof(ppm_image));
+
+    image->x    = x;
+    image->y    = y;
+    image->data = malloc((size_t) x * y * sizeof(ppm_pixel));
+    for (long i = 0; i < (long) x * y; ++i) {
+        image->data[i] = (ppm_pixel) { rand() & 0xff, rand() & 0xff, rand() & 0xff };
+    }
+    return image;
+}
+
+static void bench_free(ppm_image *const image) {
+    free(image->data);
+    free(image);
+}
+
+static double bench_now(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static double bench_rescale(void) {
+    ppm_image *const image  = bench_image(RESCALE_X / 4, RESCALE_Y / 4);
+    ppm_image *const scaled = bench_image(2 * STEP, RESCALE_Y);
+
+    const double begin = bench_now();
+    kernels.rescale(image, scaled->data, 0, (long) scaled->x * scaled->y);
+    const double end = bench_now();
+
+    bench_free(image);
+    bench_free(scaled);
+    return end - begin;
+}
+
+static double bench_rescale_float(void) {
+    float_image field = { .x = RESCALE_X / 4, .y = RESCALE_Y / 4 };
+    float *const out  = malloc(2 * STEP * RESCALE_Y * sizeof(float));
+
+    field.data = malloc((size_t) field.x * field.y * sizeof(float));
+    for (long i = 0; i < (long) field.x * field.y; ++i) {
+        field.data[i] = rand() / (float) RAND_MAX * 255.0f;
+    }
+
+    const double begin = bench_now();
+    kernels.rescale_float(&field, out, 0, 2 * STEP * RESCALE_Y);
+    const double end = bench_now();
+
+    free(field.data);
+    free(out);
+    return end - begin;
+}
+
+static double bench_sample_grid(void) {
+    ppm_image *const     image = bench_image(RESCALE_X / 2, RESCALE_Y);
+    unsigned char *const row   = malloc(image->y / STEP + 1);
+
+    const double begin = bench_now();
+    for (long i = 0; i <= image->x / STEP; ++i) {
+        kernels.sample_row(row, image, i);
+    }
+    const double end = bench_now();
+
+    free(row);
+    bench_free(image);
+    return end - begin;
+}
+
+static double bench_march(void) {
+    ppm_image *const image = bench_image(RESCALE_X / 2, RESCALE_Y);
+    const long       q     = image->y / STEP;
+    unsigned char   *rows[2];
+    ppm_image       *cmap[CONTOUR_CONFIG_COUNT];
+
+    for (long r = 0; r < 2; ++r) {
+        rows[r] = malloc(q + 1);
+        for (long j = 0; j <= q; ++j) {
+            rows[r][j] = rand() & 1;
+        }
+    }
+    for (long k = 0; k < CONTOUR_CONFIG_COUNT; ++k) {
+        cmap[k] = bench_image(STEP, STEP);
+    }
+
+    const double begin = bench_now();
+    for (long i = 0; i < image->x / STEP; ++i) {
+        kernels.march_row(image, rows[i & 1], rows[!(i & 1)], cmap, i);
+    }
+    const double end = bench_now();
+
+    for (long k = 0; k < CONTOUR_CONFIG_COUNT; ++k) {
+        bench_free(cmap[k]);
+    }
+    free(rows[0]);
+    free(rows[1]);
+    bench_free(image);
+    return end - begin;
+}
+
+/* Registry */
+
+#define VARIANT(name, cpu, fn) { name, cpu, (void (*)(void)) fn }
+
+// The wider variants only pay off in optimized builds, where the lanes
+// aren't filled through memory, so they are left to the benchmark
+static const kernel_variant rescale_variants[] = {
+    VARIANT("vector",  NULL,      rescale_v4f),
+#ifdef KERNELS_X86
+    VARIANT("avx2",    "avx2",    rescale_v8f),
+    VARIANT("avx512f", "avx512f", rescale_v16f),
+#endif
+    VARIANT("scalar",  NULL,      rescale_scalar),
+};
+
+static const kernel_variant rescale_float_variants[] = {
+    VARIANT("vector",  NULL,      rescale_float_v4f),
+#ifdef KERNELS_X86
+    VARIANT("avx2",    "avx2",    rescale_float_v8f),
+    VARIANT("avx512f", "avx512f", rescale_float_v16f),
+#endif
+    VARIANT("scalar",  NULL,      rescale_float_scalar),
+};
+
+static const kernel_variant sample_grid_variants[] = {
+    VARIANT("vector",  NULL,      sample_row_vector),
+    VARIANT("scalar",  NULL,      sample_row_scalar),
+};
+
+static const kernel_variant march_variants[] = {
+    VARIANT("memcpy",  NULL,      march_row_memcpy),
+#ifdef KERNELS_X86
+    VARIANT("stream",  "sse2",    march_row_stream),
+#endif
+    VARIANT("scalar",  NULL,      march_row_scalar),
+};
+
+#define KERNEL(name, variants, benchmark) \
+    { name, variants, sizeof(variants) / sizeof(variants[0]), benchmark }
+
+static const kernel registry[NKERNELS] = {
+    [KERNEL_RESCALE]       = KERNEL("rescale",       rescale_variants,       bench_rescale),
+    [KERNEL_RESCALE_FLOAT] = KERNEL("rescale_float", rescale_float_variants, bench_rescale_float),
+    [KERNEL_SAMPLE_GRID]   = KERNEL("sample_grid",   sample_grid_variants,   bench_sample_grid),
+    [KERNEL_MARCH]         = KERNEL("march",         march_variants,         bench_march),
+};
+
+kernel_table kernels = {
+    .rescale       = rescale_scalar,
+    .rescale_float = rescale_float_scalar,
+    .sample_row    = sample_row_scalar,
+    .march_row     = march_row_scalar
+};
+
+static int cpu_supports(const char *const feature) {
+    if (!feature) {
+        return 1;
+    }
+
+#ifdef KERNELS_X86
+    __builtin_cpu_init();
+    if (!strcmp(feature, "sse2")) {
+        return __builtin_cpu_supports("sse2");
+    }
+    if (!strcmp(feature, "avx2")) {
+        return __builtin_cpu_supports("avx2");
+    }
+    if (!strcmp(feature, "avx512f")) {
+        return __builtin_cpu_supports("avx512f");
+    }
+#endif
+
+    return 0;
+}
+
+// The features the variants care about, as the first line of a profile
+static void cpu_signature(char *const signature, const size_t size) {
+    static const char *const features[] = { "sse2", "avx2", "avx512f" };
+
+    snprintf(signature, size, "cpu");
+    for (size_t f = 0; f < sizeof(features) / sizeof(features[0]); ++f) {
+        if (cpu_supports(features[f])) {
+            strncat(signature, " ", size - strlen(signature) - 1);
+            strncat(signature, features[f], size - strlen(signature) - 1);
+        }
+    }
+}
+
+long kernel_count(void) {
+    return NKERNELS;
+}
+
+long kernel_variant_count(const long k) {
+    return registry[k].nvariants;
+}
+
+const char *kernel_name(const long k) {
+    return registry[k].name;
+}
+
+const char *kernel_variant_name(const long k, const long v) {
+    return registry[k].variants[v].name;
+}
+
+int kernel_bind(const long k, const long v) {
+    const kernel_variant *const variant = &registry[k].variants[v];
+
+    if (!cpu_supports(variant->cpu)) {
+        return 0;
+    }
+
+    switch (k) {
+    case KERNEL_RESCALE:
+        kernels.rescale = (void (*)(ppm_image *, ppm_pixel *, long, long)) variant->fn;
+        break;
+    case KERNEL_RESCALE_FLOAT:
+        kernels.rescale_float = (void (*)(const float_image *, float *, long, long)) variant->fn;
+        break;
+    case KERNEL_SAMPLE_GRID:
+        kernels.sample_row = (void (*)(unsigned char *, const ppm_image *, long)) variant->fn;
+        break;
+    case KERNEL_MARCH:
+        kernels.march_row = (void (*)(ppm_image *, const unsigned char *, const unsigned char *,
+                                      ppm_image *const *, long)) variant->fn;
+        break;
+    }
+    return 1;
+}
+
+static long kernel_find(const char *const name) {
+    for (long k = 0; k < NKERNELS; ++k) {
+        if (!strcmp(registry[k].name, name)) {
+            return k;
+        }
+    }
+    return -1;
+}
+
+static long kernel_variant_find(const long k, const char *const name) {
+    for (long v = 0; v < registry[k].nvariants; ++v) {
+        if (!strcmp(registry[k].variants[v].name, name)) {
+            return v;
+        }
+    }
+    return -1;
+}
+
+// Binds every supported variant of kernel `k` in turn, and keeps the
+// fastest one
+static long kernel_benchmark(const long k) {
+    long   best      = -1;
+    double best_time = 0;
+
+    for (long v = 0; v < registry[k].nvariants; ++v) {
+        if (!kernel_bind(k, v)) {
+            continue;
+        }
+
+        double time = registry[k].benchmark();
+        for (long run = 1; run < KERNEL_BENCH_RUNS; ++run) {
+            time = fmin(time, registry[k].benchmark());
+        }
+
+        if (best < 0 || time < best_time) {
+            best      = v;
+            best_time = time;
+        }
+    }
+    return best;
+}
+
+// Reads the variants of `filename`, if it was written on a CPU like this one
+static int kernels_read_profile(const char *const filename, long *const chosen) {
+    FILE *fp = fopen(filename, "r");
+    if (!fp) {
+        return 0;
+    }
+
+    char line[256], signature[256];
+    int  valid = 0;
+
+    cpu_signature(signature, sizeof(signature));
+    if (fgets(line, sizeof(line), fp)) {
+        line[strcspn(line, "\n")] = '\0';
+        valid = !strcmp(line, signature);
+    }
+    if (valid) {
+        while (fgets(line, sizeof(line), fp)) {
+            char name[64], variant[64];
+            long k, v;
+
+            if (sscanf(line, "%63s %63s", name, variant) != 2
+                || (k = kernel_find(name)) < 0
+                || (v = kernel_variant_find(k, variant)) < 0) {
+                valid = 0;
+                break;
+            }
+            chosen[k] = v;
+        }
+    }
+
+    fclose(fp);
+    for (long k = 0; k < NKERNELS; ++k) {
+        valid = valid && chosen[k] >= 0;
+    }
+    return valid;
+}
+
+static void kernels_write_profile(const char *const filename, const long *const chosen) {
+    FILE *fp = fopen(filename, "w");
+    if (!fp) {
+        fprintf(stderr, "Unable to open file '%s'\n", filename);
+        exit(1);
+    }
+
+    char signature[256];
+
+    cpu_signature(signature, sizeof(signature));
+    fprintf(fp, "%s\n", signature);
+    for (long k = 0; k < NKERNELS; ++k) {
+        fprintf(fp, "%s %s\n", registry[k].name, registry[k].variants[chosen[k]].name);
+    }
+    fclose(fp);
+}
+
+void kernels_init(const char *const *const forced,
+                  const long nforced,
+                  const char *const filename_profile,
+                  const int benchmark) {
+    long chosen[NKERNELS];
+    int  measured = 0;
+
+    for (long k = 0; k < NKERNELS; ++k) {
+        chosen[k] = -1;
+    }
+
+    if (!filename_profile || !kernels_read_profile(filename_profile, chosen)) {
+        for (long k = 0; k < NKERNELS; ++k) {
+            chosen[k] = -1;
+            if (benchmark || filename_profile) {
+                chosen[k] = kernel_benchmark(k);
+                measured  = 1;
+            } else {
+                for (long v = 0; v < registry[k].nvariants && chosen[k] < 0; ++v) {
+                    chosen[k] = cpu_supports(registry[k].variants[v].cpu) ? v : -1;
+                }
+            }
+        }
+        if (filename_profile) {
+            kernels_write_profile(filename_profile, chosen);
+        }
+    }
+
+    for (long f = 0; f < nforced; ++f) {
+        char        name[64];
+        const char *variant = strchr(forced[f], '=');
+        long        k = -1, v = -1;
+
+        if (variant && variant - forced[f] < (long) sizeof(name)) {
+            memcpy(name, forced[f], variant - forced[f]);
+            name[variant - forced[f]] = '\0';
+            if ((k = kernel_find(name)) >= 0) {
+                v = kernel_variant_find(k, variant + 1);
+            }
+        }
+        if (v < 0) {
+            fprintf(stderr, "Unknown kernel variant '%s'\n", forced[f]);
+            exit(1);
+        }
+        if (!cpu_supports(registry[k].variants[v].cpu)) {
+            fprintf(stderr, "This CPU can't run kernel variant '%s'\n", forced[f]);
+            exit(1);
+        }
+        chosen[k] = v;
+    }
+
+    for (long k = 0; k < NKERNELS; ++k) {
+        kernel_bind(k, chosen[k]);
+    }
+
+    if (measured) {
+        fprintf(stderr, "kernels: rescale=%s rescale_float=%s sample_grid=%s march=%s\n",
+                registry[KERNEL_RESCALE].variants[chosen[KERNEL_RESCALE]].name,
+                registry[KERNEL_RESCALE_FLOAT].variants[chosen[KERNEL_RESCALE_FLOAT]].name,
+                registry[KERNEL_SAMPLE_GRID].variants[chosen[KERNEL_SAMPLE_GRID]].name,
+                registry[KERNEL_MARCH].variants[chosen[KERNEL_MARCH]].name);
+    }
+}
@@ -0,0 +1,55 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include "helpers.h"
+#include "pfm.h"
+
+// The hot loops of the worker, each with several implementations. The
+// bound ones start out as the plain scalar versions.
+typedef struct {
+    // Pixels [start, end) of the rescaled image, to out[0, end - start)
+    void (*rescale)(ppm_image *const image,
+                    ppm_pixel *const out,
+                    const long start,
+                    const long end);
+    // Values [start, end) of a rescaled float field, to out[0, end - start)
+    void (*rescale_float)(const float_image *const image,
+                          float             *const out,
+                          const long start,
+                          const long end);
+    // Row `i` of the grid, q + 1 points
+    void (*sample_row)(unsigned char   *const row,
+                       const ppm_image *const image,
+                       const long i);
+    // Row `i` of cells, between grid rows `top` and `bottom`
+    void (*march_row)(ppm_image           *const image,
+                      const unsigned char *const top,
+                      const unsigned char *const bottom,
+                      ppm_image     *const *const cmap,
+                      const long i);
+} kernel_table;
+
+extern kernel_table kernels;
+
+// Binds a variant of every kernel. `forced` holds "kernel=variant" strings
+// that take precedence. Otherwise the choice is read from `filename_profile`
+// if it was written on a CPU with the same features, or benchmarked if
+// `benchmark` is set or the profile has to be (re)written. Failing that,
+// the first variant of each kernel the CPU supports is used. Exits on
+// unknown or unsupported variants.
+void kernels_init(const char *const *const forced,
+                  const long nforced,
+                  const char *const filename_profile,
+                  const int benchmark);
+
+// Number of variants of every kernel, and their names, for the tests
+long        kernel_count(void);
+long        kernel_variant_count(const long kernel);
+const char *kernel_name(const long kernel);
+const char *kernel_variant_name(const long kernel, const long variant);
+// Whether the CPU runs `variant`; if so binds it and returns 1
+int         kernel_bind(const long kernel, const long variant);
+
+#endif
@@ -0,0 +1,424 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+// Load generator for `tema1_par --serve`: replays a job mix against the
+// server socket, from a trace the server recorded or made up, over a number
+// of connections, and reports the throughput, latencies and queueing delays
+// achieved. The images are generated, with the sizes of the mix, one for
+// every job unless it is told to repeat some.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <getopt.h>
+#include <pthread.h>
+
+#include "helpers.h"
+#include "server.h"
+
+typedef struct {
+    double        arrival_ms;    // since the start of the replay
+    int           width, height;
+    int           priority;
+    long          budget_ms;     // 0 for none
+    ppm_image    *image;
+    int           repeated;      // `image` is that of an earlier job
+    // Measured, in microseconds
+    long          wait_us;       // for a free connection, past the arrival
+    long          queue_us;      // in the queue of the server
+    long          run_us;
+    long          latency_us;    // from the arrival to the whole result
+    int           failed;
+    server_status status;
+} loadgen_job;
+
+typedef struct {
+    loadgen_job     *jobs;
+    long             njobs;
+    long             next;
+    const char      *socket_path;
+    double           speed;
+    long             budget_ms;     // of the jobs without one of their own
+    struct timespec  start;
+    pthread_mutex_t  lock;
+} loadgen;
+
+// Made up job mix: mostly small images, some at the size of the output and
+// a few large enough to be rescaled
+static const struct {
+    int width, height, weight;
+} synthetic_sizes[] = {
+    { 64,   64,   40 },
+    { 320,  240,  30 },
+    { 1024, 768,  20 },
+    { 2048, 2048, 8  },
+    { 3000, 2200, 2  },
+};
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "Usage: %s [options] <socket>\n"
+            "  --trace FILE      replay the jobs of FILE, as --serve --trace records\n"
+            "                    them: \"<arrival_ms> <width> <height> <priority> [<budget_ms>]\"\n"
+            "  --synthetic N     make up N jobs instead (100 by default)\n"
+            "  --rate R          arrivals per second of the made up jobs (10)\n"
+            "  --seed N          seed of the made up jobs and images (1)\n"
+            "  --duplicate-rate P  share of the jobs sending the same image as the\n"
+            "                    last one of their size, for the server to coalesce (0)\n"
+            "  --speed S         replay S times faster than the arrivals (1)\n"
+            "  --concurrency C   connections to the server (4)\n"
+            "  --deadline MS     budget of the jobs the trace gives none\n"
+            "  --quit            stop the server afterwards\n",
+            argv0);
+    exit(1);
+}
+
+static double elapsed_ms(const struct timespec *const from, const struct timespec *const to) {
+    return (to->tv_sec - from->tv_sec) * 1e3 + (to->tv_nsec - from->tv_nsec) / 1e6;
+}
+
+static long read_trace(const char *filename, loadgen_job **const jobs) {
+    FILE *const fp       = fopen(filename, "r");
+    long        n        = 0;
+    long        capacity = 256;
+    char        line[256];
+
+    if (!fp) {
+        fprintf(stderr, "Unable to open file '%s'\n", filename);
+        exit(1);
+    }
+
+    *jobs = malloc(capacity * sizeof(loadgen_job));
+    while (fgets(line, sizeof(line), fp)) {
+        loadgen_job job = { 0 };
+
+        if (line[0] == '#' || line[strspn(line, " \t\r\n")] == '\0') {
+            continue;
+        }
+        if (sscanf(line, "%lf %d %d %d %ld", &job.arrival_ms, &job.width, &job.height,
+                   &job.priority, &job.budget_ms) < 4 || job.width <= 0 || job.height <= 0
+            || job.budget_ms < 0) {
+            fprintf(stderr, "Invalid trace line in '%s': %s", filename, line);
+            exit(1);
+        }
+        if (n == capacity) {
+            capacity *= 2;
+            *jobs     = realloc(*jobs, capacity * sizeof(loadgen_job));
+        }
+        (*jobs)[n++] = job;
+    }
+    fclose(fp);
+    return n;
+}
+
+// Poisson arrivals at `rate` per second
+static long make_jobs(const long n, const double rate, unsigned *const seed, loadgen_job **const jobs) {
+    const long nsizes = sizeof(synthetic_sizes) / sizeof(synthetic_sizes[0]);
+    int        total  = 0;
+    double     now    = 0;
+
+    for (long s = 0; s < nsizes; ++s) {
+        total += synthetic_sizes[s].weight;
+    }
+
+    *jobs = malloc(n * sizeof(loadgen_job));
+    for (long i = 0; i < n; ++i) {
+        int  pick = rand_r(seed) % total;
+        long s    = 0;
+
+        while (pick >= synthetic_sizes[s].weight) {
+            pick -= synthetic_sizes[s++].weight;
+        }
+
+        (*jobs)[i] = (loadgen_job) {
+            .arrival_ms = now,
+            .width      = synthetic_sizes[s].width,
+            .height     = synthetic_sizes[s].height,
+            .priority   = rand_r(seed) % 4
+        };
+        now -= log((rand_r(seed) + 1.0) / (RAND_MAX + 2.0)) * 1000 / rate;
+    }
+    return n;
+}
+
+// Blobs of random sizes and levels on a gradient, so that every image has
+// contours to march
+static ppm_image *make_image(const int width, const int height, unsigned *const seed) {
+    ppm_image *const image = malloc(sizeof(ppm_image));
+    float            blobs[16][4];
+
+    image->x    = width;
+    image->y    = height;
+    image->data = malloc((size_t) width * height * sizeof(ppm_pixel));
+
+    for (int b = 0; b < 16; ++b) {
+        blobs[b][0] = rand_r(seed) % width;
+        blobs[b][1] = rand_r(seed) % height;
+        blobs[b][2] = 1 + rand_r(seed) % (1 + (width + height) / 8);
+        blobs[b][3] = rand_r(seed) % 256 - 128;
+    }
+
+    for (long i = 0; i < (long) width * height; ++i) {
+        const long x = i % width;
+        const long y = i / width;
+        float      v = 255.0f * (x + y) / (width + height);
+
+        for (int b = 0; b < 16; ++b) {
+            const float dx = (x - blobs[b][0]) / blobs[b][2];
+            const float dy = (y - blobs[b][1]) / blobs[b][2];
+
+            v += blobs[b][3] * expf(-(dx * dx + dy * dy));
+        }
+        v = v < 0 ? 0 : v > 255 ? 255 : v;
+        image->data[i] = (ppm_pixel) { v, v, v };
+    }
+    return image;
+}
+
+static void *client(void *arg) {
+    loadgen *const       lg   = arg;
+    server_client *const conn = server_connect(lg->socket_path);
+
+    if (!conn) {
+        perror(lg->socket_path);
+        exit(1);
+    }
+
+    for (;;) {
+        pthread_mutex_lock(&lg->lock);
+        const long i = lg->next++;
+        pthread_mutex_unlock(&lg->lock);
+
+        if (i >= lg->njobs) {
+            break;
+        }
+
+        loadgen_job *const job = &lg->jobs[i];
+        const double       due = job->arrival_ms / lg->speed;
+        struct timespec    now;
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if (elapsed_ms(&lg->start, &now) < due) {
+            const double          ms   = due - elapsed_ms(&lg->start, &now);
+            const struct timespec wait = { (time_t) (ms / 1e3), (long) (fmod(ms, 1e3) * 1e6) };
+
+            nanosleep(&wait, NULL);
+            clock_gettime(CLOCK_MONOTONIC, &now);
+        }
+        job->wait_us = (elapsed_ms(&lg->start, &now) - due) * 1e3;
+        if (job->wait_us < 0) {
+            job->wait_us = 0;
+        }
+
+        ppm_image *const result = server_request(conn, job->priority,
+                                                 job->budget_ms ? job->budget_ms : lg->budget_ms,
+                                                 job->image, &job->queue_us, &job->run_us,
+                                                 &job->status);
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        job->latency_us = (elapsed_ms(&lg->start, &now) - due) * 1e3;
+        if (job->status == SERVER_EXPIRED) {
+            continue;
+        }
+        if (!result) {
+            fprintf(stderr, "loadgen: job %ld failed, reconnecting\n", i);
+            job->failed = 1;
+            server_disconnect(conn);
+            return client(arg);
+        }
+        free(result->data);
+        free(result);
+    }
+
+    server_disconnect(conn);
+    return NULL;
+}
+
+static int compare_long(const void *a, const void *b) {
+    const long x = *(const long *) a;
+    const long y = *(const long *) b;
+
+    return (x > y) - (x < y);
+}
+
+// Nearest rank percentiles of the `n` values at `values`, sorted in place
+static void report_line(const char *name, long *const values, const long n) {
+    static const double percentiles[] = { 50, 90, 99 };
+
+    qsort(values, n, sizeof(long), compare_long);
+    printf("%-10s", name);
+    for (size_t p = 0; p < sizeof(percentiles) / sizeof(percentiles[0]); ++p) {
+        const long rank = (long) ceil(percentiles[p] / 100 * n);
+
+        printf(" %10.2f", values[rank > 0 ? rank - 1 : 0] / 1e3);
+    }
+    printf(" %10.2f\n", values[n - 1] / 1e3);
+}
+
+int main(int argc, char *argv[]) {
+    static const struct option long_options[] = {
+        { "trace",          required_argument, NULL, 't' },
+        { "synthetic",      required_argument, NULL, 'n' },
+        { "rate",           required_argument, NULL, 'r' },
+        { "seed",           required_argument, NULL, 's' },
+        { "duplicate-rate", required_argument, NULL, 'u' },
+        { "speed",          required_argument, NULL, 'x' },
+        { "concurrency",    required_argument, NULL, 'c' },
+        { "deadline",       required_argument, NULL, 'd' },
+        { "quit",           no_argument,       NULL, 'q' },
+        { NULL,             0,                 NULL, 0   }
+    };
+
+    const char *filename_trace = NULL;
+    long        synthetic      = 100;
+    double      rate           = 10;
+    unsigned    seed           = 1;
+    double      duplicate_rate = 0;
+    double      speed          = 1;
+    long        concurrency    = 4;
+    long        deadline       = 0;
+    int         quit           = 0;
+    int         opt;
+
+    while ((opt = getopt_long(argc, argv, "", long_options, NULL)) != -1) {
+        switch (opt) {
+        case 't':
+            filename_trace = optarg;
+            break;
+        case 'n':
+            synthetic = atol(optarg);
+            break;
+        case 'r':
+            rate = atof(optarg);
+            break;
+        case 's':
+            seed = atoi(optarg);
+            break;
+        case 'u':
+            duplicate_rate = atof(optarg);
+            break;
+        case 'x':
+            speed = atof(optarg);
+            break;
+        case 'c':
+            concurrency = atol(optarg);
+            break;
+        case 'd':
+            deadline = atol(optarg);
+            break;
+        case 'q':
+            quit = 1;
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    if (argc - optind != 1 || synthetic < 1 || rate <= 0 || speed <= 0 || concurrency < 1 || deadline < 0
+        || duplicate_rate < 0 || duplicate_rate > 1) {
+        usage(argv[0]);
+    }
+
+    loadgen lg = { .socket_path = argv[optind], .speed = speed, .budget_ms = deadline };
+
+    lg.njobs = filename_trace ? read_trace(filename_trace, &lg.jobs)
+                              : make_jobs(synthetic, rate, &seed, &lg.jobs);
+    if (!lg.njobs) {
+        fprintf(stderr, "No jobs in '%s'\n", filename_trace);
+        exit(1);
+    }
+
+    // An image of its own for every job, from a seed of its own, unless it
+    // repeats that of the last job of its size. Made before the clock starts.
+    double mpix = 0;
+
+    for (long i = 0; i < lg.njobs; ++i) {
+        unsigned image_seed = rand_r(&seed);
+
+        if (rand_r(&seed) < duplicate_rate * ((double) RAND_MAX + 1)) {
+            for (long j = i - 1; j >= 0 && !lg.jobs[i].image; --j) {
+                if (lg.jobs[j].width == lg.jobs[i].width && lg.jobs[j].height == lg.jobs[i].height) {
+                    lg.jobs[i].image    = lg.jobs[j].image;
+                    lg.jobs[i].repeated = 1;
+                }
+            }
+        }
+        if (!lg.jobs[i].image) {
+            lg.jobs[i].image = make_image(lg.jobs[i].width, lg.jobs[i].height, &image_seed);
+        }
+        mpix += (double) lg.jobs[i].width * lg.jobs[i].height / 1e6;
+    }
+
+    pthread_t *const threads = malloc(concurrency * sizeof(pthread_t));
+    struct timespec  end;
+
+    pthread_mutex_init(&lg.lock, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &lg.start);
+    for (long t = 0; t < concurrency; ++t) {
+        pthread_create(&threads[t], NULL, client, &lg);
+    }
+    for (long t = 0; t < concurrency; ++t) {
+        pthread_join(threads[t], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    pthread_mutex_destroy(&lg.lock);
+
+    if (quit) {
+        server_client *const conn = server_connect(lg.socket_path);
+
+        if (!conn || server_quit(conn)) {
+            fprintf(stderr, "loadgen: the server didn't stop\n");
+        }
+        if (conn) {
+            server_disconnect(conn);
+        }
+    }
+
+    // Failed, expired and shared jobs count in the throughput, not in the
+    // latencies: a shared job only waited for the result of another.
+    long *const latency = malloc(lg.njobs * sizeof(long));
+    long *const queue   = malloc(lg.njobs * sizeof(long));
+    long *const run     = malloc(lg.njobs * sizeof(long));
+    long        n       = 0;
+    long        failed  = 0;
+    long        expired = 0;
+    long        shared  = 0;
+
+    for (long i = 0; i < lg.njobs; ++i) {
+        failed  += lg.jobs[i].failed;
+        expired += lg.jobs[i].status == SERVER_EXPIRED;
+        shared  += lg.jobs[i].status == SERVER_SHARED;
+        if (!lg.jobs[i].failed && lg.jobs[i].status != SERVER_EXPIRED
+            && lg.jobs[i].status != SERVER_SHARED) {
+            latency[n] = lg.jobs[i].latency_us;
+            queue[n]   = lg.jobs[i].wait_us + lg.jobs[i].queue_us;
+            run[n]     = lg.jobs[i].run_us;
+            ++n;
+        }
+    }
+
+    const double seconds = elapsed_ms(&lg.start, &end) / 1e3;
+
+    printf("%ld jobs (%ld failed, %ld expired, %ld shared) on %ld connections in %.3f s: "
+           "%.2f jobs/s, %.2f MPix/s\n", lg.njobs, failed, expired, shared, concurrency, seconds,
+           lg.njobs / seconds, mpix / seconds);
+    if (n) {
+        printf("%-10s %10s %10s %10s %10s  (ms)\n", "", "p50", "p90", "p99", "max");
+        report_line("latency", latency, n);
+        report_line("queueing", queue, n);
+        report_line("service", run, n);
+    }
+
+    for (long i = 0; i < lg.njobs; ++i) {
+        if (!lg.jobs[i].repeated) {
+            free(lg.jobs[i].image->data);
+            free(lg.jobs[i].image);
+        }
+    }
+    free(lg.jobs);
+    free(threads);
+    free(latency);
+    free(queue);
+    free(run);
+    return failed ? 1 : 0;
+}
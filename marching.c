@@ -0,0 +1,78 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "marching.h"
+#include "kernels.h"
+
+void init_cmap(ppm_image **const cmap,
+               const long tid,
+               const long nthreads) {
+    const thread_slice slice = thread_get_slice(tid, nthreads, CONTOUR_CONFIG_COUNT);
+
+    for (long i = slice.start; i < slice.end; ++i) {
+        char filename[FILENAME_MAX_SIZE];
+        sprintf(filename, "./contours/%ld.ppm", i);
+        cmap[i] = read_ppm(filename);
+    }
+}
+
+void rescale_image(ppm_image    *const image,
+                   ppm_image    *const scaled,
+                   cancel_token *const cancel,
+                   const long tid,
+                   const long nthreads) {
+    if (image->x <= RESCALE_X && image->y <= RESCALE_Y) {
+        return;
+    }
+
+    scaled->x = RESCALE_X;
+    scaled->y = RESCALE_Y;
+
+    const thread_slice slice = thread_get_slice(tid, nthreads, RESCALE_X * RESCALE_Y);
+    const long         band  = CANCEL_BAND_ROWS * RESCALE_Y;
+
+    for (long start = slice.start; start < slice.end && !cancel_check(cancel); start += band) {
+        kernels.rescale(image, &scaled->data[start], start, MIN(start + band, slice.end));
+    }
+}
+
+void sample_grid(unsigned char  **const grid,
+                 const ppm_image *const image,
+                 cancel_token    *const cancel,
+                 const long tid,
+                 const long nthreads) {
+    const long   p           = image->x / STEP;
+    const thread_slice slice = thread_get_slice(tid, nthreads, p);
+
+    for (long i = slice.start; i < slice.end; ++i) {
+        if ((i - slice.start) % (CANCEL_BAND_ROWS / STEP) == 0 && cancel_check(cancel)) {
+            return;
+        }
+        kernels.sample_row(grid[i], image, i);
+    }
+
+    // Task reserved for the thread having the last slice of the range
+    if (tid == nthreads - 1 && !cancel_check(cancel)) {
+        kernels.sample_row(grid[p], image, p);
+    }
+}
+
+void march(ppm_image     *const image,
+           unsigned char *const *const grid,
+           ppm_image     *const *const cmap,
+           cancel_token  *const cancel,
+           const long     tid,
+           const long     nthreads) {
+    const long p = image->x / STEP;
+
+    const thread_slice slice = thread_get_slice(tid, nthreads, p);
+
+    for (long i = slice.start; i < slice.end; ++i) {
+        if ((i - slice.start) % (CANCEL_BAND_ROWS / STEP) == 0 && cancel_check(cancel)) {
+            return;
+        }
+        kernels.march_row(image, grid[i], grid[i + 1], cmap, i);
+    }
+}
@@ -0,0 +1,82 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef MARCHING_H
+#define MARCHING_H
+
+#include "helpers.h"
+#include "cancel.h"
+
+#define MIN(a, b)          ((a) < (b) ? (a) : (b))
+
+typedef struct {
+    long start;
+    long end;
+} thread_slice;
+
+static inline thread_slice thread_get_slice(const long tid,
+                                     const long nthreads,
+                                     const long range) {
+    // Integer arithmetic, so that the last slice always ends on `range`
+    return (thread_slice) {
+        .start = tid * range / nthreads,
+        .end   = MIN((tid + 1) * range / nthreads, range)
+    };
+}
+
+static inline unsigned char pixel_luminance(const ppm_pixel pix) {
+    return (pix.red + pix.green + pix.blue) / 3;
+}
+
+// Offset of the pixel sampled for grid point (i, j). The last row and column
+// of the grid sample the last row and column of the image.
+static inline long grid_sample_offset(const ppm_image *const image,
+                                      const long i,
+                                      const long j) {
+    const long row = i < image->x / STEP ? i * STEP : image->x - 1;
+    const long col = j < image->y / STEP ? j * STEP : MIN(image->x, image->y) - 1;
+
+    return row * image->y + col;
+}
+
+static inline void march_update(ppm_image *const image,
+                         const ppm_image *const c,
+                         const long x,
+                         const long y) {
+    int idx_i, idx_c;
+
+    for (int i = 0; i < c->x; ++i) {
+        for (int j = 0; j < c->y; ++j) {
+            idx_c = c->x * i + j;
+            idx_i = (x + i) * image->y + y + j;
+
+            image->data[idx_i].red   = c->data[idx_c].red;
+            image->data[idx_i].green = c->data[idx_c].green;
+            image->data[idx_i].blue  = c->data[idx_c].blue;
+        }
+    }
+}
+
+void init_cmap(ppm_image **const cmap,
+               const long tid,
+               const long nthreads);
+// These go a band of CANCEL_BAND_ROWS rows at a time, and stop between two
+// once `cancel` (possibly NULL) is cancelled
+void rescale_image(ppm_image    *const image,
+                   ppm_image    *const scaled,
+                   cancel_token *const cancel,
+                   const long tid,
+                   const long nthreads);
+// The x / STEP + 1 rows of `grid` must be allocated, of y / STEP + 1 points
+void sample_grid(unsigned char  **const grid,
+                 const ppm_image *const image,
+                 cancel_token    *const cancel,
+                 const long tid,
+                 const long nthreads);
+void march(ppm_image     *const image,
+           unsigned char *const *const grid,
+           ppm_image     *const *const cmap,
+           cancel_token  *const cancel,
+           const long     tid,
+           const long     nthreads);
+
+#endif
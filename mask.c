@@ -0,0 +1,294 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "marching.h"
+#include "kernels.h"
+#include "mask.h"
+
+// The header of a PAM file, one "TOKEN value" per line up to ENDHDR
+static void read_pam_header(FILE *const fp, const char *const filename,
+                            int *const width, int *const height, int *const depth) {
+    char line[256], token[64], value[64];
+    int  maxval = 0;
+
+    *width = *height = *depth = 0;
+    while (fgets(line, sizeof(line), fp)) {
+        if (line[0] == '#' || sscanf(line, "%63s", token) != 1) {
+            continue;
+        }
+        if (!strcmp(token, "ENDHDR")) {
+            break;
+        }
+        if (sscanf(line, "%63s %63s", token, value) != 2) {
+            fprintf(stderr, "Invalid PAM header line '%s' (error loading '%s')\n", token, filename);
+            exit(1);
+        }
+
+        if (!strcmp(token, "WIDTH")) {
+            *width = atoi(value);
+        } else if (!strcmp(token, "HEIGHT")) {
+            *height = atoi(value);
+        } else if (!strcmp(token, "DEPTH")) {
+            *depth = atoi(value);
+        } else if (!strcmp(token, "MAXVAL")) {
+            maxval = atoi(value);
+        } else if (!strcmp(token, "TUPLTYPE")
+                   && strcmp(value, "RGB") && strcmp(value, "RGB_ALPHA")) {
+            fprintf(stderr, "'%s' must be RGB or RGB_ALPHA, not %s\n", filename, value);
+            exit(1);
+        }
+    }
+
+    if (*width <= 0 || *height <= 0 || (*depth != 3 && *depth != 4)) {
+        fprintf(stderr, "Invalid image size (error loading '%s')\n", filename);
+        exit(1);
+    }
+    if (maxval != RGB_COMPONENT_COLOR) {
+        fprintf(stderr, "'%s' does not have 8-bits components\n", filename);
+        exit(1);
+    }
+}
+
+ppm_image *read_image(const char *filename, unsigned char **const mask) {
+    char  magic[3] = { 0 };
+    FILE *fp       = fopen(filename, "rb");
+
+    *mask = NULL;
+    if (!fp) {
+        fprintf(stderr, "Unable to open file '%s'\n", filename);
+        exit(1);
+    }
+    if (fread(magic, 1, 2, fp) != 2 || strcmp(magic, "P7")) {
+        fclose(fp);
+        return read_ppm(filename);
+    }
+
+    int width, height, depth;
+    read_pam_header(fp, filename, &width, &height, &depth);
+
+    ppm_image *const img = malloc(sizeof(ppm_image));
+    unsigned char *const row = malloc((size_t) width * depth);
+
+    img->x    = width;
+    img->y    = height;
+    img->data = malloc((size_t) width * height * sizeof(ppm_pixel));
+    if (depth == 4) {
+        *mask = malloc((size_t) width * height);
+    }
+
+    for (long r = 0; r < height; ++r) {
+        if (fread(row, depth, width, fp) != (size_t) width) {
+            fprintf(stderr, "Error loading image '%s'\n", filename);
+            exit(1);
+        }
+        for (long c = 0; c < width; ++c) {
+            img->data[r * width + c] = (ppm_pixel) {
+                row[c * depth], row[c * depth + 1], row[c * depth + 2]
+            };
+            if (*mask) {
+                (*mask)[r * width + c] = row[c * depth + 3] != 0;
+            }
+        }
+    }
+
+    free(row);
+    fclose(fp);
+    return img;
+}
+
+// The next number of a PNM header, past whitespace and # comments
+static int read_pnm_number(FILE *const fp, int *const value) {
+    int c;
+
+    while ((c = getc(fp)) == '#' || (c != EOF && strchr(" \t\r\n\v\f", c))) {
+        if (c == '#') {
+            while ((c = getc(fp)) != EOF && c != '\n') {
+            }
+        }
+    }
+    ungetc(c, fp);
+    return fscanf(fp, "%d", value) == 1;
+}
+
+unsigned char *read_mask(const char *filename, const ppm_image *const image) {
+    char  buff[3] = { 0 };
+    int   width, height, maxval;
+    FILE *fp = fopen(filename, "rb");
+
+    if (!fp) {
+        fprintf(stderr, "Unable to open file '%s'\n", filename);
+        exit(1);
+    }
+    if (fread(buff, 1, 2, fp) != 2 || strcmp(buff, "P5")) {
+        fprintf(stderr, "Invalid mask format (must be 'P5')\n");
+        exit(1);
+    }
+    if (!read_pnm_number(fp, &width) || !read_pnm_number(fp, &height)
+        || !read_pnm_number(fp, &maxval) || maxval <= 0 || maxval > 255) {
+        fprintf(stderr, "Invalid mask header (error loading '%s')\n", filename);
+        exit(1);
+    }
+    if (width != image->x || height != image->y) {
+        fprintf(stderr, "The mask is %dx%d, the image %dx%d\n", width, height, image->x, image->y);
+        exit(1);
+    }
+    fgetc(fp);
+
+    unsigned char *const mask = malloc((size_t) width * height);
+
+    if (fread(mask, width, height, fp) != (size_t) height) {
+        fprintf(stderr, "Error loading mask '%s'\n", filename);
+        exit(1);
+    }
+
+    fclose(fp);
+    return mask;
+}
+
+// Runs of pixels with data go to the rescale kernel in one call
+static void mask_rescale_band(ppm_image           *const image,
+                              const unsigned char *const mask,
+                              ppm_image           *const scaled,
+                              unsigned char       *const scaled_mask,
+                              const ppm_pixel      fill,
+                              const long start,
+                              const long end) {
+    long run = start;
+
+    for (long i = start; i < end; ++i) {
+        scaled_mask[i] = mask_support_has_data(image, mask, i);
+        if (!scaled_mask[i]) {
+            if (run < i) {
+                kernels.rescale(image, &scaled->data[run], run, i);
+            }
+            scaled->data[i] = fill;
+            run = i + 1;
+        }
+    }
+    if (run < end) {
+        kernels.rescale(image, &scaled->data[run], run, end);
+    }
+}
+
+void mask_rescale(ppm_image           *const image,
+                  const unsigned char *const mask,
+                  ppm_image           *const scaled,
+                  unsigned char       *const scaled_mask,
+                  const ppm_pixel      fill,
+                  cancel_token        *const cancel,
+                  const long tid,
+                  const long nthreads) {
+    if (image->x <= RESCALE_X && image->y <= RESCALE_Y) {
+        return;
+    }
+
+    scaled->x = RESCALE_X;
+    scaled->y = RESCALE_Y;
+
+    const thread_slice slice = thread_get_slice(tid, nthreads, RESCALE_X * RESCALE_Y);
+    const long         band  = CANCEL_BAND_ROWS * RESCALE_Y;
+
+    for (long start = slice.start; start < slice.end && !cancel_check(cancel); start += band) {
+        mask_rescale_band(image, mask, scaled, scaled_mask, fill, start, MIN(start + band, slice.end));
+    }
+}
+
+void mask_rescale_support(const ppm_image   *const image,
+                          const unsigned char *const mask,
+                          unsigned char       *const scaled_mask,
+                          cancel_token        *const cancel,
+                          const long tid,
+                          const long nthreads) {
+    const thread_slice slice = thread_get_slice(tid, nthreads, RESCALE_X * RESCALE_Y);
+
+    for (long i = slice.start; i < slice.end; ++i) {
+        if ((i - slice.start) % (CANCEL_BAND_ROWS * RESCALE_Y) == 0 && cancel_check(cancel)) {
+            return;
+        }
+        scaled_mask[i] = mask_support_has_data(image, mask, i);
+    }
+}
+
+static void mask_grid_row(unsigned char       *const row,
+                          const ppm_image     *const image,
+                          const unsigned char *const mask,
+                          const long i) {
+    const long q = image->y / STEP;
+
+    for (long j = 0; j <= q; ++j) {
+        if (!mask[grid_sample_offset(image, i, j)]) {
+            row[j] = GRID_NODATA;
+        }
+    }
+}
+
+void mask_grid(unsigned char       **const grid,
+               const ppm_image      *const image,
+               const unsigned char  *const mask,
+               const long tid,
+               const long nthreads) {
+    const long         p     = image->x / STEP;
+    const thread_slice slice = thread_get_slice(tid, nthreads, p);
+
+    for (long i = slice.start; i < slice.end; ++i) {
+        mask_grid_row(grid[i], image, mask, i);
+    }
+
+    // Task reserved for the thread having the last slice of the range
+    if (tid == nthreads - 1) {
+        mask_grid_row(grid[p], image, mask, p);
+    }
+}
+
+static inline void mask_fill_cell(ppm_image *const image,
+                                  const ppm_pixel fill,
+                                  const long x,
+                                  const long y) {
+    for (long i = 0; i < STEP; ++i) {
+        for (long j = 0; j < STEP; ++j) {
+            image->data[(x + i) * image->y + y + j] = fill;
+        }
+    }
+}
+
+void march_masked(ppm_image     *const image,
+                  unsigned char *const *const grid,
+                  ppm_image     *const *const cmap,
+                  const ppm_pixel fill,
+                  cancel_token  *const cancel,
+                  const long     tid,
+                  const long     nthreads) {
+    const long p = image->x / STEP;
+    const long q = image->y / STEP;
+
+    const thread_slice slice = thread_get_slice(tid, nthreads, p);
+
+    for (long i = slice.start; i < slice.end; ++i) {
+        if ((i - slice.start) % (CANCEL_BAND_ROWS / STEP) == 0 && cancel_check(cancel)) {
+            return;
+        }
+
+        // Rows of cells clear of the mask take the regular kernel
+        if (!memchr(grid[i], GRID_NODATA, q + 1) && !memchr(grid[i + 1], GRID_NODATA, q + 1)) {
+            kernels.march_row(image, grid[i], grid[i + 1], cmap, i);
+            continue;
+        }
+
+        for (long j = 0; j < q; ++j) {
+            if (grid[i][j] == GRID_NODATA || grid[i][j + 1] == GRID_NODATA
+                || grid[i + 1][j] == GRID_NODATA || grid[i + 1][j + 1] == GRID_NODATA) {
+                mask_fill_cell(image, fill, i * STEP, j * STEP);
+                continue;
+            }
+
+            const unsigned char k = 8 * grid[i][j]
+                                  + 4 * grid[i][j + 1]
+                                  + 2 * grid[i + 1][j + 1]
+                                  +     grid[i + 1][j];
+            march_update(image, cmap[k], i * STEP, j * STEP);
+        }
+    }
+}
@@ -0,0 +1,85 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef MASK_H
+#define MASK_H
+
+#include "helpers.h"
+#include "cancel.h"
+
+// Grid value of the points sampled where the image has no data. Cells with
+// such a corner are filled instead of marched.
+#define GRID_NODATA 2
+
+// Reads a P6 image, or a P7 (PAM) one with an RGB_ALPHA tuple type. `*mask`
+// receives one byte per pixel, in the order of `data`, nonzero where the
+// alpha is, or NULL if the image has no alpha channel.
+ppm_image *read_image(const char *filename, unsigned char **const mask);
+
+// Reads a P5 (PGM) mask the size of `image`, nonzero where there is data
+unsigned char *read_mask(const char *filename, const ppm_image *const image);
+
+// Whether any of the pixels sample_bicubic() interpolates for pixel `i` of
+// the rescaled image has data
+static inline int mask_support_has_data(const ppm_image     *const image,
+                                        const unsigned char *const mask,
+                                        const long i) {
+    const float u = (float)(i / RESCALE_Y) / (RESCALE_X - 1);
+    const float v = (float)(i % RESCALE_Y) / (RESCALE_Y - 1);
+    const float x = (u * image->x) - 0.5;
+    const float y = (v * image->y) - 0.5;
+
+    for (int dy = -1; dy <= 2; ++dy) {
+        const int py = (int) y + dy < 0 ? 0
+                     : (int) y + dy > image->y - 1 ? image->y - 1 : (int) y + dy;
+
+        for (int dx = -1; dx <= 2; ++dx) {
+            const int px = (int) x + dx < 0 ? 0
+                         : (int) x + dx > image->x - 1 ? image->x - 1 : (int) x + dx;
+
+            if (mask[px + image->x * py]) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+// Rescales pixels [start, end) as rescale_image does, along with the mask
+// of the rescaled image. Pixels interpolated from no data at all aren't
+// computed, they get `fill`.
+void mask_rescale(ppm_image           *const image,
+                  const unsigned char *const mask,
+                  ppm_image           *const scaled,
+                  unsigned char       *const scaled_mask,
+                  const ppm_pixel      fill,
+                  cancel_token        *const cancel,
+                  const long tid,
+                  const long nthreads);
+
+// Only the mask of the rescaled image, for an input rescaled otherwise (a
+// float field): `image` gives the size of the input, its pixels aren't read
+void mask_rescale_support(const ppm_image     *const image,
+                          const unsigned char *const mask,
+                          unsigned char       *const scaled_mask,
+                          cancel_token        *const cancel,
+                          const long tid,
+                          const long nthreads);
+
+// Sets the points of the grid sampled from pixels without data to
+// GRID_NODATA, with the slicing of sample_grid
+void mask_grid(unsigned char       **const grid,
+               const ppm_image      *const image,
+               const unsigned char  *const mask,
+               const long tid,
+               const long nthreads);
+
+// Same as march, but cells with a GRID_NODATA corner are filled with `fill`
+void march_masked(ppm_image     *const image,
+                  unsigned char *const *const grid,
+                  ppm_image     *const *const cmap,
+                  const ppm_pixel fill,
+                  cancel_token  *const cancel,
+                  const long     tid,
+                  const long     nthreads);
+
+#endif
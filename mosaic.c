@@ -0,0 +1,248 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "marching.h"
+#include "mosaic.h"
+
+static void mosaic_invalid(const char *const filename, const char *const what) {
+    fprintf(stderr, "Invalid mosaic manifest '%s': %s\n", filename, what);
+    exit(1);
+}
+
+mosaic *mosaic_open(const char *filename) {
+    FILE *fp = fopen(filename, "r");
+
+    if (!fp) {
+        fprintf(stderr, "Unable to open file '%s'\n", filename);
+        exit(1);
+    }
+
+    mosaic *const m = calloc(1, sizeof(mosaic));
+
+    if (fscanf(fp, " size %ld %ld", &m->width, &m->height) != 2 || m->width <= 0 || m->height <= 0) {
+        mosaic_invalid(filename, "no size");
+    }
+    if (fscanf(fp, " tiles %ld %ld", &m->cols, &m->rows) != 2 || m->cols <= 0 || m->rows <= 0) {
+        mosaic_invalid(filename, "no number of tiles");
+    }
+
+    // Tile files are relative to the directory of the manifest
+    const char *const slash  = strrchr(filename, '/');
+    const int         dirlen = slash ? slash - filename + 1 : 0;
+
+    m->tiles    = calloc(m->rows * m->cols, sizeof(mosaic_tile));
+    m->col_tile = malloc(m->width * sizeof(int));
+    m->row_tile = malloc(m->height * sizeof(int));
+
+    for (long t = 0; t < m->rows * m->cols; ++t) {
+        mosaic_tile *const tile = &m->tiles[t];
+        const long         row  = t / m->cols;
+        const long         col  = t % m->cols;
+        char               name[4096];
+
+        if (fscanf(fp, " %4095s %ld %ld %ld %ld",
+                   name, &tile->x, &tile->y, &tile->width, &tile->height) != 5) {
+            mosaic_invalid(filename, "missing tiles");
+        }
+
+        // The tiles must line up in rows and columns, and cover the image
+        const mosaic_tile *const left  = col ? &m->tiles[t - 1] : NULL;
+        const mosaic_tile *const above = row ? &m->tiles[t - m->cols] : NULL;
+
+        if (tile->x != (left ? left->x + left->width : 0)
+            || tile->y != (above ? above->y + above->height : 0)
+            || (left && tile->height != left->height) || (above && tile->width != above->width)
+            || tile->width <= 0 || tile->height <= 0
+            || tile->x + tile->width > m->width || tile->y + tile->height > m->height
+            || (col == m->cols - 1 && tile->x + tile->width != m->width)
+            || (row == m->rows - 1 && tile->y + tile->height != m->height)) {
+            mosaic_invalid(filename, "the tiles don't form a grid covering the image");
+        }
+
+        tile->filename = malloc(dirlen + strlen(name) + 1);
+        sprintf(tile->filename, "%.*s%s", dirlen, filename, name);
+        pthread_mutex_init(&tile->lock, NULL);
+
+        if (!row) {
+            for (long c = tile->x; c < tile->x + tile->width; ++c) {
+                m->col_tile[c] = col;
+            }
+        }
+        if (!col) {
+            for (long r = tile->y; r < tile->y + tile->height; ++r) {
+                m->row_tile[r] = row;
+            }
+        }
+    }
+
+    fclose(fp);
+    return m;
+}
+
+void mosaic_close(mosaic *const m) {
+    for (long t = 0; t < m->rows * m->cols; ++t) {
+        if (m->tiles[t].data) {
+            munmap(m->tiles[t].base, m->tiles[t].size);
+        }
+        pthread_mutex_destroy(&m->tiles[t].lock);
+        free(m->tiles[t].filename);
+    }
+    free(m->tiles);
+    free(m->col_tile);
+    free(m->row_tile);
+    free(m);
+}
+
+const ppm_pixel *mosaic_load(mosaic_tile *const tile) {
+    pthread_mutex_lock(&tile->lock);
+    if (!tile->data) {
+        const int   fd = open(tile->filename, O_RDONLY);
+        struct stat st;
+
+        if (fd < 0 || fstat(fd, &st)) {
+            fprintf(stderr, "Unable to open file '%s'\n", tile->filename);
+            exit(1);
+        }
+
+        tile->size = st.st_size;
+        tile->base = mmap(NULL, tile->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (tile->base == MAP_FAILED) {
+            perror(tile->filename);
+            exit(1);
+        }
+
+        // The header is short, bounded by the size of the file
+        char header[64] = { 0 };
+        int  width, height, maxval, offset = 0;
+
+        memcpy(header, tile->base, tile->size < sizeof(header) - 1 ? tile->size : sizeof(header) - 1);
+        if (sscanf(header, "P6 %d %d %d%n", &width, &height, &maxval, &offset) != 3
+            || maxval != RGB_COMPONENT_COLOR) {
+            fprintf(stderr, "Invalid image format (must be 'P6', error loading '%s')\n",
+                    tile->filename);
+            exit(1);
+        }
+        if (width != tile->width || height != tile->height
+            || tile->size < offset + 1 + (size_t) width * height * sizeof(ppm_pixel)) {
+            fprintf(stderr, "'%s' is not %ldx%ld as its manifest says\n",
+                    tile->filename, tile->width, tile->height);
+            exit(1);
+        }
+
+        __atomic_store_n(&tile->data, (const ppm_pixel *) ((char *) tile->base + offset + 1),
+                         __ATOMIC_RELEASE);
+    }
+    pthread_mutex_unlock(&tile->lock);
+    return tile->data;
+}
+
+void mosaic_sample_bicubic(const mosaic *const m, const float u, const float v, uint8_t sample[]) {
+    const float x      = (u * m->width) - 0.5;
+    const int   xint   = (int) x;
+    const float xfract = x - floor(x);
+
+    const float y      = (v * m->height) - 0.5;
+    const int   yint   = (int) y;
+    const float yfract = y - floor(y);
+
+    long xs[4], ys[4];
+    for (int d = 0; d < 4; ++d) {
+        xs[d] = xint + d - 1 < 0 ? 0 : xint + d - 1 > m->width - 1 ? m->width - 1 : xint + d - 1;
+        ys[d] = yint + d - 1 < 0 ? 0 : yint + d - 1 > m->height - 1 ? m->height - 1 : yint + d - 1;
+    }
+
+    // p[row][column] of the 4x4 neighborhood, read straight from the tile
+    // when it doesn't straddle two of them
+    ppm_pixel p[4][4];
+    mosaic_tile *const first = &m->tiles[m->row_tile[ys[0]] * m->cols + m->col_tile[xs[0]]];
+
+    if (first == &m->tiles[m->row_tile[ys[3]] * m->cols + m->col_tile[xs[3]]]) {
+        const ppm_pixel *const data = mosaic_tile_data(first);
+
+        for (int r = 0; r < 4; ++r) {
+            for (int c = 0; c < 4; ++c) {
+                p[r][c] = data[(ys[r] - first->y) * first->width + xs[c] - first->x];
+            }
+        }
+    } else {
+        for (int r = 0; r < 4; ++r) {
+            for (int c = 0; c < 4; ++c) {
+                p[r][c] = mosaic_pixel(m, xs[c], ys[r]);
+            }
+        }
+    }
+
+    // interpolate bi-cubically, as sample_bicubic() does
+    for (int i = 0; i < 3; ++i) {
+        float col[4];
+
+        for (int r = 0; r < 4; ++r) {
+            col[r] = cubic_hermite(((uint8_t *) &p[r][0])[i], ((uint8_t *) &p[r][1])[i],
+                                   ((uint8_t *) &p[r][2])[i], ((uint8_t *) &p[r][3])[i], xfract);
+        }
+
+        float value = cubic_hermite(col[0], col[1], col[2], col[3], yfract);
+
+        value     = value < 0.0f ? 0.0f : value > 255.0f ? 255.0f : value;
+        sample[i] = (uint8_t) value;
+    }
+}
+
+static void mosaic_rescale_band(const mosaic *const m,
+                                ppm_image    *const scaled,
+                                const int     rescaled,
+                                const long    start,
+                                const long    end) {
+    if (!rescaled) {
+        // Stitched in the order of the pixels, one span of a tile row at a time
+        for (long i = start; i < end; ) {
+            const long               x    = i % m->width;
+            const long               y    = i / m->width;
+            mosaic_tile       *const tile = &m->tiles[m->row_tile[y] * m->cols + m->col_tile[x]];
+            const long               n    = MIN(tile->x + tile->width - x, end - i);
+
+            memcpy(&scaled->data[i],
+                   &mosaic_tile_data(tile)[(y - tile->y) * tile->width + x - tile->x],
+                   n * sizeof(ppm_pixel));
+            i += n;
+        }
+        return;
+    }
+
+    for (long i = start; i < end; ++i) {
+        uint8_t sample[3];
+
+        mosaic_sample_bicubic(m,
+                              (float)(i / RESCALE_Y) / (RESCALE_X - 1),
+                              (float)(i % RESCALE_Y) / (RESCALE_Y - 1),
+                              sample);
+        scaled->data[i] = *((ppm_pixel *) sample);
+    }
+}
+
+void mosaic_rescale(const mosaic *const m,
+                    ppm_image    *const scaled,
+                    cancel_token *const cancel,
+                    const long tid,
+                    const long nthreads) {
+    const int rescaled = m->width > RESCALE_X || m->height > RESCALE_Y;
+
+    scaled->x = rescaled ? RESCALE_X : m->width;
+    scaled->y = rescaled ? RESCALE_Y : m->height;
+
+    const thread_slice slice = thread_get_slice(tid, nthreads, (long) scaled->x * scaled->y);
+    const long         band  = (long) CANCEL_BAND_ROWS * scaled->y;
+
+    for (long start = slice.start; start < slice.end && !cancel_check(cancel); start += band) {
+        mosaic_rescale_band(m, scaled, rescaled, start, MIN(start + band, slice.end));
+    }
+}
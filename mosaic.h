@@ -0,0 +1,65 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef MOSAIC_H
+#define MOSAIC_H
+
+#include <stddef.h>
+#include <pthread.h>
+
+#include "helpers.h"
+#include "cancel.h"
+
+// One P6 file of a mosaic, mapped the first time one of its pixels is read
+typedef struct {
+    char            *filename;
+    long             x, y;        // offset in the mosaic, in columns and rows
+    long             width, height;
+    const ppm_pixel *data;        // NULL until mapped
+    void            *base;
+    size_t           size;
+    pthread_mutex_t  lock;
+} mosaic_tile;
+
+// An image made of rows x cols tiles, read from a manifest in the format
+// write_tile_manifest() uses: "size W H", "tiles C R", then one line per
+// tile, row by row, giving its file (relative to the manifest), offset and
+// size. Pixels are addressed as in get_pixel_clamped(): x is the column.
+typedef struct {
+    long         width, height;
+    long         cols, rows;
+    mosaic_tile *tiles;
+    int         *col_tile;        // tile column of every column of pixels
+    int         *row_tile;        // tile row of every row of pixels
+} mosaic;
+
+mosaic *mosaic_open(const char *filename);
+void    mosaic_close(mosaic *const m);
+
+// Maps `tile` unless another thread already did
+const ppm_pixel *mosaic_load(mosaic_tile *const tile);
+
+static inline const ppm_pixel *mosaic_tile_data(mosaic_tile *const tile) {
+    const ppm_pixel *const data = __atomic_load_n(&tile->data, __ATOMIC_ACQUIRE);
+
+    return data ? data : mosaic_load(tile);
+}
+
+static inline ppm_pixel mosaic_pixel(const mosaic *const m, const long x, const long y) {
+    mosaic_tile *const tile = &m->tiles[m->row_tile[y] * m->cols + m->col_tile[x]];
+
+    return mosaic_tile_data(tile)[(y - tile->y) * tile->width + x - tile->x];
+}
+
+// Same as sample_bicubic() on the stitched image, to the bit
+void mosaic_sample_bicubic(const mosaic *const m, const float u, const float v, uint8_t sample[]);
+
+// The slice of `scaled` of thread `tid`, as rescale_image computes it, or
+// as the stitched image holds it when it isn't rescaled; either way a band
+// of rows at a time, until `cancel` is cancelled
+void mosaic_rescale(const mosaic *const m,
+                    ppm_image    *const scaled,
+                    cancel_token *const cancel,
+                    const long tid,
+                    const long nthreads);
+
+#endif
@@ -0,0 +1,67 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdlib.h>
+
+#include "marching.h"
+#include "overlay.h"
+
+void overlay_build_masks(overlay_mask *const masks,
+                         ppm_image    *const *const cmap,
+                         const long tid,
+                         const long nthreads) {
+    const thread_slice slice = thread_get_slice(tid, nthreads, CONTOUR_CONFIG_COUNT);
+
+    for (long k = slice.start; k < slice.end; ++k) {
+        const ppm_image *const c = cmap[k];
+
+        masks[k].count   = 0;
+        masks[k].offsets = malloc(c->x * c->y * sizeof(int));
+        masks[k].pixels  = malloc(c->x * c->y * sizeof(ppm_pixel));
+
+        for (int i = 0; i < c->x * c->y; ++i) {
+            if (overlay_is_contour(cmap, c->data[i])) {
+                masks[k].offsets[masks[k].count]  = i;
+                masks[k].pixels[masks[k].count++] = c->data[i];
+            }
+        }
+    }
+}
+
+static inline void overlay_update(ppm_image          *const image,
+                                  const overlay_mask *const mask,
+                                  const int alpha,
+                                  const long x,
+                                  const long y) {
+    for (long n = 0; n < mask->count; ++n) {
+        const long idx_i = (x + mask->offsets[n] / STEP) * image->y + y + mask->offsets[n] % STEP;
+
+        image->data[idx_i] = alpha == 255 ? mask->pixels[n]
+                                          : overlay_blend(image->data[idx_i], mask->pixels[n], alpha);
+    }
+}
+
+void march_overlay(ppm_image          *const image,
+                   unsigned char      *const *const grid,
+                   const overlay_mask *const masks,
+                   const int alpha,
+                   cancel_token       *const cancel,
+                   const long tid,
+                   const long nthreads) {
+    const long p = image->x / STEP;
+    const long q = image->y / STEP;
+
+    const thread_slice slice = thread_get_slice(tid, nthreads, p);
+
+    for (long i = slice.start; i < slice.end; ++i) {
+        if ((i - slice.start) % (CANCEL_BAND_ROWS / STEP) == 0 && cancel_check(cancel)) {
+            return;
+        }
+        for (long j = 0; j < q; ++j) {
+            const unsigned char k = 8 * grid[i][j]
+                                  + 4 * grid[i][j + 1]
+                                  + 2 * grid[i + 1][j + 1]
+                                  +     grid[i + 1][j];
+            overlay_update(image, &masks[k], alpha, i * STEP, j * STEP);
+        }
+    }
+}
@@ -0,0 +1,49 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef OVERLAY_H
+#define OVERLAY_H
+
+#include "helpers.h"
+#include "cancel.h"
+
+// The contour pixels of a tile: those that are neither the outside colour
+// (the first pixel of tile 0) nor the inside colour (of tile 15)
+typedef struct {
+    long       count;
+    int       *offsets;   // i * STEP + j within the tile
+    ppm_pixel *pixels;
+} overlay_mask;
+
+static inline int overlay_is_contour(ppm_image *const *const cmap, const ppm_pixel pix) {
+    const ppm_pixel out = cmap[0]->data[0];
+    const ppm_pixel in  = cmap[CONTOUR_CONFIG_COUNT - 1]->data[0];
+
+    return (pix.red != out.red || pix.green != out.green || pix.blue != out.blue)
+        && (pix.red != in.red  || pix.green != in.green  || pix.blue != in.blue);
+}
+
+// `alpha` of `src` over `dst`, rounded; an alpha of 255 gives `src` back
+static inline ppm_pixel overlay_blend(const ppm_pixel dst, const ppm_pixel src, const int alpha) {
+    return (ppm_pixel) {
+        (alpha * src.red   + (255 - alpha) * dst.red   + 127) / 255,
+        (alpha * src.green + (255 - alpha) * dst.green + 127) / 255,
+        (alpha * src.blue  + (255 - alpha) * dst.blue  + 127) / 255
+    };
+}
+
+void overlay_build_masks(overlay_mask *const masks,
+                         ppm_image    *const *const cmap,
+                         const long tid,
+                         const long nthreads);
+
+// Same as march, but only blends the contour pixels of each tile into the
+// image, leaving everything else as it was
+void march_overlay(ppm_image          *const image,
+                   unsigned char      *const *const grid,
+                   const overlay_mask *const masks,
+                   const int alpha,
+                   cancel_token       *const cancel,
+                   const long tid,
+                   const long nthreads);
+
+#endif
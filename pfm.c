@@ -0,0 +1,178 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "marching.h"
+#include "kernels.h"
+#include "pfm.h"
+
+int pfm_probe(const char *filename) {
+    char  magic[3] = { 0 };
+    FILE *fp       = fopen(filename, "rb");
+
+    if (!fp) {
+        return 0;
+    }
+
+    const int pfm = fread(magic, 1, 2, fp) == 2 && (!strcmp(magic, "Pf") || !strcmp(magic, "PF"));
+
+    fclose(fp);
+    return pfm;
+}
+
+static float pfm_swap(const float value) {
+    uint32_t bits;
+    float    swapped;
+
+    memcpy(&bits, &value, sizeof(bits));
+    bits = __builtin_bswap32(bits);
+    memcpy(&swapped, &bits, sizeof(bits));
+    return swapped;
+}
+
+float_image *read_pfm(const char *filename) {
+    char  magic[3] = { 0 };
+    int   width, height;
+    float scale;
+    FILE *fp = fopen(filename, "rb");
+
+    if (!fp) {
+        fprintf(stderr, "Unable to open file '%s'\n", filename);
+        exit(1);
+    }
+    if (fread(magic, 1, 2, fp) != 2 || (strcmp(magic, "Pf") && strcmp(magic, "PF"))) {
+        fprintf(stderr, "Invalid image format (must be 'Pf' or 'PF')\n");
+        exit(1);
+    }
+    if (fscanf(fp, "%d %d %f", &width, &height, &scale) != 3 || width <= 0 || height <= 0
+        || scale == 0.0f) {
+        fprintf(stderr, "Invalid PFM header (error loading '%s')\n", filename);
+        exit(1);
+    }
+    fgetc(fp);
+
+    // A negative scale means little endian samples
+    const int channels = magic[1] == 'F' ? 3 : 1;
+    const int swap     = (scale < 0) != (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__);
+
+    float_image *const img = malloc(sizeof(float_image));
+    float       *const row = malloc((size_t) width * channels * sizeof(float));
+
+    img->x    = width;
+    img->y    = height;
+    img->data = malloc((size_t) width * height * sizeof(float));
+
+    // Rows are stored from the bottom up
+    for (long r = height - 1; r >= 0; --r) {
+        float *const dst = &img->data[r * width];
+
+        if (fread(row, channels * sizeof(float), width, fp) != (size_t) width) {
+            fprintf(stderr, "Error loading image '%s'\n", filename);
+            exit(1);
+        }
+        for (long c = 0; c < width; ++c) {
+            float value = 0.0f;
+
+            for (int k = 0; k < channels; ++k) {
+                value += swap ? pfm_swap(row[c * channels + k]) : row[c * channels + k];
+            }
+            dst[c] = channels == 1 ? value : value / 3.0f;
+        }
+    }
+
+    free(row);
+    fclose(fp);
+    return img;
+}
+
+static float float_clamped(const float_image *const image, int x, int y) {
+    x = x < 0 ? 0 : x > image->x - 1 ? image->x - 1 : x;
+    y = y < 0 ? 0 : y > image->y - 1 ? image->y - 1 : y;
+    return image->data[x + image->x * y];
+}
+
+float sample_bicubic_float(const float_image *const image, const float u, const float v) {
+    const float x      = (u * image->x) - 0.5;
+    const int   xint   = (int) x;
+    const float xfract = x - floor(x);
+
+    const float y      = (v * image->y) - 0.5;
+    const int   yint   = (int) y;
+    const float yfract = y - floor(y);
+
+    float col[4];
+
+    for (int n = 0; n < 4; ++n) {
+        col[n] = cubic_hermite(float_clamped(image, xint - 1, yint - 1 + n),
+                               float_clamped(image, xint + 0, yint - 1 + n),
+                               float_clamped(image, xint + 1, yint - 1 + n),
+                               float_clamped(image, xint + 2, yint - 1 + n),
+                               xfract);
+    }
+    return cubic_hermite(col[0], col[1], col[2], col[3], yfract);
+}
+
+void rescale_float(const float_image *const image,
+                   float_image       *const scaled,
+                   cancel_token      *const cancel,
+                   const long tid,
+                   const long nthreads) {
+    const thread_slice slice = thread_get_slice(tid, nthreads, RESCALE_X * RESCALE_Y);
+    const long         band  = CANCEL_BAND_ROWS * RESCALE_Y;
+
+    for (long start = slice.start; start < slice.end && !cancel_check(cancel); start += band) {
+        kernels.rescale_float(image, &scaled->data[start], start, MIN(start + band, slice.end));
+    }
+}
+
+static void sample_row_float(unsigned char     *const row,
+                             const float_image *const image,
+                             const float threshold,
+                             const long i) {
+    const ppm_image dims = { .x = image->x, .y = image->y };
+    const long      q    = image->y / STEP;
+
+    for (long j = 0; j <= q; ++j) {
+        row[j] = image->data[grid_sample_offset(&dims, i, j)] <= threshold;
+    }
+}
+
+void sample_grid_float(unsigned char     **const grid,
+                       const float_image  *const image,
+                       const float threshold,
+                       cancel_token       *const cancel,
+                       const long tid,
+                       const long nthreads) {
+    const long         p     = image->x / STEP;
+    const thread_slice slice = thread_get_slice(tid, nthreads, p);
+
+    for (long i = slice.start; i < slice.end; ++i) {
+        if ((i - slice.start) % (CANCEL_BAND_ROWS / STEP) == 0 && cancel_check(cancel)) {
+            return;
+        }
+        sample_row_float(grid[i], image, threshold, i);
+    }
+
+    // Task reserved for the thread having the last slice of the range
+    if (tid == nthreads - 1 && !cancel_check(cancel)) {
+        sample_row_float(grid[p], image, threshold, p);
+    }
+}
+
+void float_render_margin(ppm_image         *const out,
+                         const float_image *const field,
+                         const long tid,
+                         const long nthreads) {
+    const long         covered_rows = field->x / STEP * STEP;
+    const long         covered_cols = field->y / STEP * STEP;
+    const thread_slice slice        = thread_get_slice(tid, nthreads, field->x);
+
+    for (long r = slice.start; r < slice.end; ++r) {
+        for (long c = r < covered_rows ? covered_cols : 0; c < field->y; ++c) {
+            out->data[r * field->y + c] = float_to_pixel(field->data[r * field->y + c]);
+        }
+    }
+}
@@ -0,0 +1,57 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef PFM_H
+#define PFM_H
+
+#include "helpers.h"
+#include "cancel.h"
+
+// A single channel float raster, laid out as ppm_image: x is the width, and
+// the rows are stored top to bottom
+typedef struct {
+    int    x, y;
+    float *data;
+} float_image;
+
+// Whether `filename` starts with the magic of a PFM ("Pf" or "PF")
+int pfm_probe(const char *filename);
+
+// Reads a grayscale (Pf) or colour (PF) PFM, of either endianness. The
+// channels of a colour one are averaged.
+float_image *read_pfm(const char *filename);
+
+// The value sample_bicubic() would interpolate at (u, v), unclamped
+float sample_bicubic_float(const float_image *const image, const float u, const float v);
+
+// Grey level of a value, clamped and truncated as sample_bicubic() does.
+// NaN, which would be undefined to convert, is black.
+static inline ppm_pixel float_to_pixel(float value) {
+    value = value != value || value < 0.0f ? 0.0f : value > 255.0f ? 255.0f : value;
+    return (ppm_pixel) { (unsigned char) value, (unsigned char) value, (unsigned char) value };
+}
+
+// Rescales the field as rescale_image does, band by band, into `scaled`
+// (RESCALE_X x RESCALE_Y values)
+void rescale_float(const float_image *const image,
+                   float_image       *const scaled,
+                   cancel_token      *const cancel,
+                   const long tid,
+                   const long nthreads);
+
+// Same slicing as sample_grid, but a point is inside when its value is at
+// most `threshold`
+void sample_grid_float(unsigned char     **const grid,
+                       const float_image  *const image,
+                       const float threshold,
+                       cancel_token       *const cancel,
+                       const long tid,
+                       const long nthreads);
+
+// Grey levels of the pixels of `field` that no cell covers, the last rows
+// and columns when the sides aren't multiples of STEP, into `out`
+void float_render_margin(ppm_image         *const out,
+                         const float_image *const field,
+                         const long tid,
+                         const long nthreads);
+
+#endif
@@ -0,0 +1,1229 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "helpers.h"
+#include "marching.h"
+#include "sdf.h"
+#include "checkpoint.h"
+#include "tiles.h"
+#include "ppm_map.h"
+#include "rle.h"
+#include "overlay.h"
+#include "smooth.h"
+#include "inplace.h"
+#include "mask.h"
+#include "adaptive.h"
+#include "mosaic.h"
+#include "blocked.h"
+#include "pfm.h"
+#include "textgrid.h"
+#include "pipeline.h"
+
+enum {
+    LOCK_CMAP_ALLOC,
+    LOCK_IMAGE_READ,
+    LOCK_GRID_ALLOC,
+    LOCK_WRITE,
+    LOCK_SDF_WRITE,
+    LOCK_INPLACE_SHRINK,
+    LOCK_TEXT_LAYOUT,
+    NLOCKS
+};
+
+typedef struct {
+    ppm_image        *image;
+    ppm_image        *scaled;
+    ppm_image       **cmap;
+    unsigned char   **grid;
+    grid_rle_row     *rle;
+    overlay_mask     *masks;
+    ppm_image        *smooth_tiles;
+    sdf_field        *sdf;
+    luminance_sat    *sat;
+    mosaic           *mosaic;         // tiles of the input, `image` then has no data
+    blocked_image    *blocks;         // the rescaled image, until unblocked into `scaled`
+    float_image      *field;          // float input, `image` then has no data
+    float_image      *field_scaled;   // the field itself when not rescaled
+    text_grid        *text;           // the text the field is parsed from, if any
+    checkpoint       *ckpt;
+    tile_layout      *tiles;
+    ppm_map          *map;
+    unsigned char    *mask;
+    unsigned char    *scaled_mask;    // the mask itself when not rescaled
+    long              next_tile;
+
+    pthread_mutex_t   locks[NLOCKS];
+
+    const char       *filename_in;
+    const char       *filename_out;
+    const char       *filename_sdf;
+    const char       *filename_checkpoint;
+    const char       *filename_mask;
+    int               is_mosaic;
+    int               tile_size[2];
+    int               mmap_out;
+    int               rle_grid;
+    int               overlay;
+    int               smooth;
+    int               in_place;
+    int               blocked;
+    int               is_float;
+    float             threshold;
+    cancel_token     *cancel;
+    int               partial;
+    int               stopped;        // some work was skipped, the job being cancelled
+    int               rescale_cut;    // and some of the rescale, so there's no partial result
+    long              adaptive_window;
+    long              adaptive_offset;
+    int               masked;         // no-data cells are skipped, if there's a mask
+    int               mask_loaded;    // given by the caller
+    int               input_read;
+    ppm_pixel         nodata;
+    inplace_plan      plan;
+    ppm_pixel        *scratch;
+    long             *waves;          // in-place waves each thread went through
+    int               cmap_loaded;
+
+    long              finished;
+    long              sdf_finished;
+    long              shrunk;
+} thread_data_shared;
+
+static long checkpoint_nbands(const ppm_image *const scaled) {
+    const long p = scaled->x / STEP;
+
+    return p ? (p + CHECKPOINT_BAND_CELLS - 1) / CHECKPOINT_BAND_CELLS : 1;
+}
+
+// Whether the job was cancelled, recording that the caller skips work
+static int worker_stopped(thread_data_shared *const shared) {
+    if (!cancel_check(shared->cancel)) {
+        return 0;
+    }
+    __atomic_store_n(&shared->stopped, 1, __ATOMIC_RELAXED);
+    return 1;
+}
+
+// Whether a cancelled job leaves nothing to return, read after a barrier
+static int worker_discarded(const thread_data_shared *const shared) {
+    return __atomic_load_n(&shared->stopped, __ATOMIC_RELAXED)
+        && (!shared->partial || __atomic_load_n(&shared->rescale_cut, __ATOMIC_RELAXED));
+}
+
+// Reads the input if it isn't in memory, and its mask: the one given, or
+// the alpha channel of the input, or the NODATA_value cells of a text grid.
+// The mask is dropped where it isn't used.
+// Of a mosaic, only the manifest is read; its tiles are read when needed.
+static void read_input(thread_data_shared *const shared) {
+    unsigned char *alpha = NULL;
+
+    if (shared->input_read) {
+        return;
+    }
+    shared->input_read = 1;
+
+    if (shared->is_mosaic) {
+        shared->mosaic      = mosaic_open(shared->filename_in);
+        shared->image       = malloc(sizeof(ppm_image));
+        shared->image->x    = shared->mosaic->width;
+        shared->image->y    = shared->mosaic->height;
+        shared->image->data = NULL;
+    } else if (shared->is_float) {
+        if (!shared->field) {
+            shared->field = shared->text ? shared->text->field : read_pfm(shared->filename_in);
+        }
+        if (shared->text) {
+            alpha              = shared->text->mask;
+            shared->text->mask = NULL;
+        }
+        shared->image       = malloc(sizeof(ppm_image));
+        shared->image->x    = shared->field->x;
+        shared->image->y    = shared->field->y;
+        shared->image->data = NULL;
+    } else if (!shared->image) {
+        shared->image = read_image(shared->filename_in, &alpha);
+    }
+    if (!shared->masked) {
+        free(alpha);
+        shared->mask = NULL;
+    } else if (shared->filename_mask) {
+        free(alpha);
+        shared->mask        = read_mask(shared->filename_mask, shared->image);
+        shared->mask_loaded = 0;
+    } else if (!shared->mask) {
+        shared->mask        = alpha;
+        shared->mask_loaded = 0;
+    } else {
+        free(alpha);
+    }
+}
+
+static void worker_text_count(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+
+    text_grid_count(shared->text, tid, nthreads);
+}
+
+// The field is sized by the first thread through, once every share of the
+// text is counted
+static void worker_text_parse(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+
+    pthread_mutex_lock(&shared->locks[LOCK_TEXT_LAYOUT]);
+    if (!shared->text->laid_out) {
+        text_grid_layout(shared->text);
+    }
+    pthread_mutex_unlock(&shared->locks[LOCK_TEXT_LAYOUT]);
+
+    if (worker_stopped(shared)) {
+        __atomic_store_n(&shared->rescale_cut, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    text_grid_parse(shared->text, tid, nthreads);
+}
+
+static void worker_alloc(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+    (void) tid;
+    (void) nthreads;
+
+    pthread_mutex_lock(&shared->locks[LOCK_IMAGE_READ]);
+    if (!shared->scaled) {
+        read_input(shared);
+        if (shared->filename_checkpoint || shared->tile_size[0]) {
+            // Regions are rescaled on demand, only the size is needed upfront
+            const int rescaled = shared->image->x > RESCALE_X || shared->image->y > RESCALE_Y;
+
+            shared->scaled       = malloc(sizeof(ppm_image));
+            shared->scaled->x    = rescaled ? RESCALE_X : shared->image->x;
+            shared->scaled->y    = rescaled ? RESCALE_Y : shared->image->y;
+            shared->scaled->data = NULL;
+            if (shared->filename_checkpoint) {
+                shared->ckpt = checkpoint_open(shared->filename_checkpoint,
+                                               shared->filename_in,
+                                               shared->filename_out,
+                                               shared->scaled->x,
+                                               shared->scaled->y,
+                                               checkpoint_nbands(shared->scaled));
+            } else {
+                shared->tiles = tile_layout_create(shared->filename_out,
+                                                   shared->scaled->x,
+                                                   shared->scaled->y,
+                                                   shared->tile_size[1],
+                                                   shared->tile_size[0]);
+            }
+        } else if (shared->mmap_out) {
+            // Rescaled straight into the output file, or copied there first
+            const int rescaled = shared->image->x > RESCALE_X || shared->image->y > RESCALE_Y;
+
+            shared->map    = map_ppm(shared->filename_out,
+                                     rescaled ? RESCALE_X : shared->image->x,
+                                     rescaled ? RESCALE_Y : shared->image->y);
+            shared->scaled = &shared->map->image;
+        } else if (shared->mosaic && shared->image->x <= RESCALE_X && shared->image->y <= RESCALE_Y) {
+            // Stitched by the rescale phase
+            shared->scaled       = malloc(sizeof(ppm_image));
+            shared->scaled->x    = shared->image->x;
+            shared->scaled->y    = shared->image->y;
+            shared->scaled->data = malloc((long) shared->image->x * shared->image->y * sizeof(ppm_pixel));
+        } else if (shared->field) {
+            // Grey levels of the field go where no cell is marched
+            const int rescaled = shared->image->x > RESCALE_X || shared->image->y > RESCALE_Y;
+
+            shared->scaled       = malloc(sizeof(ppm_image));
+            shared->scaled->x    = rescaled ? RESCALE_X : shared->image->x;
+            shared->scaled->y    = rescaled ? RESCALE_Y : shared->image->y;
+            shared->scaled->data = malloc((long) shared->scaled->x * shared->scaled->y * sizeof(ppm_pixel));
+        } else if (shared->image->x <= RESCALE_X && shared->image->y <= RESCALE_Y) {
+            shared->scaled = shared->image;
+        } else {
+            // Sized upfront too, should the job be cancelled before the rescale
+            shared->scaled       = malloc(sizeof(ppm_image));
+            shared->scaled->x    = RESCALE_X;
+            shared->scaled->y    = RESCALE_Y;
+            shared->scaled->data = malloc(RESCALE_X * RESCALE_Y * sizeof(ppm_pixel));
+        }
+        if (shared->mask) {
+            const int rescaled = shared->image->x > RESCALE_X || shared->image->y > RESCALE_Y;
+
+            shared->scaled_mask = rescaled ? malloc(RESCALE_X * RESCALE_Y) : shared->mask;
+        }
+        if (shared->field) {
+            const int rescaled = shared->image->x > RESCALE_X || shared->image->y > RESCALE_Y;
+
+            shared->field_scaled = shared->field;
+            if (rescaled) {
+                shared->field_scaled       = malloc(sizeof(float_image));
+                shared->field_scaled->x    = RESCALE_X;
+                shared->field_scaled->y    = RESCALE_Y;
+                shared->field_scaled->data = malloc(RESCALE_X * RESCALE_Y * sizeof(float));
+            }
+        }
+        // Only the rescale fills the blocks, smaller images stay as they are
+        if (shared->blocked && !shared->mask && !shared->mosaic
+            && (shared->image->x > RESCALE_X || shared->image->y > RESCALE_Y)
+            && blocked_fits(RESCALE_X, RESCALE_Y)) {
+            shared->blocks = blocked_alloc(RESCALE_X, RESCALE_Y);
+        }
+    }
+    pthread_mutex_unlock(&shared->locks[LOCK_IMAGE_READ]);
+    pthread_mutex_lock(&shared->locks[LOCK_CMAP_ALLOC]);
+    if (!shared->cmap) {
+        shared->cmap = malloc(CONTOUR_CONFIG_COUNT * sizeof(ppm_image *));
+    }
+    pthread_mutex_unlock(&shared->locks[LOCK_CMAP_ALLOC]);
+}
+
+static void rescale_slice(thread_data_shared *const shared, const long tid, const long nthreads) {
+    const ppm_image *const image = shared->image;
+
+    if (shared->mosaic) {
+        mosaic_rescale(shared->mosaic, shared->scaled, shared->cancel, tid, nthreads);
+        return;
+    }
+
+    // Only a field that isn't rescaled leaves pixels no cell covers
+    _Static_assert(RESCALE_X % STEP == 0 && RESCALE_Y % STEP == 0, "cells cover the rescaled image");
+    if (shared->field) {
+        if (shared->field_scaled != shared->field) {
+            rescale_float(shared->field, shared->field_scaled, shared->cancel, tid, nthreads);
+            if (shared->mask) {
+                mask_rescale_support(image, shared->mask, shared->scaled_mask, shared->cancel,
+                                     tid, nthreads);
+            }
+        } else {
+            float_render_margin(shared->scaled, shared->field, tid, nthreads);
+        }
+        return;
+    }
+
+    // Images that aren't rescaled are marched in place, unless the output
+    // lives somewhere else
+    if (image->x <= RESCALE_X && image->y <= RESCALE_Y && shared->scaled != image) {
+        const thread_slice slice = thread_get_slice(tid, nthreads, (long) image->x * image->y);
+
+        memcpy(&shared->scaled->data[slice.start], &image->data[slice.start],
+               (slice.end - slice.start) * sizeof(ppm_pixel));
+        return;
+    }
+
+    if (shared->blocks) {
+        shared->scaled->x = RESCALE_X;
+        shared->scaled->y = RESCALE_Y;
+        blocked_rescale(shared->image, shared->blocks, shared->cancel, tid, nthreads);
+    } else if (shared->mask) {
+        mask_rescale(shared->image, shared->mask, shared->scaled, shared->scaled_mask,
+                     shared->nodata, shared->cancel, tid, nthreads);
+    } else {
+        rescale_image(shared->image, shared->scaled, shared->cancel, tid, nthreads);
+    }
+}
+
+// Whatever the thread left of its slice, should the job be cancelled, is
+// left out of a partial result
+static void worker_rescale(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+
+    if (!worker_stopped(shared)) {
+        rescale_slice(shared, tid, nthreads);
+    }
+    if (worker_stopped(shared)) {
+        __atomic_store_n(&shared->rescale_cut, 1, __ATOMIC_RELAXED);
+    }
+}
+
+// Once cancelled, the input is neither the input nor the output anymore
+static void worker_inplace_rescale(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+
+    if (worker_stopped(shared)) {
+        __atomic_store_n(&shared->rescale_cut, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    inplace_rescale_wave(shared->image, &shared->plan, shared->scratch,
+                         shared->waves[tid], tid, nthreads);
+}
+
+static void worker_inplace_flush(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+
+    if (worker_stopped(shared)) {
+        __atomic_store_n(&shared->rescale_cut, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    inplace_flush_wave(shared->image, &shared->plan, shared->scratch,
+                       shared->waves[tid]++, tid, nthreads);
+}
+
+static void worker_inplace_shrink(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+    (void) tid;
+    (void) nthreads;
+
+    pthread_mutex_lock(&shared->locks[LOCK_INPLACE_SHRINK]);
+    if (!shared->shrunk) {
+        shared->shrunk = 1;
+        inplace_shrink(shared->image);
+    }
+    pthread_mutex_unlock(&shared->locks[LOCK_INPLACE_SHRINK]);
+}
+
+static void worker_inplace_transpose(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+
+    if (worker_stopped(shared)) {
+        __atomic_store_n(&shared->rescale_cut, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    inplace_transpose(shared->image, tid, nthreads);
+}
+
+static void worker_grid_alloc(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+
+    pthread_mutex_lock(&shared->locks[LOCK_GRID_ALLOC]);
+    if (!shared->grid && !shared->rle) {
+        if (shared->rle_grid) {
+            // Zeroed, for the rows a cancelled job never samples
+            shared->rle = calloc(shared->scaled->x / STEP + 1, sizeof(grid_rle_row));
+        } else {
+            // One block, so that it can be handed out whole
+            const long p = shared->scaled->x / STEP;
+            const long q = shared->scaled->y / STEP;
+
+            shared->grid    = malloc((p + 1) * sizeof(unsigned char *));
+            shared->grid[0] = malloc((p + 1) * (q + 1));
+            for (long i = 1; i <= p; ++i) {
+                shared->grid[i] = shared->grid[0] + i * (q + 1);
+            }
+        }
+        if (shared->overlay) {
+            shared->masks = calloc(CONTOUR_CONFIG_COUNT, sizeof(overlay_mask));
+        }
+        if (shared->smooth) {
+            shared->smooth_tiles = calloc(CONTOUR_CONFIG_COUNT * SMOOTH_VARIANTS, sizeof(ppm_image));
+        }
+        if (shared->adaptive_window) {
+            shared->sat = sat_alloc(shared->scaled->x, shared->scaled->y);
+        }
+        if (shared->filename_sdf) {
+            shared->sdf = sdf_alloc(shared->scaled->x / STEP + 1,
+                                    shared->scaled->y / STEP + 1);
+        }
+    }
+    pthread_mutex_unlock(&shared->locks[LOCK_GRID_ALLOC]);
+    if (!shared->cmap_loaded) {
+        init_cmap(shared->cmap, tid, nthreads);
+    }
+    if (shared->sat && !worker_stopped(shared)) {
+        sat_rows(shared->sat, shared->scaled, tid, nthreads);
+    }
+}
+
+static void worker_sat_columns(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+
+    if (worker_stopped(shared)) {
+        return;
+    }
+    sat_columns(shared->sat, tid, nthreads);
+}
+
+static void worker_sample_grid(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+
+    // Nothing is marched after a cancellation, so neither are the tiles needed
+    if (worker_stopped(shared)) {
+        return;
+    }
+
+    if (shared->rle) {
+        sample_grid_rle(shared->rle, shared->scaled, shared->cancel, tid, nthreads);
+    } else if (shared->smooth) {
+        sample_grid_luminance(shared->grid, shared->scaled, shared->cancel, tid, nthreads);
+    } else {
+        if (shared->sat) {
+            sample_grid_adaptive(shared->grid, shared->scaled, shared->sat,
+                                 shared->adaptive_window, shared->adaptive_offset,
+                                 shared->cancel, tid, nthreads);
+        } else if (shared->field_scaled) {
+            sample_grid_float(shared->grid, shared->field_scaled, shared->threshold,
+                              shared->cancel, tid, nthreads);
+        } else if (shared->blocks) {
+            blocked_sample_grid(shared->grid, shared->blocks, shared->cancel, tid, nthreads);
+        } else {
+            sample_grid(shared->grid, shared->scaled, shared->cancel, tid, nthreads);
+        }
+        if (shared->scaled_mask) {
+            mask_grid(shared->grid, shared->scaled, shared->scaled_mask, tid, nthreads);
+        }
+    }
+
+    // The tiles are all loaded by now
+    if (shared->masks) {
+        overlay_build_masks(shared->masks, shared->cmap, tid, nthreads);
+    }
+    if (shared->smooth_tiles) {
+        smooth_render_tiles(shared->smooth_tiles, shared->cmap, tid, nthreads);
+    }
+}
+
+static void worker_sdf_rows(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+
+    if (worker_stopped(shared)) {
+        return;
+    }
+    sdf_transform_rows(shared->sdf, shared->grid, tid, nthreads);
+}
+
+static void worker_sdf_columns(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+
+    if (worker_stopped(shared)) {
+        return;
+    }
+    sdf_transform_columns(shared->sdf, tid, nthreads);
+}
+
+static void worker_march(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+
+    if (worker_stopped(shared)) {
+        return;
+    }
+
+    // The distance field is complete, whoever gets here first writes it
+    // while the others start marching
+    if (shared->filename_sdf) {
+        pthread_mutex_lock(&shared->locks[LOCK_SDF_WRITE]);
+        if (!shared->sdf_finished) {
+            shared->sdf_finished = 1;
+            write_sdf(shared->sdf, shared->filename_sdf);
+        }
+        pthread_mutex_unlock(&shared->locks[LOCK_SDF_WRITE]);
+    }
+
+    if (shared->rle) {
+        march_rle(shared->scaled, shared->rle, shared->cmap, shared->cancel, tid, nthreads);
+    } else if (shared->smooth_tiles) {
+        march_smooth(shared->scaled, shared->grid, shared->smooth_tiles, shared->cancel,
+                     tid, nthreads);
+    } else if (shared->masks) {
+        march_overlay(shared->scaled, shared->grid, shared->masks, shared->overlay, shared->cancel,
+                      tid, nthreads);
+    } else if (shared->scaled_mask) {
+        march_masked(shared->scaled, shared->grid, shared->cmap, shared->nodata, shared->cancel,
+                     tid, nthreads);
+    } else if (shared->blocks) {
+        blocked_march(shared->blocks, shared->grid, shared->cmap, shared->cancel, tid, nthreads);
+    } else {
+        march(shared->scaled, shared->grid, shared->cmap, shared->cancel, tid, nthreads);
+    }
+    worker_stopped(shared);
+}
+
+// Into the output buffer, or straight into the output file when it's mapped
+static void worker_unblock(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+
+    if (shared->blocks && !worker_discarded(shared)) {
+        blocked_unblock(shared->blocks, shared->scaled, tid, nthreads);
+    }
+}
+
+static void worker_write(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+    (void) tid;
+    (void) nthreads;
+
+    pthread_mutex_lock(&shared->locks[LOCK_WRITE]);
+    if (!shared->finished) {
+        shared->finished = 1;
+        if (shared->filename_out && !worker_discarded(shared)) {
+            write_ppm(shared->scaled, shared->filename_out);
+        }
+    }
+    pthread_mutex_unlock(&shared->locks[LOCK_WRITE]);
+}
+
+// Pixel (row, col) of the rescaled image, as rescale_image computes it
+static ppm_pixel scaled_pixel(const thread_data_shared *const shared,
+                              const long row,
+                              const long col) {
+    const long i = row * shared->image->y + col;
+
+    if (shared->image->x <= RESCALE_X && shared->image->y <= RESCALE_Y) {
+        return shared->mosaic ? mosaic_pixel(shared->mosaic, i % shared->image->x, i / shared->image->x)
+                              : shared->image->data[i];
+    }
+
+    uint8_t sample[3];
+
+    if (shared->mosaic) {
+        mosaic_sample_bicubic(shared->mosaic,
+                              (float) row / (RESCALE_X - 1),
+                              (float) col / (RESCALE_Y - 1),
+                              sample);
+    } else {
+        sample_bicubic(shared->image,
+                       (float) row / (RESCALE_X - 1),
+                       (float) col / (RESCALE_Y - 1),
+                       sample);
+    }
+    return *((ppm_pixel *) sample);
+}
+
+// Rescales, samples and marches cells [g0, g1) x [h0, h1) of the output into
+// `region`, without the rest of the image. Regions touching the bottom or
+// right edge also hold the pixels left over past the last cells. `grid` needs
+// room for (g1 - g0 + 1) x (h1 - h0 + 1) grid points.
+static void render_region(const thread_data_shared *const shared,
+                          ppm_image     *const region,
+                          unsigned char *const grid,
+                          const long g0, const long g1,
+                          const long h0, const long h1) {
+    const ppm_image *const scaled = shared->scaled;
+
+    const long r0 = g0 * STEP;
+    const long r1 = g1 == scaled->x / STEP ? scaled->x : g1 * STEP;
+    const long c0 = h0 * STEP;
+    const long c1 = h1 == scaled->y / STEP ? scaled->y : h1 * STEP;
+    const long w  = h1 - h0 + 1;
+
+    region->x = r1 - r0;
+    region->y = c1 - c0;
+    for (long r = r0; r < r1; ++r) {
+        for (long c = c0; c < c1; ++c) {
+            region->data[(r - r0) * region->y + c - c0] = scaled_pixel(shared, r, c);
+        }
+    }
+
+    // The bottom and right grid points may lie outside of the region
+    for (long i = g0; i <= g1; ++i) {
+        for (long j = h0; j <= h1; ++j) {
+            const long      offset = grid_sample_offset(scaled, i, j);
+            const long      row    = offset / scaled->y;
+            const long      col    = offset % scaled->y;
+            const ppm_pixel pix    = row < r1 && col < c1
+                                   ? region->data[(row - r0) * region->y + col - c0]
+                                   : scaled_pixel(shared, row, col);
+
+            grid[(i - g0) * w + j - h0] = pixel_luminance(pix) <= SIGMA;
+        }
+    }
+
+    for (long i = 0; i < g1 - g0; ++i) {
+        for (long j = 0; j < h1 - h0; ++j) {
+            const unsigned char k = 8 * grid[i * w + j]
+                                  + 4 * grid[i * w + j + 1]
+                                  + 2 * grid[(i + 1) * w + j + 1]
+                                  +     grid[(i + 1) * w + j];
+            march_update(region, shared->cmap[k], i * STEP, j * STEP);
+        }
+    }
+}
+
+// Each band of output rows is rendered from scratch, so that bands finished
+// by an earlier run can be skipped entirely
+static void worker_checkpoint_bands(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+    const ppm_image    *const scaled = shared->scaled;
+    checkpoint         *const ckpt   = shared->ckpt;
+
+    const long         p     = scaled->x / STEP;
+    const long         q     = scaled->y / STEP;
+    const thread_slice slice = thread_get_slice(tid, nthreads, ckpt->nbands);
+
+    ppm_image band = {
+        .data = malloc((CHECKPOINT_BAND_CELLS + 1) * STEP * scaled->y * sizeof(ppm_pixel))
+    };
+    unsigned char *const grid = malloc((CHECKPOINT_BAND_CELLS + 1) * (q + 1));
+
+    for (long b = slice.start; b < slice.end && !worker_stopped(shared); ++b) {
+        if (ckpt->done[b]) {
+            continue;
+        }
+
+        const long g0 = b * CHECKPOINT_BAND_CELLS;
+        const long g1 = MIN(g0 + CHECKPOINT_BAND_CELLS, p);
+
+        render_region(shared, &band, grid, g0, g1, 0, q);
+        checkpoint_write_band(ckpt, b, g0 * STEP, band.x, band.data);
+    }
+
+    free(band.data);
+    free(grid);
+}
+
+// Rows of tiles are handed out one at a time, so the threads done first pick
+// up the remaining ones. A row of tiles is a span of the output's pixels,
+// rendered as the bands of cells covering it and then cut into its tiles.
+static void worker_tiles(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+    const tile_layout  *const layout = shared->tiles;
+    const ppm_image    *const scaled = shared->scaled;
+    (void) tid;
+    (void) nthreads;
+
+    const long p = scaled->x / STEP;
+    const long q = scaled->y / STEP;
+
+    // The last row of tiles is the tallest, and its span may start and end
+    // inside a band of cells
+    const long max_span = (layout->tile_y + STEP) * layout->x;
+    const long max_rows = MIN(scaled->x, max_span / scaled->y + 3 * STEP);
+
+    ppm_image band = {
+        .data = malloc(max_rows * scaled->y * sizeof(ppm_pixel))
+    };
+    unsigned char *const grid = malloc((max_rows / STEP + 3) * (q + 1));
+    long row;
+
+    while (!worker_stopped(shared)
+           && (row = __atomic_fetch_add(&shared->next_tile, 1, __ATOMIC_RELAXED)) < layout->rows) {
+        long start, end;
+
+        tile_row_span(layout, row, &start, &end);
+
+        const long g0 = MIN(start / scaled->y / STEP, p);
+        const long g1 = MIN(((end + scaled->y - 1) / scaled->y + STEP - 1) / STEP, p);
+
+        render_region(shared, &band, grid, g0, g1, 0, q);
+        write_tile_row(layout, row, band.data, g0 * STEP * scaled->y);
+    }
+
+    free(band.data);
+    free(grid);
+}
+
+static void worker_tiles_manifest(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+    (void) tid;
+    (void) nthreads;
+
+    pthread_mutex_lock(&shared->locks[LOCK_WRITE]);
+    if (!shared->finished) {
+        shared->finished = 1;
+        if (!worker_discarded(shared)) {
+            write_tile_manifest(shared->tiles);
+        }
+    }
+    pthread_mutex_unlock(&shared->locks[LOCK_WRITE]);
+}
+
+static void worker_checkpoint_close(void *ctx, const long tid, const long nthreads) {
+    thread_data_shared *const shared = ctx;
+    (void) tid;
+    (void) nthreads;
+
+    pthread_mutex_lock(&shared->locks[LOCK_WRITE]);
+    if (!shared->finished) {
+        shared->finished = 1;
+        if (worker_discarded(shared)) {
+            checkpoint_suspend(shared->ckpt);
+        } else {
+            checkpoint_close(shared->ckpt);
+        }
+        shared->ckpt = NULL;
+    }
+    pthread_mutex_unlock(&shared->locks[LOCK_WRITE]);
+}
+
+// Frees what the phases allocated, short of the returned image
+static void pipeline_free(thread_data_shared *const shared, const pipeline_job *const job) {
+    const long p = shared->scaled->x / STEP;
+
+    if (shared->grid) {
+        free(shared->grid[0]);
+        free(shared->grid);
+    }
+    if (shared->rle) {
+        for (long i = 0; i <= p; ++i) {
+            free(shared->rle[i].ends);
+        }
+        free(shared->rle);
+    }
+    if (shared->masks) {
+        for (long k = 0; k < CONTOUR_CONFIG_COUNT; ++k) {
+            free(shared->masks[k].offsets);
+            free(shared->masks[k].pixels);
+        }
+        free(shared->masks);
+    }
+    if (shared->smooth_tiles) {
+        for (long v = 0; v < CONTOUR_CONFIG_COUNT * SMOOTH_VARIANTS; ++v) {
+            free(shared->smooth_tiles[v].data);
+        }
+        free(shared->smooth_tiles);
+    }
+    if (shared->sdf) {
+        free(shared->sdf->inside);
+        free(shared->sdf->outside);
+        free(shared->sdf);
+    }
+    if (!shared->cmap_loaded) {
+        for (long k = 0; k < CONTOUR_CONFIG_COUNT; ++k) {
+            free(shared->cmap[k]->data);
+            free(shared->cmap[k]);
+        }
+        free(shared->cmap);
+    }
+    if (shared->sat) {
+        sat_free(shared->sat);
+    }
+    if (shared->mosaic) {
+        mosaic_close(shared->mosaic);
+    }
+    if (shared->tiles) {
+        tile_layout_free(shared->tiles);
+    }
+    if (shared->text) {
+        text_grid_close(shared->text);
+    }
+    if (shared->blocks) {
+        blocked_free(shared->blocks);
+    }
+    if (shared->field_scaled != shared->field) {
+        free(shared->field_scaled->data);
+        free(shared->field_scaled);
+    }
+    if (shared->field && !job->field) {
+        free(shared->field->data);
+        free(shared->field);
+    }
+    if (shared->scaled_mask != shared->mask) {
+        free(shared->scaled_mask);
+    }
+    if (!shared->mask_loaded) {
+        free(shared->mask);
+    }
+    if (!job->image && shared->image != shared->scaled) {
+        free(shared->image->data);
+        free(shared->image);
+    }
+    free(shared);
+}
+
+// Whether the no-data cells can be skipped, with a mask given or the alpha
+// channel of the input; the alpha channel is ignored where they can't
+static int pipeline_maskable(const pipeline_job *const job) {
+    return !job->mosaic && !job->filename_checkpoint && !job->tile_size[0] && !job->rle_grid
+        && !job->overlay && !job->smooth && !job->filename_sdf;
+}
+
+// Whether the input is a float field: given, or read from a PFM or a text
+// raster
+static int pipeline_float_input(const pipeline_job *const job) {
+    return job->field || (!job->image && !job->mosaic && job->filename_in
+                          && (pfm_probe(job->filename_in) || text_grid_probe(job->filename_in)));
+}
+
+const char *pipeline_check(const pipeline_job *const job) {
+    const int masked = job->filename_mask || job->mask;
+
+    if (!!job->filename_checkpoint + !!job->tile_size[0] + !!job->mmap_out > 1) {
+        return "Only one of --checkpoint, --tiles and --mmap-out can be used";
+    }
+    if ((job->filename_checkpoint || job->tile_size[0] || job->mmap_out) && !job->filename_out) {
+        return "--checkpoint, --tiles and --mmap-out need an output file";
+    }
+    if ((job->filename_checkpoint || job->tile_size[0]) && job->filename_sdf) {
+        return "--sdf needs the whole grid, it can't be used with --checkpoint or --tiles";
+    }
+    if ((job->filename_checkpoint || job->tile_size[0]) && job->partial) {
+        return "--partial can't be used with --checkpoint or --tiles";
+    }
+    if (job->rle_grid && (job->filename_checkpoint || job->tile_size[0] || job->filename_sdf)) {
+        return "--rle-grid can't be used with --checkpoint, --tiles or --sdf";
+    }
+    if (job->overlay && (job->filename_checkpoint || job->tile_size[0] || job->rle_grid)) {
+        return "--overlay can't be used with --checkpoint, --tiles or --rle-grid";
+    }
+    if (job->smooth && (job->filename_checkpoint || job->tile_size[0] || job->rle_grid
+                        || job->overlay || job->filename_sdf)) {
+        return "--smooth can't be used with --checkpoint, --tiles, --rle-grid, --overlay or --sdf";
+    }
+    if (job->in_place && (job->filename_checkpoint || job->tile_size[0] || job->mmap_out)) {
+        return "--in-place can't be used with --checkpoint, --tiles or --mmap-out";
+    }
+    if (job->adaptive_window && (job->filename_checkpoint || job->tile_size[0] || job->rle_grid
+                                 || job->smooth)) {
+        return "--adaptive can't be used with --checkpoint, --tiles, --rle-grid or --smooth";
+    }
+    if (masked && !pipeline_maskable(job)) {
+        return "--mask can't be used with --checkpoint, --tiles, --rle-grid, --overlay, "
+               "--smooth, --sdf or --mosaic";
+    }
+    if (job->blocked && (job->filename_checkpoint || job->tile_size[0] || job->rle_grid
+                         || job->overlay || job->smooth || job->in_place || job->adaptive_window
+                         || masked || job->mosaic)) {
+        return "--blocked can't be used with --checkpoint, --tiles, --rle-grid, --overlay, "
+               "--smooth, --in-place, --adaptive, --mask or --mosaic";
+    }
+    if (job->mosaic && (job->in_place || job->image || job->field || !job->filename_in)) {
+        return "--mosaic reads its tiles from the manifest in <in>, it can't be used with "
+               "--in-place or an input in memory";
+    }
+    // Float inputs only go through the plain and masked phases, with the
+    // distance field and the mapped output
+    if ((job->filename_checkpoint || job->tile_size[0] || job->rle_grid || job->overlay
+         || job->smooth || job->in_place || job->blocked || job->adaptive_window)
+        && pipeline_float_input(job)) {
+        return "A float input can only be used with --sdf, --mmap-out, --mask and --threshold";
+    }
+    return NULL;
+}
+
+ppm_image *pipeline_run(const pipeline_job *const job) {
+    const char *const error = pipeline_check(job);
+
+    if (error) {
+        fprintf(stderr, "%s\n", error);
+        return NULL;
+    }
+
+    thread_data_shared *shared = calloc(1, sizeof(*shared));
+
+    const int is_pfm            = !job->field && !job->image && !job->mosaic && job->filename_in
+                               && pfm_probe(job->filename_in);
+    const int is_text           = !job->field && !job->image && !job->mosaic && job->filename_in
+                               && !is_pfm && text_grid_probe(job->filename_in);
+
+    shared->is_float            = job->field || is_pfm || is_text;
+    shared->field               = job->field;
+    shared->threshold           = job->threshold;
+    shared->cancel              = job->cancel;
+    shared->partial             = job->partial;
+    shared->filename_in         = job->filename_in;
+    shared->filename_out        = job->filename_out;
+    shared->filename_sdf        = job->filename_sdf;
+    shared->filename_checkpoint = job->filename_checkpoint;
+    shared->tile_size[0]        = job->tile_size[0];
+    shared->tile_size[1]        = job->tile_size[1];
+    shared->mmap_out            = job->mmap_out;
+    shared->rle_grid            = job->rle_grid;
+    shared->overlay             = job->overlay;
+    shared->smooth              = job->smooth;
+    shared->adaptive_window     = job->adaptive_window;
+    shared->adaptive_offset     = job->adaptive_offset;
+    shared->is_mosaic           = job->mosaic;
+    shared->blocked             = job->blocked;
+    shared->masked              = pipeline_maskable(job);
+    shared->filename_mask       = job->filename_mask;
+    shared->mask                = job->mask;
+    shared->mask_loaded         = job->mask != NULL;
+    shared->nodata              = job->nodata;
+    shared->image               = job->image;
+    shared->cmap                = job->cmap;
+    shared->cmap_loaded         = job->cmap != NULL;
+    shared->text                = is_text ? text_grid_open(job->filename_in, job->nthreads) : NULL;
+
+    // The waves of an in-place rescale depend on the size of the input, so
+    // it is read right away
+    if (job->in_place) {
+        read_input(shared);
+        if (shared->image->x > RESCALE_X || shared->image->y > RESCALE_Y) {
+            shared->in_place = !shared->mask && inplace_plan_create(shared->image, &shared->plan);
+            if (shared->mask) {
+                fprintf(stderr, "in-place: masked inputs are rescaled into a new buffer\n");
+            } else if (!shared->in_place) {
+                fprintf(stderr, "in-place: the output doesn't fit in the input, "
+                                "rescaling into a new buffer\n");
+            }
+        }
+    }
+    if (shared->in_place) {
+        shared->scaled  = shared->image;
+        shared->scratch = malloc(shared->plan.blocks * RESCALE_X * sizeof(ppm_pixel));
+        shared->waves   = calloc(job->nthreads, sizeof(long));
+    }
+
+    phase_fn *const phases  = malloc((15 + 2 * shared->plan.nwaves) * sizeof(phase_fn));
+    long            nphases = 0;
+
+    if (shared->text) {
+        phases[nphases++] = worker_text_count;
+        phases[nphases++] = worker_text_parse;
+    }
+    phases[nphases++] = worker_alloc;
+    if (shared->filename_checkpoint) {
+        phases[nphases++] = worker_grid_alloc;
+        phases[nphases++] = worker_checkpoint_bands;
+        phases[nphases++] = worker_checkpoint_close;
+    } else if (shared->tile_size[0]) {
+        phases[nphases++] = worker_grid_alloc;
+        phases[nphases++] = worker_tiles;
+        phases[nphases++] = worker_tiles_manifest;
+    } else {
+        if (shared->in_place) {
+            for (long w = 0; w < shared->plan.nwaves; ++w) {
+                phases[nphases++] = worker_inplace_rescale;
+                phases[nphases++] = worker_inplace_flush;
+            }
+            phases[nphases++] = worker_inplace_shrink;
+            phases[nphases++] = worker_inplace_transpose;
+        } else {
+            phases[nphases++] = worker_rescale;
+        }
+        phases[nphases++] = worker_grid_alloc;
+        if (shared->adaptive_window) {
+            phases[nphases++] = worker_sat_columns;
+        }
+        phases[nphases++] = worker_sample_grid;
+        if (shared->filename_sdf) {
+            phases[nphases++] = worker_sdf_rows;
+            phases[nphases++] = worker_sdf_columns;
+        }
+        phases[nphases++] = worker_march;
+        if (shared->blocked) {
+            phases[nphases++] = worker_unblock;
+        }
+        if (!shared->mmap_out) {
+            phases[nphases++] = worker_write;
+        }
+    }
+
+    for (long i = 0; i < NLOCKS; ++i) {
+        pthread_mutex_init(&shared->locks[i], NULL);
+    }
+
+    const int rc = job->engine->run(phases, nphases, shared, job->nthreads);
+
+    for (long i = 0; i < NLOCKS; ++i) {
+        pthread_mutex_destroy(&shared->locks[i]);
+    }
+
+    if (shared->map) {
+        unmap_ppm(shared->map);
+    }
+    free(phases);
+    free(shared->scratch);
+    free(shared->waves);
+
+    // No phase ran, only what was set up above is left
+    if (rc) {
+        fprintf(stderr, "Unable to start %ld threads on the %s backend: %s\n",
+                job->nthreads, job->engine->name, strerror(rc));
+        if (shared->text) {
+            text_grid_close(shared->text);
+        }
+        if (!job->image && shared->image) {
+            free(shared->image->data);
+            free(shared->image);
+        }
+        if (!shared->mask_loaded) {
+            free(shared->mask);
+        }
+        free(shared);
+        return NULL;
+    }
+
+    ppm_image *const scaled = shared->scaled;
+
+    // A mapped output was marched into as far as the job got
+    if (worker_discarded(shared)) {
+        const int mapped = shared->map != NULL;
+
+        if (mapped) {
+            unlink(shared->filename_out);
+        }
+        pipeline_free(shared, job);
+        if (!mapped && scaled != job->image) {
+            free(scaled->data);
+            free(scaled);
+        }
+        return NULL;
+    }
+
+    if (shared->grid && job->grid_out) {
+        *job->grid_out  = shared->grid[0];
+        shared->grid[0] = NULL;
+    }
+    pipeline_free(shared, job);
+    return scaled;
+}
+
+// Whether any of the 4x4 pixels around the point sampled for pixel (r, c)
+// of the rescaled image, clamped to the width x height input, has data
+static int reference_has_data(const unsigned char *const mask, const int width, const int height,
+                              const long r, const long c) {
+    const float x = ((float) r / (RESCALE_X - 1) * width) - 0.5;
+    const float y = ((float) c / (RESCALE_Y - 1) * height) - 0.5;
+    int         any = 0;
+
+    for (int py = (int) y - 1; py <= (int) y + 2; ++py) {
+        for (int px = (int) x - 1; px <= (int) x + 2; ++px) {
+            const int cx = px < 0 ? 0 : px >= width ? width - 1 : px;
+            const int cy = py < 0 ? 0 : py >= height ? height - 1 : py;
+
+            any |= mask[cx + width * cy] != 0;
+        }
+    }
+    return any;
+}
+
+ppm_image *pipeline_reference(const ppm_image *const image, const pipeline_job *const job) {
+    ppm_image *const *const cmap    = job->cmap;
+    const int               overlay = job->overlay;
+    ppm_image *const        out     = malloc(sizeof(ppm_image));
+    unsigned char          *has_data = NULL;
+    float                  *values   = NULL;
+
+    // Rescale, indexing the output as the worker does: x rows of y columns.
+    // Pixels interpolated only from pixels without data get the fill colour.
+    if (job->field) {
+        const float_image *const field    = job->field;
+        const int                rescaled = field->x > RESCALE_X || field->y > RESCALE_Y;
+
+        out->x    = rescaled ? RESCALE_X : field->x;
+        out->y    = rescaled ? RESCALE_Y : field->y;
+        out->data = malloc(out->x * out->y * sizeof(ppm_pixel));
+        values    = malloc(out->x * out->y * sizeof(float));
+        if (job->mask) {
+            has_data = malloc(out->x * out->y);
+        }
+
+        for (long r = 0; r < out->x; ++r) {
+            for (long c = 0; c < out->y; ++c) {
+                values[r * out->y + c]    = !rescaled ? field->data[r * out->y + c]
+                                          : sample_bicubic_float(field,
+                                                                 (float) r / (RESCALE_X - 1),
+                                                                 (float) c / (RESCALE_Y - 1));
+                out->data[r * out->y + c] = float_to_pixel(values[r * out->y + c]);
+                if (job->mask) {
+                    has_data[r * out->y + c] = !rescaled ? job->mask[r * out->y + c] != 0
+                                             : reference_has_data(job->mask, field->x, field->y,
+                                                                  r, c);
+                }
+            }
+        }
+    } else if (image->x <= RESCALE_X && image->y <= RESCALE_Y) {
+        out->x    = image->x;
+        out->y    = image->y;
+        out->data = malloc(image->x * image->y * sizeof(ppm_pixel));
+        memcpy(out->data, image->data, image->x * image->y * sizeof(ppm_pixel));
+        if (job->mask) {
+            has_data = malloc(image->x * image->y);
+            memcpy(has_data, job->mask, image->x * image->y);
+        }
+    } else {
+        out->x    = RESCALE_X;
+        out->y    = RESCALE_Y;
+        out->data = malloc(RESCALE_X * RESCALE_Y * sizeof(ppm_pixel));
+        if (job->mask) {
+            has_data = malloc(RESCALE_X * RESCALE_Y);
+        }
+
+        for (long r = 0; r < RESCALE_X; ++r) {
+            for (long c = 0; c < RESCALE_Y; ++c) {
+                uint8_t sample[3];
+
+                if (job->mask) {
+                    has_data[r * RESCALE_Y + c] = reference_has_data(job->mask, image->x, image->y,
+                                                                     r, c);
+                    if (!has_data[r * RESCALE_Y + c]) {
+                        out->data[r * RESCALE_Y + c] = job->nodata;
+                        continue;
+                    }
+                }
+
+                sample_bicubic((ppm_image *) image,
+                               (float) r / (RESCALE_X - 1),
+                               (float) c / (RESCALE_Y - 1),
+                               sample);
+                out->data[r * RESCALE_Y + c].red   = sample[0];
+                out->data[r * RESCALE_Y + c].green = sample[1];
+                out->data[r * RESCALE_Y + c].blue  = sample[2];
+            }
+        }
+    }
+
+    // Threshold one pixel every STEP, plus the last row and column
+    const long p = out->x / STEP;
+    const long q = out->y / STEP;
+    unsigned char grid[p + 1][q + 1];
+    unsigned char lum[p + 1][q + 1];
+    unsigned char nodata[p + 1][q + 1];
+
+    for (long i = 0; i <= p; ++i) {
+        for (long j = 0; j <= q; ++j) {
+            const long r = i < p ? i * STEP : out->x - 1;
+            const long c = j < q ? j * STEP : (out->x < out->y ? out->x : out->y) - 1;
+            const ppm_pixel pix = out->data[r * out->y + c];
+
+            lum[i][j]    = (pix.red + pix.green + pix.blue) / 3;
+            grid[i][j]   = values ? values[r * out->y + c] <= job->threshold
+                                  : lum[i][j] <= SIGMA ? 1 : 0;
+            if (job->adaptive_window) {
+                // Mean of the window around the point, cut off at the edges
+                const long w   = job->adaptive_window;
+                long       sum = 0, area = 0;
+
+                for (long wr = r - w / 2; wr < r - w / 2 + w; ++wr) {
+                    for (long wc = c - w / 2; wc < c - w / 2 + w; ++wc) {
+                        if (wr >= 0 && wr < out->x && wc >= 0 && wc < out->y) {
+                            const ppm_pixel wpix = out->data[wr * out->y + wc];
+
+                            sum  += (wpix.red + wpix.green + wpix.blue) / 3;
+                            area += 1;
+                        }
+                    }
+                }
+                grid[i][j] = (lum[i][j] + job->adaptive_offset) * area <= sum ? 1 : 0;
+            }
+            nodata[i][j] = has_data && !has_data[r * out->y + c];
+        }
+    }
+
+    ppm_pixel palette[SMOOTH_COLORS];
+    smooth_palette(cmap, palette);
+
+    // Copy the tile of every cell, or blend its contour pixels, or paint the
+    // smooth contour right through the crossing points
+    for (long i = 0; i < p; ++i) {
+        for (long j = 0; j < q; ++j) {
+            const int k = grid[i][j] * 8 + grid[i][j + 1] * 4
+                        + grid[i + 1][j + 1] * 2 + grid[i + 1][j];
+            const ppm_image *const tile = cmap[k];
+            const int levels[4] = {
+                smooth_level(lum[i][j],     lum[i][j + 1]),
+                smooth_level(lum[i][j + 1], lum[i + 1][j + 1]),
+                smooth_level(lum[i + 1][j], lum[i + 1][j + 1]),
+                smooth_level(lum[i][j],     lum[i + 1][j])
+            };
+
+            const int skipped = nodata[i][j] || nodata[i][j + 1]
+                              || nodata[i + 1][j + 1] || nodata[i + 1][j];
+
+            for (long r = 0; r < tile->x; ++r) {
+                for (long c = 0; c < tile->y; ++c) {
+                    ppm_pixel *const dst = &out->data[(i * STEP + r) * out->y + j * STEP + c];
+                    const ppm_pixel  src = tile->data[r * tile->x + c];
+
+                    if (skipped) {
+                        *dst = job->nodata;
+                    } else if (job->smooth) {
+                        *dst = palette[smooth_classify(k, levels, r, c)];
+                    } else if (!overlay) {
+                        *dst = src;
+                    } else if (memcmp(&src, &cmap[0]->data[0], sizeof(ppm_pixel))
+                               && memcmp(&src, &cmap[15]->data[0], sizeof(ppm_pixel))) {
+                        dst->red   = (overlay * src.red   + (255 - overlay) * dst->red   + 127) / 255;
+                        dst->green = (overlay * src.green + (255 - overlay) * dst->green + 127) / 255;
+                        dst->blue  = (overlay * src.blue  + (255 - overlay) * dst->blue  + 127) / 255;
+                    }
+                }
+            }
+        }
+    }
+
+    free(has_data);
+    free(values);
+    return out;
+}
@@ -0,0 +1,75 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include "helpers.h"
+#include "backend.h"
+#include "pfm.h"
+#include "cancel.h"
+
+typedef struct {
+    const char    *filename_in;         // read when `image` is NULL
+    int            mosaic;              // filename_in is the manifest of a grid of
+                                        // tiles (see mosaic.h), read as needed
+    const char    *filename_out;        // nothing is written when NULL
+    const char    *filename_sdf;        // optional signed distance field output
+    const char    *filename_checkpoint; // march band by band into filename_out,
+                                        // resuming from this checkpoint
+    int            tile_size[2];        // if set, filename_out is a directory
+                                        // of tiles this size (rows, columns)
+    int            mmap_out;            // march straight into a mapping of
+                                        // filename_out instead of writing it
+    int            rle_grid;            // keep the grid as runs of equal values
+    int            overlay;             // if set, only blend the contour pixels
+                                        // into the image, with this alpha (1-255)
+    int            smooth;              // pick tile variants matching where the
+                                        // contour crosses each cell edge
+    int            in_place;            // downscale into the buffer of the input,
+                                        // which then holds the output
+    int            blocked;             // keep the rescaled image in blocks while
+                                        // marching (see blocked.h)
+    int            adaptive_window;     // if set, threshold every grid point against
+    int            adaptive_offset;     // the mean of the window this wide around
+                                        // it, less the offset, instead of SIGMA
+    const char    *filename_mask;       // P5 mask of the input, zero where it has no data
+    unsigned char *mask;                // the same, in memory, in the order of the pixels;
+                                        // otherwise the alpha of a P7 input is used, or
+                                        // the NODATA_value cells of an ESRI grid
+    ppm_pixel      nodata;              // colour of the cells without data
+    ppm_image     *image;               // marched in place when it isn't rescaled
+    float_image   *field;               // float input instead of `image`; a PFM
+                                        // filename_in is read as one too
+    float          threshold;           // points of a float input at most this are set
+    ppm_image    **cmap;                // read from ./contours when NULL
+    unsigned char **grid_out;           // if set, receives the grid, x / STEP + 1
+                                        // rows of y / STEP + 1 points in one block
+                                        // the caller frees
+    cancel_token  *cancel;              // if set, polled between bands of work
+    int            partial;             // once cancelled, still write and return what
+                                        // was marched so far, if the rescale was done
+    long           nthreads;
+    const backend *engine;
+} pipeline_job;
+
+// Why the options of `job` can't be combined, or NULL if they can.
+// pipeline_run() fails the jobs this rejects.
+const char *pipeline_check(const pipeline_job *const job);
+
+// Runs the worker phases for `job`. Returns the marched image, or NULL if
+// the options can't be combined, the backend failed to run the phases or
+// the job was cancelled (see `partial`).
+// With a checkpoint, tiles or a mapped output, the result only goes to
+// `filename_out` and the returned image has no data. A cancelled job keeps
+// its checkpoint, to be resumed; a mapped output it didn't finish is removed,
+// and an image marched in place may be left part marched.
+ppm_image *pipeline_run(const pipeline_job *const job);
+
+// Deliberately simple single-threaded version of the worker, which every
+// optimized kernel must agree with. `image` is left untouched; only the
+// `cmap`, `overlay`, `smooth`, `adaptive_*`, `mask`, `nodata`, `field` and
+// `threshold` fields of `job` are looked at. With `field` set, `image` is
+// ignored and the field is thresholded instead, its pixels turned grey.
+ppm_image *pipeline_reference(const ppm_image *const image, const pipeline_job *const job);
+
+#endif
@@ -0,0 +1,56 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "ppm_map.h"
+
+void map_reserve(const int fd, const size_t size, const char *filename) {
+    if (fallocate(fd, 0, 0, size) && (errno != EOPNOTSUPP || ftruncate(fd, size))) {
+        perror(filename);
+        exit(1);
+    }
+}
+
+ppm_map *map_ppm(const char *filename, const int x, const int y) {
+    ppm_map *const map = malloc(sizeof(ppm_map));
+    char           header[64];
+    const int      header_size = sprintf(header, "P6\n%d %d\n%d\n", x, y, RGB_COMPONENT_COLOR);
+
+    map->size = header_size + (size_t) x * y * sizeof(ppm_pixel);
+    map->fd   = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (map->fd < 0) {
+        fprintf(stderr, "Unable to open file '%s'\n", filename);
+        exit(1);
+    }
+
+    map_reserve(map->fd, map->size, filename);
+
+    map->base = mmap(NULL, map->size, PROT_READ | PROT_WRITE, MAP_SHARED, map->fd, 0);
+    if (map->base == MAP_FAILED) {
+        perror(filename);
+        exit(1);
+    }
+
+    memcpy(map->base, header, header_size);
+    map->image = (ppm_image) {
+        .x    = x,
+        .y    = y,
+        .data = (ppm_pixel *) ((char *) map->base + header_size)
+    };
+
+    return map;
+}
+
+void unmap_ppm(ppm_map *const map) {
+    munmap(map->base, map->size);
+    close(map->fd);
+    map->image.data = NULL;
+}
@@ -0,0 +1,31 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef PPM_MAP_H
+#define PPM_MAP_H
+
+#include <stddef.h>
+
+#include "helpers.h"
+
+typedef struct {
+    ppm_image image;  // data points right after the header in the mapping
+    void     *base;
+    size_t    size;
+    int       fd;
+} ppm_map;
+
+// Creates `filename` as an x by y P6 image with the same header write_ppm
+// would give it, preallocated and mapped shared, so that whatever is written
+// to `image.data` ends up in the file.
+ppm_map *map_ppm(const char *filename, const int x, const int y);
+
+// Reserves the `size` bytes of the file open as `fd` on disk, so that page
+// faults on a shared mapping of it never have to allocate, and a full disk
+// fails here rather than as a SIGBUS. Where the file system can't, the file
+// is only extended.
+void map_reserve(const int fd, const size_t size, const char *filename);
+
+// Leaves the write-back of the pixels to the kernel
+void unmap_ppm(ppm_map *const map);
+
+#endif
@@ -0,0 +1,331 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <limits.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+
+#include "profiler.h"
+
+#define PROFILER_DEPTH   32
+#define PROFILER_SAMPLES (1 << 16)
+// The handler and the signal trampoline
+#define PROFILER_SKIP    2
+
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+typedef struct {
+    phase_fn  phase;
+    int       weight;     // periods of the timer the sample stands for
+    int       depth;
+    void     *frames[PROFILER_DEPTH];
+} profiler_sample;
+
+typedef struct {
+    const void *address;
+    char       *name;
+    int         exe;      // in the executable, but without a dynamic symbol
+} profiler_symbol;
+
+__thread phase_fn profiler_current_phase;
+
+static __thread timer_t profiler_timer;
+static __thread int     profiler_timed;
+
+static struct {
+    int              running;
+    const char      *filename;
+    long             interval_ns;
+    profiler_sample *samples;
+    long             nsamples;    // past PROFILER_SAMPLES, the samples are dropped
+} profiler;
+
+static void profiler_handler(int sig) {
+    const int  saved = errno;
+    const long i     = __atomic_fetch_add(&profiler.nsamples, 1, __ATOMIC_RELAXED);
+
+    (void) sig;
+    if (i < PROFILER_SAMPLES) {
+        // Periods elapsed while the signal was pending, e.g. as the thread
+        // waited for a CPU, count towards this sample
+        const int overrun = profiler_timed ? timer_getoverrun(profiler_timer) : 0;
+
+        profiler.samples[i].phase  = profiler_current_phase;
+        profiler.samples[i].weight = 1 + (overrun > 0 ? overrun : 0);
+        profiler.samples[i].depth = backtrace(profiler.samples[i].frames, PROFILER_DEPTH);
+    }
+    errno = saved;
+}
+
+void profiler_start(const char *filename, const long hz) {
+    void            *warmup[1];
+    struct sigaction sa = { .sa_handler = profiler_handler, .sa_flags = SA_RESTART };
+
+    profiler.filename    = filename;
+    profiler.interval_ns = 1000000000L / hz;
+    profiler.nsamples    = 0;
+
+    // Nothing may be allocated or loaded in the handler: the buffer is
+    // touched here, and the first backtrace() loads the unwinder
+    profiler.samples = malloc(PROFILER_SAMPLES * sizeof(profiler_sample));
+    memset(profiler.samples, 0, PROFILER_SAMPLES * sizeof(profiler_sample));
+    backtrace(warmup, 1);
+
+    sigemptyset(&sa.sa_mask);
+    if (sigaction(SIGPROF, &sa, NULL)) {
+        perror("sigaction");
+        exit(1);
+    }
+    __atomic_store_n(&profiler.running, 1, __ATOMIC_RELEASE);
+}
+
+void profiler_thread_begin(void) {
+    if (!__atomic_load_n(&profiler.running, __ATOMIC_ACQUIRE)) {
+        return;
+    }
+
+    struct sigevent   sev    = { .sigev_notify = SIGEV_THREAD_ID, .sigev_signo = SIGPROF };
+    struct itimerspec period = {
+        .it_interval = { profiler.interval_ns / 1000000000L, profiler.interval_ns % 1000000000L },
+        .it_value    = { profiler.interval_ns / 1000000000L, profiler.interval_ns % 1000000000L }
+    };
+
+    sev.sigev_notify_thread_id = gettid();
+    if (timer_create(CLOCK_MONOTONIC, &sev, &profiler_timer)
+        || timer_settime(profiler_timer, 0, &period, NULL)) {
+        perror("timer_create");
+        exit(1);
+    }
+    profiler_timed = 1;
+}
+
+void profiler_thread_end(void) {
+    if (profiler_timed) {
+        timer_delete(profiler_timer);
+        profiler_timed = 0;
+    }
+}
+
+static int compare_address(const void *a, const void *b) {
+    const char *const x = ((const profiler_symbol *) a)->address;
+    const char *const y = ((const profiler_symbol *) b)->address;
+
+    return (x > y) - (x < y);
+}
+
+static int compare_string(const void *a, const void *b) {
+    return strcmp(*(char *const *) a, *(char *const *) b);
+}
+
+static char *profiler_symbol_name(const profiler_symbol *const symbols,
+                                  const long nsymbols,
+                                  const void *address) {
+    const profiler_symbol key   = { .address = address };
+    const profiler_symbol *const found = bsearch(&key, symbols, nsymbols, sizeof(profiler_symbol),
+                                                 compare_address);
+
+    return found->name;
+}
+
+// Names of the functions of the executable that have no dynamic symbol,
+// static ones mostly, from addr2line if it's installed. Functions inlined
+// at `address` come as "caller;inlined", as in the folded stacks.
+static void profiler_addr2line(profiler_symbol *const symbols, const long nsymbols, const void *base) {
+    char   exe[PATH_MAX];
+    size_t len = 0;
+    long   n   = 0;
+
+    const ssize_t exelen = readlink("/proc/self/exe", exe, sizeof(exe) - 1);
+
+    if (exelen <= 0) {
+        return;
+    }
+    exe[exelen] = '\0';
+
+    char *command = malloc(exelen + 64 + nsymbols * 20);
+
+    len += sprintf(command, "addr2line -a -f -i -e '%s'", exe);
+    for (long i = 0; i < nsymbols; ++i) {
+        if (symbols[i].exe) {
+            len += sprintf(command + len, " %lx",
+                           (unsigned long) ((const char *) symbols[i].address - (const char *) base));
+            ++n;
+        }
+    }
+
+    FILE *const pipe  = n ? popen(command, "r") : NULL;
+    char        line[4096];
+    long        i     = -1;
+    long        lines = 0;
+
+    free(command);
+    if (!pipe) {
+        return;
+    }
+
+    // "0x<address>", then a function and its location per inlining level,
+    // innermost first
+    while (fgets(line, sizeof(line), pipe)) {
+        line[strcspn(line, "\n")] = '\0';
+        if (!strncmp(line, "0x", 2)) {
+            while (++i < nsymbols && !symbols[i].exe) {
+            }
+            lines = 0;
+            continue;
+        }
+
+        // Locations alternate with the functions
+        if (i < 0 || i >= nsymbols || lines++ % 2 || !strcmp(line, "??")) {
+            continue;
+        }
+
+        char *const inner = symbols[i].name;
+
+        if (!inner) {
+            symbols[i].name = strdup(line);
+        } else if (asprintf(&symbols[i].name, "%s;%s", line, inner) >= 0) {
+            free(inner);
+        }
+    }
+    pclose(pipe);
+}
+
+static void profiler_resolve(profiler_symbol *const symbols, const long nsymbols) {
+    Dl_info self;
+    int     unresolved = 0;
+
+    dladdr((void *) profiler_resolve, &self);
+
+    for (long i = 0; i < nsymbols; ++i) {
+        Dl_info   info  = { 0 };
+        const int found = symbols[i].address && dladdr(symbols[i].address, &info);
+
+        if (!symbols[i].address) {
+            symbols[i].name = strdup("barrier");
+        } else if (found && info.dli_sname) {
+            symbols[i].name = strdup(info.dli_sname);
+        } else if (found) {
+            symbols[i].exe  = info.dli_fbase == self.dli_fbase;
+            unresolved     |= symbols[i].exe;
+        }
+    }
+    if (unresolved) {
+        profiler_addr2line(symbols, nsymbols, self.dli_fbase);
+    }
+
+    // Whatever is left is named after its object file and offset
+    for (long i = 0; i < nsymbols; ++i) {
+        Dl_info info = { 0 };
+
+        if (!symbols[i].name) {
+            const int   found = dladdr(symbols[i].address, &info);
+            const char *file  = found && info.dli_fname ? strrchr(info.dli_fname, '/') : NULL;
+
+            if (asprintf(&symbols[i].name, "%s+0x%lx",
+                         file ? file + 1 : found && info.dli_fname ? info.dli_fname : "?",
+                         (unsigned long) ((const char *) symbols[i].address
+                                          - (const char *) info.dli_fbase)) < 0) {
+                exit(1);
+            }
+        }
+    }
+}
+
+// Return addresses point past their call, possibly into the next function
+static const void *profiler_frame(const profiler_sample *const sample, const int f) {
+    return f == PROFILER_SKIP ? sample->frames[f] : (const char *) sample->frames[f] - 1;
+}
+
+void profiler_stop(void) {
+    __atomic_store_n(&profiler.running, 0, __ATOMIC_RELEASE);
+    signal(SIGPROF, SIG_IGN);
+
+    const long n = profiler.nsamples < PROFILER_SAMPLES ? profiler.nsamples : PROFILER_SAMPLES;
+
+    if (profiler.nsamples > PROFILER_SAMPLES) {
+        fprintf(stderr, "profiler: %ld samples dropped, the buffer holds %d\n",
+                profiler.nsamples - PROFILER_SAMPLES, PROFILER_SAMPLES);
+    }
+
+    // Every distinct address, phases included, named once
+    profiler_symbol *symbols  = malloc(n * (PROFILER_DEPTH + 1) * sizeof(profiler_symbol) + 1);
+    long             nsymbols = 0;
+
+    for (long s = 0; s < n; ++s) {
+        symbols[nsymbols++] = (profiler_symbol) { .address = (const void *) profiler.samples[s].phase };
+        for (int f = PROFILER_SKIP; f < profiler.samples[s].depth; ++f) {
+            symbols[nsymbols++] = (profiler_symbol) { .address = profiler_frame(&profiler.samples[s], f) };
+        }
+    }
+    qsort(symbols, nsymbols, sizeof(profiler_symbol), compare_address);
+
+    long unique = 0;
+
+    for (long i = 0; i < nsymbols; ++i) {
+        if (!unique || symbols[i].address != symbols[unique - 1].address) {
+            symbols[unique++] = symbols[i];
+        }
+    }
+    nsymbols = unique;
+    profiler_resolve(symbols, nsymbols);
+
+    // One line per sample, outermost frame first and its weight last, then
+    // the weights of identical lines summed
+    char **const stacks = malloc(n * sizeof(char *) + 1);
+
+    for (long s = 0; s < n; ++s) {
+        const profiler_sample *const sample = &profiler.samples[s];
+        size_t                       len    = 0;
+        char                        *stack  = NULL;
+        FILE *const                  out    = open_memstream(&stack, &len);
+
+        fputs(profiler_symbol_name(symbols, nsymbols, (const void *) sample->phase), out);
+        for (int f = sample->depth - 1; f >= PROFILER_SKIP; --f) {
+            fprintf(out, ";%s", profiler_symbol_name(symbols, nsymbols, profiler_frame(sample, f)));
+        }
+        fprintf(out, "\t%d", sample->weight);
+        fclose(out);
+        stacks[s] = stack;
+    }
+    qsort(stacks, n, sizeof(char *), compare_string);
+
+    FILE *const fp = fopen(profiler.filename, "w");
+
+    if (!fp) {
+        fprintf(stderr, "Unable to open file '%s'\n", profiler.filename);
+        exit(1);
+    }
+    for (long s = 0, count = 0; s < n; ++s) {
+        char *const  weight = strrchr(stacks[s], '\t');
+        const size_t len    = weight - stacks[s];
+
+        *weight  = '\0';
+        count   += atol(weight + 1);
+        if (s == n - 1 || strncmp(stacks[s], stacks[s + 1], len) || stacks[s + 1][len] != '\t') {
+            fprintf(fp, "%s %ld\n", stacks[s], count);
+            count = 0;
+        }
+    }
+    fclose(fp);
+
+    for (long s = 0; s < n; ++s) {
+        free(stacks[s]);
+    }
+    for (long i = 0; i < nsymbols; ++i) {
+        free(symbols[i].name);
+    }
+    free(stacks);
+    free(symbols);
+    free(profiler.samples);
+    profiler.samples = NULL;
+}
@@ -0,0 +1,31 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "backend.h"
+
+#define PROFILER_HZ 499
+
+// Phase the calling thread is running, NULL in between (waiting at the
+// barrier). Kept up to date by the backends whether or not the profiler runs.
+extern __thread phase_fn profiler_current_phase;
+
+// Opt-in sampling profiler. While it runs, every thread of a backend gets a
+// SIGPROF `hz` times per second of wall-clock time, so that waits show up
+// too, and the handler records the current phase and a backtrace into a
+// buffer allocated upfront. profiler_stop() writes the samples to
+// `filename` as folded stacks, "<phase>;<caller>;...;<callee> <count>"
+// lines for flamegraph.pl.
+void profiler_start(const char *filename, const long hz);
+void profiler_stop(void);
+
+// Called by the backends on every thread running phases, around them
+void profiler_thread_begin(void);
+void profiler_thread_end(void);
+
+static inline void profiler_phase(const phase_fn phase) {
+    profiler_current_phase = phase;
+}
+
+#endif
@@ -0,0 +1,371 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+// Python bindings: marching_squares.march() runs the worker on a buffer
+// (a NumPy array, a bytearray, ...) without going through PPM files.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "helpers.h"
+#include "backend.h"
+#include "pipeline.h"
+#include "kernels.h"
+#include "archive.h"
+
+// Memory handed to Python through the buffer protocol. Either owned (and
+// freed with the result), or borrowed from the buffer of `base`.
+typedef struct {
+    PyObject_HEAD
+    unsigned char *data;
+    Py_ssize_t     shape[3];
+    Py_ssize_t     strides[3];
+    int            ndim;
+    PyObject      *base;
+    Py_buffer      base_view;
+} result_object;
+
+static void result_dealloc(result_object *const self) {
+    if (self->base) {
+        PyBuffer_Release(&self->base_view);
+        Py_DECREF(self->base);
+    } else {
+        free(self->data);
+    }
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+static int result_getbuffer(result_object *const self, Py_buffer *const view, const int flags) {
+    Py_ssize_t len = 1;
+
+    for (int d = 0; d < self->ndim; ++d) {
+        len *= self->shape[d];
+    }
+
+    view->buf        = self->data;
+    view->obj        = (PyObject *) self;
+    view->len        = len;
+    view->readonly   = 0;
+    view->itemsize   = 1;
+    view->format     = flags & PyBUF_FORMAT ? "B" : NULL;
+    view->ndim       = self->ndim;
+    view->shape      = flags & PyBUF_ND ? self->shape : NULL;
+    view->strides    = flags & PyBUF_STRIDES ? self->strides : NULL;
+    view->suboffsets = NULL;
+    view->internal   = NULL;
+    Py_INCREF(self);
+    return 0;
+}
+
+static PyBufferProcs result_as_buffer = {
+    .bf_getbuffer = (getbufferproc) result_getbuffer,
+};
+
+static PyTypeObject result_type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name      = "marching_squares.Result",
+    .tp_doc       = "Output of march(), exported through the buffer protocol.",
+    .tp_basicsize = sizeof(result_object),
+    .tp_flags     = Py_TPFLAGS_DEFAULT,
+    .tp_dealloc   = (destructor) result_dealloc,
+    .tp_as_buffer = &result_as_buffer,
+};
+
+static result_object *result_new(unsigned char *const data, const int ndim,
+                                 const Py_ssize_t d0, const Py_ssize_t d1, const Py_ssize_t d2) {
+    result_object *const self = PyObject_New(result_object, &result_type);
+    if (!self) {
+        return NULL;
+    }
+
+    self->data       = data;
+    self->ndim       = ndim;
+    self->shape[0]   = d0;
+    self->shape[1]   = d1;
+    self->shape[2]   = d2;
+    self->strides[2] = 1;
+    self->strides[1] = ndim == 3 ? d2 : 1;
+    self->strides[0] = ndim == 3 ? d1 * d2 : d1;
+    self->base       = NULL;
+    return self;
+}
+
+// numpy.asarray(result) when NumPy is around, the result itself otherwise
+static PyObject *result_export(result_object *const result) {
+    PyObject *const numpy = PyImport_ImportModule("numpy");
+    if (!numpy) {
+        PyErr_Clear();
+        return (PyObject *) result;
+    }
+
+    PyObject *const array = PyObject_CallMethod(numpy, "asarray", "O", result);
+    Py_DECREF(numpy);
+    Py_DECREF(result);
+    return array;
+}
+
+// Reads a contour tile without exiting on a bad one, as read_ppm() would:
+// NULL with a Python exception set instead
+static ppm_image *load_tile(const char *const filename) {
+    FILE *const fp = fopen(filename, "rb");
+    if (!fp) {
+        PyErr_Format(PyExc_FileNotFoundError, "No contour tile '%s'", filename);
+        return NULL;
+    }
+
+    char   *data = NULL;
+    size_t  size = 0, capacity = 0, n;
+
+    do {
+        if (size == capacity) {
+            capacity = capacity ? 2 * capacity : 4096;
+            data     = realloc(data, capacity);
+        }
+        n     = fread(data + size, 1, capacity - size, fp);
+        size += n;
+    } while (n);
+    fclose(fp);
+
+    int              x, y;
+    const ppm_pixel *pixels = ppm_parse(data, size, &x, &y);
+
+    if (!pixels || x != STEP || y != STEP) {
+        PyErr_Format(PyExc_ValueError, pixels ? "Contour tile '%s' isn't %dx%d"
+                                              : "Contour tile '%s' isn't a valid P6 image",
+                     filename, STEP, STEP);
+        free(data);
+        return NULL;
+    }
+
+    ppm_image *const tile = malloc(sizeof(ppm_image));
+
+    tile->x    = x;
+    tile->y    = y;
+    tile->data = malloc((size_t) x * y * sizeof(ppm_pixel));
+    memcpy(tile->data, pixels, (size_t) x * y * sizeof(ppm_pixel));
+    free(data);
+    return tile;
+}
+
+static ppm_image **load_cmap(const char *const dirname) {
+    ppm_image **const cmap = malloc(CONTOUR_CONFIG_COUNT * sizeof(ppm_image *));
+
+    for (long k = 0; k < CONTOUR_CONFIG_COUNT; ++k) {
+        char filename[4096];
+
+        snprintf(filename, sizeof(filename), "%s/%ld.ppm", dirname, k);
+        if (!(cmap[k] = load_tile(filename))) {
+            while (k--) {
+                free(cmap[k]->data);
+                free(cmap[k]);
+            }
+            free(cmap);
+            return NULL;
+        }
+    }
+    return cmap;
+}
+
+static void free_cmap(ppm_image **const cmap) {
+    for (long k = 0; k < CONTOUR_CONFIG_COUNT; ++k) {
+        free(cmap[k]->data);
+        free(cmap[k]);
+    }
+    free(cmap);
+}
+
+PyDoc_STRVAR(march_doc,
+"march(source, threads=1, backend=None, output='image', contours='./contours',\n"
+"      inplace=False)\n"
+"\n"
+"Runs the marching squares worker on `source`, a C-contiguous uint8 buffer\n"
+"of shape (H, W, 3) or (H, W). RGB sources are used without copying; gray\n"
+"ones are expanded to RGB once. `output` is 'image' for the (H', W', 3)\n"
+"output, 'grid' for the thresholded grid or 'cells' for the configuration\n"
+"of every cell. Images small enough not to be rescaled are marched in a\n"
+"copy, or with inplace=True in the source buffer itself, which must then be\n"
+"a writable RGB one and which the 'image' output shares. The result is a\n"
+"NumPy array if NumPy can be imported, an object exporting the buffer\n"
+"protocol otherwise.");
+
+static PyObject *py_march(PyObject *const module, PyObject *const args, PyObject *const kwargs) {
+    static char *keywords[] = { "source", "threads", "backend", "output", "contours", "inplace",
+                                NULL };
+
+    PyObject   *source;
+    long        nthreads = 1;
+    const char *backend_name = NULL, *output = "image", *contours = "./contours";
+    int         inplace = 0;
+    (void) module;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|lzssp", keywords, &source, &nthreads,
+                                     &backend_name, &output, &contours, &inplace)) {
+        return NULL;
+    }
+
+    const int want_image = !strcmp(output, "image");
+    const int want_grid  = !strcmp(output, "grid");
+    const int want_cells = !strcmp(output, "cells");
+    if (!want_image && !want_grid && !want_cells) {
+        return PyErr_Format(PyExc_ValueError, "output must be 'image', 'grid' or 'cells'");
+    }
+
+    const backend *const engine = backend_find(backend_name);
+    if (!engine) {
+        return PyErr_Format(PyExc_ValueError, "Unknown backend '%s'", backend_name);
+    }
+    if (nthreads < 1) {
+        return PyErr_Format(PyExc_ValueError, "threads must be positive");
+    }
+
+    Py_buffer view;
+    if (PyObject_GetBuffer(source, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+        return NULL;
+    }
+    if ((view.format && strcmp(view.format, "B")) || view.itemsize != 1
+        || !(view.ndim == 2 || (view.ndim == 3 && view.shape[2] == 3))
+        || !view.shape[0] || !view.shape[1]) {
+        PyBuffer_Release(&view);
+        return PyErr_Format(PyExc_ValueError, "source must be a uint8 array of shape (H, W, 3) or (H, W)");
+    }
+
+    if (inplace && (view.ndim != 3 || view.readonly)) {
+        PyBuffer_Release(&view);
+        return PyErr_Format(PyExc_ValueError, "inplace needs a writable source of shape (H, W, 3)");
+    }
+
+    // A rescaled source is only read, so it is never copied
+    ppm_image image = { .x = view.shape[1], .y = view.shape[0], .data = view.buf };
+    const int rescaled = image.x > RESCALE_X || image.y > RESCALE_Y;
+    const int borrowed = view.ndim == 3 && (rescaled || inplace);
+
+    // Anything else is copied once, into RGB
+    if (!borrowed) {
+        const unsigned char *const src = view.buf;
+
+        image.data = malloc((size_t) image.x * image.y * sizeof(ppm_pixel));
+        for (Py_ssize_t i = 0; i < (Py_ssize_t) image.x * image.y; ++i) {
+            image.data[i] = view.ndim == 3
+                          ? ((const ppm_pixel *) src)[i]
+                          : (ppm_pixel) { src[i], src[i], src[i] };
+        }
+    }
+
+    ppm_image **const cmap = load_cmap(contours);
+    if (!cmap) {
+        if (!borrowed) {
+            free(image.data);
+        }
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+
+    unsigned char *grid = NULL;
+    const pipeline_job job = {
+        .image    = &image,
+        .cmap     = cmap,
+        .grid_out = want_image ? NULL : &grid,
+        .nthreads = nthreads,
+        .engine   = engine
+    };
+    ppm_image *scaled;
+
+    Py_BEGIN_ALLOW_THREADS
+    scaled = pipeline_run(&job);
+    Py_END_ALLOW_THREADS
+
+    free_cmap(cmap);
+    if (!scaled) {
+        if (!borrowed) {
+            free(image.data);
+        }
+        PyBuffer_Release(&view);
+        return PyErr_Format(PyExc_RuntimeError, "The %s backend failed to run", engine->name);
+    }
+
+    const long p = scaled->x / STEP, q = scaled->y / STEP;
+    result_object *result;
+
+    if (want_image) {
+        result = result_new((unsigned char *) scaled->data, 3, scaled->y, scaled->x, 3);
+        if (result && scaled == &image && borrowed) {
+            // Marched in the source buffer, which the result keeps alive
+            result->base      = source;
+            result->base_view = view;
+            Py_INCREF(source);
+        }
+    } else {
+        if (want_cells) {
+            unsigned char *const cells = malloc(p * q);
+
+            Py_BEGIN_ALLOW_THREADS
+            for (long i = 0; i < p; ++i) {
+                for (long j = 0; j < q; ++j) {
+                    cells[i * q + j] = 8 * grid[i * (q + 1) + j]
+                                     + 4 * grid[i * (q + 1) + j + 1]
+                                     + 2 * grid[(i + 1) * (q + 1) + j + 1]
+                                     +     grid[(i + 1) * (q + 1) + j];
+                }
+            }
+            Py_END_ALLOW_THREADS
+
+            free(grid);
+            grid = cells;
+        }
+        result = result_new(grid, 2, want_cells ? p : p + 1, want_cells ? q : q + 1, 1);
+        if (scaled != &image) {
+            free(scaled->data);
+        }
+    }
+
+    if (scaled != &image) {
+        free(scaled);
+        if (!borrowed) {
+            free(image.data);
+        }
+    } else if (!borrowed && !want_image) {
+        free(image.data);
+    }
+    if (!result || !result->base) {
+        PyBuffer_Release(&view);
+    }
+    return result ? result_export(result) : NULL;
+}
+
+static PyMethodDef methods[] = {
+    { "march", (PyCFunction) (void (*)(void)) py_march, METH_VARARGS | METH_KEYWORDS, march_doc },
+    { NULL, NULL, 0, NULL }
+};
+
+static struct PyModuleDef module = {
+    PyModuleDef_HEAD_INIT,
+    .m_name    = "marching_squares",
+    .m_doc     = "Marching squares on in-memory images.",
+    .m_size    = -1,
+    .m_methods = methods,
+};
+
+PyMODINIT_FUNC PyInit_marching_squares(void) {
+    if (PyType_Ready(&result_type) < 0) {
+        return NULL;
+    }
+
+    PyObject *const m = PyModule_Create(&module);
+    if (!m) {
+        return NULL;
+    }
+
+    Py_INCREF(&result_type);
+    if (PyModule_AddObject(m, "Result", (PyObject *) &result_type) < 0) {
+        Py_DECREF(&result_type);
+        Py_DECREF(m);
+        return NULL;
+    }
+
+    PyModule_AddIntConstant(m, "STEP", STEP);
+    kernels_init(NULL, 0, NULL, 0);
+    return m;
+}
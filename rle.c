@@ -0,0 +1,138 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "marching.h"
+#include "rle.h"
+
+static void rle_push(grid_rle_row *const row, long *const capacity, const long end) {
+    if (row->nruns == *capacity) {
+        *capacity *= 2;
+        row->ends  = realloc(row->ends, *capacity * sizeof(long));
+    }
+    row->ends[row->nruns++] = end;
+}
+
+static void sample_row_rle(grid_rle_row    *const row,
+                           const ppm_image *const image,
+                           const long i) {
+    const long q        = image->y / STEP;
+    long       capacity = 4;
+
+    row->nruns = 0;
+    row->ends  = malloc(capacity * sizeof(long));
+    row->first = pixel_luminance(image->data[grid_sample_offset(image, i, 0)]) <= SIGMA;
+
+    unsigned char prev = row->first;
+
+    for (long j = 1; j <= q; ++j) {
+        const unsigned char curr = pixel_luminance(image->data[grid_sample_offset(image, i, j)]) <= SIGMA;
+
+        if (curr != prev) {
+            rle_push(row, &capacity, j);
+        }
+        prev = curr;
+    }
+    rle_push(row, &capacity, q + 1);
+}
+
+void sample_grid_rle(grid_rle_row    *const rows,
+                     const ppm_image *const image,
+                     cancel_token    *const cancel,
+                     const long tid,
+                     const long nthreads) {
+    const long         p     = image->x / STEP;
+    const thread_slice slice = thread_get_slice(tid, nthreads, p);
+
+    for (long i = slice.start; i < slice.end; ++i) {
+        if ((i - slice.start) % (CANCEL_BAND_ROWS / STEP) == 0 && cancel_check(cancel)) {
+            return;
+        }
+        sample_row_rle(&rows[i], image, i);
+    }
+
+    // Task reserved for the thread having the last slice of the range
+    if (tid == nthreads - 1 && !cancel_check(cancel)) {
+        sample_row_rle(&rows[p], image, p);
+    }
+}
+
+// Copies tile `c` into `ncells` consecutive cells, starting at (x, y). The
+// first copy of each tile row is then doubled until the span is full.
+static void march_fill_span(ppm_image       *const image,
+                            const ppm_image *const c,
+                            const long x,
+                            const long y,
+                            const long ncells) {
+    const long len = ncells * c->y;
+
+    for (long i = 0; i < c->x; ++i) {
+        ppm_pixel *const dst = &image->data[(x + i) * image->y + y];
+        long             done = c->y;
+
+        memcpy(dst, &c->data[i * c->x], c->y * sizeof(ppm_pixel));
+        while (done < len) {
+            const long n = MIN(done, len - done);
+
+            memcpy(dst + done, dst, n * sizeof(ppm_pixel));
+            done += n;
+        }
+    }
+}
+
+// Value of grid point j, `run` being the index of the run holding j - 1
+static inline unsigned char rle_value(const grid_rle_row *const row, long *const run, const long j) {
+    while (row->ends[*run] <= j) {
+        ++*run;
+    }
+    return row->first ^ (*run & 1);
+}
+
+void march_rle(ppm_image          *const image,
+               const grid_rle_row *const rows,
+               ppm_image    *const *const cmap,
+               cancel_token       *const cancel,
+               const long tid,
+               const long nthreads) {
+    const long p = image->x / STEP;
+    const long q = image->y / STEP;
+
+    const thread_slice slice = thread_get_slice(tid, nthreads, p);
+
+    for (long i = slice.start; i < slice.end; ++i) {
+        if ((i - slice.start) % (CANCEL_BAND_ROWS / STEP) == 0 && cancel_check(cancel)) {
+            return;
+        }
+
+        const grid_rle_row *const top    = &rows[i];
+        const grid_rle_row *const bottom = &rows[i + 1];
+        long                      t = 0, b = 0;
+        long                      j = 0;
+
+        while (j < q) {
+            // Grid points [j, end) have the same value on both rows
+            const unsigned char vt  = rle_value(top, &t, j);
+            const unsigned char vb  = rle_value(bottom, &b, j);
+            const long          end = MIN(top->ends[t], bottom->ends[b]);
+            const long          span = MIN(end, q + 1) - 1 - j;
+
+            if (span > 0) {
+                march_fill_span(image, cmap[12 * vt + 3 * vb], i * STEP, j * STEP, span);
+                j += span;
+            }
+            if (j >= q) {
+                break;
+            }
+
+            // The cell straddling the boundary
+            long t1 = t, b1 = b;
+            const unsigned char k = 8 * rle_value(top, &t, j)
+                                  + 4 * rle_value(top, &t1, j + 1)
+                                  + 2 * rle_value(bottom, &b1, j + 1)
+                                  +     rle_value(bottom, &b, j);
+            march_update(image, cmap[k], i * STEP, j * STEP);
+            ++j;
+        }
+    }
+}
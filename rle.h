@@ -0,0 +1,35 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef RLE_H
+#define RLE_H
+
+#include "helpers.h"
+#include "cancel.h"
+
+// A grid row stored as runs of identical values. Values are 0 or 1, so the
+// runs alternate and only the first value is kept.
+typedef struct {
+    unsigned char first;
+    long          nruns;
+    long         *ends;   // one past the last grid point of each run
+} grid_rle_row;
+
+// Same sampling and slicing as sample_grid, but each row is stored as runs.
+// Rows left out once `cancel` is cancelled keep the runs they had.
+void sample_grid_rle(grid_rle_row    *const rows,
+                     const ppm_image *const image,
+                     cancel_token    *const cancel,
+                     const long tid,
+                     const long nthreads);
+
+// Same as march, but only looks at the grid where one of the two rows of a
+// cell changes value. The cells in between all get the same tile, which is
+// copied along the whole span at once.
+void march_rle(ppm_image          *const image,
+               const grid_rle_row *const rows,
+               ppm_image    *const *const cmap,
+               cancel_token       *const cancel,
+               const long tid,
+               const long nthreads);
+
+#endif
@@ -0,0 +1,163 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "helpers.h"
+#include "marching.h"
+#include "sdf.h"
+
+#define SDF_INF 1e20f
+
+#define CLAMP(v, min, max) if (v < min) { v = min; } else if (v > max) { v = max; }
+
+sdf_field *sdf_alloc(const long rows, const long cols) {
+    sdf_field *const field = malloc(sizeof(sdf_field));
+
+    field->rows    = rows;
+    field->cols    = cols;
+    field->inside  = malloc(rows * cols * sizeof(float));
+    field->outside = malloc(rows * cols * sizeof(float));
+
+    return field;
+}
+
+// Squared distance transform of a sampled function, in linear time.
+// Source: Felzenszwalb & Huttenlocher, "Distance Transforms of Sampled Functions"
+static void edt_1d(const float *const f,
+                   float       *const d,
+                   const long         n,
+                   long        *const v,
+                   float       *const z) {
+    long k = 0;
+
+    v[0] = 0;
+    z[0] = -SDF_INF;
+    z[1] =  SDF_INF;
+
+    for (long q = 1; q < n; ++q) {
+        float s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+
+        // z[0] is never reached, so k can't go below 0
+        while (s <= z[k]) {
+            --k;
+            s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+        }
+
+        ++k;
+        v[k]     = q;
+        z[k]     = s;
+        z[k + 1] = SDF_INF;
+    }
+
+    k = 0;
+    for (long q = 0; q < n; ++q) {
+        while (z[k + 1] < q) {
+            ++k;
+        }
+        d[q] = (q - v[k]) * (q - v[k]) + f[v[k]];
+    }
+}
+
+void sdf_transform_rows(sdf_field *const field,
+                        unsigned char *const *const grid,
+                        const long tid,
+                        const long nthreads) {
+    const long         n     = field->cols;
+    const thread_slice slice = thread_get_slice(tid, nthreads, field->rows);
+
+    float *const f_in  = malloc(n * sizeof(float));
+    float *const f_out = malloc(n * sizeof(float));
+    float *const z     = malloc((n + 1) * sizeof(float));
+    long  *const v     = malloc(n * sizeof(long));
+
+    for (long i = slice.start; i < slice.end; ++i) {
+        for (long j = 0; j < n; ++j) {
+            f_in[j]  = grid[i][j] ? 0 : SDF_INF;
+            f_out[j] = grid[i][j] ? SDF_INF : 0;
+        }
+
+        edt_1d(f_in,  &field->inside[i * n],  n, v, z);
+        edt_1d(f_out, &field->outside[i * n], n, v, z);
+    }
+
+    free(f_in);
+    free(f_out);
+    free(z);
+    free(v);
+}
+
+void sdf_transform_columns(sdf_field *const field,
+                           const long tid,
+                           const long nthreads) {
+    const long         n     = field->rows;
+    const long         cols  = field->cols;
+    const thread_slice slice = thread_get_slice(tid, nthreads, cols);
+
+    float *const f_in  = malloc(n * sizeof(float));
+    float *const f_out = malloc(n * sizeof(float));
+    float *const d_in  = malloc(n * sizeof(float));
+    float *const d_out = malloc(n * sizeof(float));
+    float *const z     = malloc((n + 1) * sizeof(float));
+    long  *const v     = malloc(n * sizeof(long));
+
+    for (long j = slice.start; j < slice.end; ++j) {
+        for (long i = 0; i < n; ++i) {
+            f_in[i]  = field->inside[i * cols + j];
+            f_out[i] = field->outside[i * cols + j];
+        }
+
+        edt_1d(f_in,  d_in,  n, v, z);
+        edt_1d(f_out, d_out, n, v, z);
+
+        // Exactly one of the two distances is zero for every grid point
+        for (long i = 0; i < n; ++i) {
+            field->inside[i * cols + j] = (sqrtf(d_in[i]) - sqrtf(d_out[i])) * STEP;
+        }
+    }
+
+    free(f_in);
+    free(f_out);
+    free(d_in);
+    free(d_out);
+    free(z);
+    free(v);
+}
+
+void write_sdf(const sdf_field *const field, const char *filename) {
+    const size_t len = strlen(filename);
+    const int    pfm = len > 4 && !strcmp(filename + len - 4, ".pfm");
+    FILE *fp;
+
+    fp = fopen(filename, "wb");
+    if (!fp) {
+        fprintf(stderr, "Unable to open file '%s'\n", filename);
+        exit(1);
+    }
+
+    if (pfm) {
+        // Little endian floats, rows are stored from the bottom up
+        fprintf(fp, "Pf\n%ld %ld\n-1.0\n", field->cols, field->rows);
+        for (long i = field->rows - 1; i >= 0; --i) {
+            fwrite(&field->inside[i * field->cols], sizeof(float), field->cols, fp);
+        }
+    } else {
+        unsigned char *const row = malloc(field->cols);
+
+        fprintf(fp, "P5\n%ld %ld\n%d\n", field->cols, field->rows, RGB_COMPONENT_COLOR);
+        for (long i = 0; i < field->rows; ++i) {
+            for (long j = 0; j < field->cols; ++j) {
+                float value = 128.0f + field->inside[i * field->cols + j] * 127.0f / SDF_SPREAD;
+
+                CLAMP(value, 0.0f, 255.0f);
+                row[j] = (unsigned char) value;
+            }
+            fwrite(row, 1, field->cols, fp);
+        }
+        free(row);
+    }
+
+    fclose(fp);
+}
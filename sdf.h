@@ -0,0 +1,32 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef SDF_H
+#define SDF_H
+
+// Distances are written in output pixels, clamped to +/- SDF_SPREAD when
+// quantized to 8 bits
+#define SDF_SPREAD 64.0f
+
+typedef struct {
+    long   rows, cols;
+    float *inside;   // squared distance to the closest point set in the grid
+    float *outside;  // squared distance to the closest point not set
+} sdf_field;
+
+sdf_field *sdf_alloc(const long rows, const long cols);
+
+// Separable exact EDT: the rows pass must be finished by every thread before
+// the columns pass starts. The columns pass leaves the signed distance
+// (negative inside the contours) in `field->inside`.
+void sdf_transform_rows(sdf_field *const field,
+                        unsigned char *const *const grid,
+                        const long tid,
+                        const long nthreads);
+void sdf_transform_columns(sdf_field *const field,
+                           const long tid,
+                           const long nthreads);
+
+// Writes a PFM if the file name ends in ".pfm", an 8-bit PGM otherwise
+void write_sdf(const sdf_field *const field, const char *filename);
+
+#endif
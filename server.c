@@ -0,0 +1,572 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "marching.h"
+#include "pipeline.h"
+#include "server.h"
+#include "stream.h"
+
+// How often a connection waiting for its job checks that the client is
+// still there
+#define SERVER_HANGUP_POLL_MS 20
+
+// One computation, shared by the requests for the same image that arrive
+// while it is queued or running. The last of them to be answered frees it,
+// or the dispatcher when they all left before it was done.
+typedef struct server_job {
+    ppm_image         *image;
+    ppm_image         *result;
+    uint64_t           hash;         // of the image, to find the identical jobs
+    int                priority;     // the highest of its requests
+    cancel_token       cancel;       // past the first budget, or every client left
+    struct timespec    started, finished;
+    int                done;
+    long               waiting;      // requests not answered yet
+    struct server_job *next;
+} server_job;
+
+typedef struct server_connection {
+    struct server            *srv;
+    int                       fd;
+    struct server_connection *next;
+} server_connection;
+
+typedef struct server {
+    pthread_mutex_t    lock;
+    pthread_cond_t     queued;       // a job was queued, or the server stops
+    pthread_cond_t     done;         // a job ran or was answered, or a connection closed
+    server_job        *queue;        // by decreasing priority, then arrival
+    server_job        *running;
+    int                coalesce;     // identical requests share a job
+    long               pending;      // jobs queued, running or being answered
+    server_connection *connections;
+    int                stopping;
+    int                listen_fd;
+    FILE              *trace;
+    struct timespec    start;        // arrival of the first job traced
+    int                traced;
+    ppm_image        **cmap;
+    long               nthreads;
+    const backend     *engine;
+} server;
+
+static long elapsed_us(const struct timespec *const from, const struct timespec *const to) {
+    return (to->tv_sec - from->tv_sec) * 1000000L + (to->tv_nsec - from->tv_nsec) / 1000;
+}
+
+static void image_free(ppm_image *const image) {
+    free(image->data);
+    free(image);
+}
+
+// The result is the input itself when it isn't rescaled
+static void server_job_free(server_job *const job) {
+    if (job->result && job->result != job->image) {
+        image_free(job->result);
+    }
+    image_free(job->image);
+    free(job);
+}
+
+// FNV-1a over 8 bytes at a time, then the bytes left
+static uint64_t image_hash(const ppm_image *const image) {
+    const size_t               size  = (size_t) image->x * image->y * sizeof(ppm_pixel);
+    const unsigned char *const bytes = (const unsigned char *) image->data;
+    uint64_t                   hash  = 0xcbf29ce484222325ULL ^ ((uint64_t) image->x << 32 | image->y);
+    size_t                     i     = 0;
+
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+
+        memcpy(&word, &bytes[i], sizeof(word));
+        hash = (hash ^ word) * 0x100000001b3ULL;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static void server_queue_insert(server *const srv, server_job *const job) {
+    server_job **pos = &srv->queue;
+
+    while (*pos && (*pos)->priority >= job->priority) {
+        pos = &(*pos)->next;
+    }
+    job->next = *pos;
+    *pos      = job;
+}
+
+// Whether a request with the token `mine` can take the result of `job`:
+// the same image, and a job that won't be cancelled before the request's
+// own budget runs out. An image that isn't rescaled is marched in place, so
+// a running job only still holds its input when it is rescaled.
+static int server_job_matches(server_job *const job, const int running, const uint64_t hash,
+                              const ppm_image *const image, const cancel_token *const mine) {
+    const ppm_image *const other = job->image;
+
+    if (job->hash != hash || other->x != image->x || other->y != image->y
+        || (running && other->x <= RESCALE_X && other->y <= RESCALE_Y)
+        || cancel_check(&job->cancel)) {
+        return 0;
+    }
+    if (job->cancel.timed
+        && (!mine->timed || mine->deadline.tv_sec > job->cancel.deadline.tv_sec
+            || (mine->deadline.tv_sec == job->cancel.deadline.tv_sec
+                && mine->deadline.tv_nsec > job->cancel.deadline.tv_nsec))) {
+        return 0;
+    }
+    return !memcmp(other->data, image->data, (size_t) image->x * image->y * sizeof(ppm_pixel));
+}
+
+static void server_trace(server *const srv, const ppm_image *const image, const int priority,
+                         const long budget_ms, const struct timespec *const arrived) {
+    // Arrivals count from the first job, so that a replay starts right away
+    if (!srv->traced) {
+        srv->start  = *arrived;
+        srv->traced = 1;
+    }
+    fprintf(srv->trace, "%ld %d %d %d %ld\n", elapsed_us(&srv->start, arrived) / 1000,
+            image->x, image->y, priority, budget_ms);
+    fflush(srv->trace);
+}
+
+// Attaches the request to an identical job queued or running, or queues a
+// new one for `image`, which it then owns. Returns NULL once the server
+// stops, as nothing would run the job anymore.
+static server_job *server_enqueue(server *const srv, ppm_image *const image, const int priority,
+                                  const long budget_ms, const cancel_token *const mine,
+                                  const struct timespec *const arrived, int *const shared) {
+    const uint64_t hash = srv->coalesce ? image_hash(image) : 0;
+    server_job    *job  = NULL;
+
+    pthread_mutex_lock(&srv->lock);
+    if (srv->stopping) {
+        pthread_mutex_unlock(&srv->lock);
+        return NULL;
+    }
+
+    if (srv->coalesce) {
+        if (srv->running && server_job_matches(srv->running, 1, hash, image, mine)) {
+            job = srv->running;
+        }
+        for (server_job **pos = &srv->queue; *pos && !job; pos = &(*pos)->next) {
+            if (!server_job_matches(*pos, 0, hash, image, mine)) {
+                continue;
+            }
+            job = *pos;
+
+            // Moves up the queue to the highest priority waiting for it
+            if (priority > job->priority) {
+                *pos          = job->next;
+                job->priority = priority;
+                server_queue_insert(srv, job);
+            }
+            break;
+        }
+    }
+
+    *shared = job != NULL;
+    if (!job) {
+        job  = malloc(sizeof(server_job));
+        *job = (server_job) { .image = image, .hash = hash, .priority = priority };
+        cancel_init(&job->cancel, budget_ms);
+        server_queue_insert(srv, job);
+        pthread_cond_signal(&srv->queued);
+    }
+    ++job->waiting;
+    ++srv->pending;
+
+    if (srv->trace) {
+        server_trace(srv, image, priority, budget_ms, arrived);
+    }
+    pthread_mutex_unlock(&srv->lock);
+
+    if (*shared) {
+        image_free(image);
+    }
+    return job;
+}
+
+// Called with the lock held, once the request is answered or gave up
+static void server_job_release(server *const srv, server_job *const job) {
+    if (--job->waiting == 0) {
+        if (job->done) {
+            server_job_free(job);
+        } else {
+            cancel_request(&job->cancel);
+        }
+    }
+    --srv->pending;
+    pthread_cond_broadcast(&srv->done);
+}
+
+// Runs the queued jobs one at a time, each on every thread, until the
+// server stops and the queue is empty
+static void *server_dispatch(void *arg) {
+    server *const srv = arg;
+
+    pthread_mutex_lock(&srv->lock);
+    for (;;) {
+        while (!srv->queue && !srv->stopping) {
+            pthread_cond_wait(&srv->queued, &srv->lock);
+        }
+        if (!srv->queue) {
+            break;
+        }
+
+        server_job *const job = srv->queue;
+
+        srv->queue   = job->next;
+        srv->running = job;
+        pthread_mutex_unlock(&srv->lock);
+
+        // A job that expired in the queue, or that nobody waits for
+        // anymore, isn't started at all
+        clock_gettime(CLOCK_MONOTONIC, &job->started);
+        job->result = cancel_check(&job->cancel) ? NULL : pipeline_run(&(pipeline_job) {
+            .image    = job->image,
+            .cmap     = srv->cmap,
+            .nthreads = srv->nthreads,
+            .engine   = srv->engine,
+            .cancel   = &job->cancel
+        });
+        clock_gettime(CLOCK_MONOTONIC, &job->finished);
+
+        pthread_mutex_lock(&srv->lock);
+        srv->running = NULL;
+        job->done    = 1;
+        if (!job->waiting) {
+            server_job_free(job);
+        }
+        pthread_cond_broadcast(&srv->done);
+    }
+    pthread_mutex_unlock(&srv->lock);
+    return NULL;
+}
+
+static void server_stop(server *const srv) {
+    pthread_mutex_lock(&srv->lock);
+    srv->stopping = 1;
+    pthread_cond_signal(&srv->queued);
+    pthread_mutex_unlock(&srv->lock);
+
+    // Wakes up accept() in server_run()
+    shutdown(srv->listen_fd, SHUT_RDWR);
+}
+
+// Whether the peer of `fd` hung up, without consuming what it sent
+static int server_hung_up(const int fd) {
+    char c;
+
+    return recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) == 0;
+}
+
+// The budget counts from when the request arrives. A request past its
+// budget, or whose client hung up, stops waiting; the job is cancelled once
+// no request waits for it.
+static int server_job_request(server *const srv, FILE *const in, FILE *const out,
+                              const int priority, const long budget_ms) {
+    ppm_image *const image = stream_read_ppm(in);
+    cancel_token     mine;
+    struct timespec  arrived;
+    int              shared, hung_up = 0, expired = 0;
+
+    if (!image) {
+        fprintf(out, "ERR invalid image\n");
+        return -1;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &arrived);
+    cancel_init(&mine, budget_ms);
+
+    server_job *const job = server_enqueue(srv, image, priority, budget_ms, &mine, &arrived, &shared);
+
+    if (!job) {
+        image_free(image);
+        fprintf(out, "ERR stopping\n");
+        return -1;
+    }
+
+    pthread_mutex_lock(&srv->lock);
+    while (!job->done && !hung_up && !expired) {
+        struct timespec poll;
+
+        clock_gettime(CLOCK_REALTIME, &poll);
+        poll.tv_nsec += SERVER_HANGUP_POLL_MS * 1000000L;
+        poll.tv_sec  += poll.tv_nsec / 1000000000L;
+        poll.tv_nsec %= 1000000000L;
+        if (pthread_cond_timedwait(&srv->done, &srv->lock, &poll) == ETIMEDOUT) {
+            hung_up = server_hung_up(fileno(in));
+            expired = cancel_check(&mine);
+        }
+    }
+    pthread_mutex_unlock(&srv->lock);
+
+    // The connection outlives a request past its budget
+    int rc = -1;
+
+    if (hung_up) {
+        // Nobody to answer
+    } else if (expired || (!job->result && cancel_check(&job->cancel))) {
+        fprintf(out, "ERR deadline exceeded\n");
+        rc = fflush(out) ? -1 : 0;
+    } else if (!job->result) {
+        fprintf(out, "ERR the job failed\n");
+    } else {
+        // Counted from the arrival of this request, which may have joined
+        // the job while it ran
+        const long queue_us = elapsed_us(&arrived, &job->started);
+
+        fprintf(out, "OK %ld %ld %d\n", queue_us > 0 ? queue_us : 0,
+                elapsed_us(queue_us > 0 ? &job->started : &arrived, &job->finished), shared);
+        rc = stream_write_ppm(out, job->result);
+    }
+
+    pthread_mutex_lock(&srv->lock);
+    server_job_release(srv, job);
+    pthread_mutex_unlock(&srv->lock);
+    return rc;
+}
+
+static void *server_serve(void *arg) {
+    server_connection *const conn = arg;
+    server *const            srv  = conn->srv;
+    FILE *const              in   = fdopen(conn->fd, "r");
+    FILE *const              out  = fdopen(dup(conn->fd), "w");
+    char                     line[64];
+
+    while (fgets(line, sizeof(line), in)) {
+        int  priority;
+        long budget_ms = 0;
+
+        if (!strcmp(line, "QUIT\n")) {
+            // Answered first, as stopping hangs up on every connection
+            fprintf(out, "OK\n");
+            fflush(out);
+            server_stop(srv);
+            break;
+        }
+        if (sscanf(line, "JOB %d %ld", &priority, &budget_ms) < 1 || budget_ms < 0) {
+            fprintf(out, "ERR unknown request\n");
+            break;
+        }
+        if (server_job_request(srv, in, out, priority, budget_ms)) {
+            break;
+        }
+    }
+
+    pthread_mutex_lock(&srv->lock);
+    for (server_connection **pos = &srv->connections; *pos; pos = &(*pos)->next) {
+        if (*pos == conn) {
+            *pos = conn->next;
+            break;
+        }
+    }
+    pthread_cond_broadcast(&srv->done);
+    pthread_mutex_unlock(&srv->lock);
+
+    fclose(in);
+    fclose(out);
+    free(conn);
+    return NULL;
+}
+
+int server_run(const char    *socket_path,
+               const char    *filename_trace,
+               const int      coalesce,
+               const long     nthreads,
+               const backend *engine,
+               ppm_image    **cmap) {
+    server             srv  = { .coalesce = coalesce, .nthreads = nthreads, .engine = engine,
+                                .cmap = cmap };
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+
+    if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "Socket path '%s' is too long\n", socket_path);
+        exit(1);
+    }
+    strcpy(addr.sun_path, socket_path);
+
+    // A client hanging up must not take the server down
+    signal(SIGPIPE, SIG_IGN);
+
+    srv.listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(socket_path);
+    if (srv.listen_fd < 0 || bind(srv.listen_fd, (struct sockaddr *) &addr, sizeof(addr))
+        || listen(srv.listen_fd, SOMAXCONN)) {
+        perror(socket_path);
+        exit(1);
+    }
+
+    if (filename_trace && !(srv.trace = fopen(filename_trace, "w"))) {
+        fprintf(stderr, "Unable to open file '%s'\n", filename_trace);
+        exit(1);
+    }
+
+    // The tiles are loaded once, for every job
+    if (!srv.cmap) {
+        srv.cmap = malloc(CONTOUR_CONFIG_COUNT * sizeof(ppm_image *));
+        init_cmap(srv.cmap, 0, 1);
+    }
+
+    pthread_t dispatcher;
+
+    pthread_mutex_init(&srv.lock, NULL);
+    pthread_cond_init(&srv.queued, NULL);
+    pthread_cond_init(&srv.done, NULL);
+    pthread_create(&dispatcher, NULL, server_dispatch, &srv);
+
+    for (;;) {
+        const int fd = accept(srv.listen_fd, NULL, NULL);
+
+        if (fd < 0) {
+            pthread_mutex_lock(&srv.lock);
+            const int stopping = srv.stopping;
+            pthread_mutex_unlock(&srv.lock);
+
+            if (stopping) {
+                break;
+            }
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            perror(socket_path);
+            exit(1);
+        }
+
+        server_connection *const conn = malloc(sizeof(server_connection));
+        pthread_t                thread;
+
+        conn->srv = &srv;
+        conn->fd  = fd;
+
+        pthread_mutex_lock(&srv.lock);
+        conn->next      = srv.connections;
+        srv.connections = conn;
+        pthread_mutex_unlock(&srv.lock);
+
+        pthread_create(&thread, NULL, server_serve, conn);
+        pthread_detach(thread);
+    }
+
+    // Jobs already queued are still answered. Idle connections are hung up
+    // on, as the server won't take jobs anymore.
+    pthread_join(dispatcher, NULL);
+
+    pthread_mutex_lock(&srv.lock);
+    while (srv.pending) {
+        pthread_cond_wait(&srv.done, &srv.lock);
+    }
+    for (server_connection *conn = srv.connections; conn; conn = conn->next) {
+        shutdown(conn->fd, SHUT_RDWR);
+    }
+    while (srv.connections) {
+        pthread_cond_wait(&srv.done, &srv.lock);
+    }
+    pthread_mutex_unlock(&srv.lock);
+
+    pthread_cond_destroy(&srv.done);
+    pthread_cond_destroy(&srv.queued);
+    pthread_mutex_destroy(&srv.lock);
+    close(srv.listen_fd);
+    unlink(socket_path);
+    if (srv.trace) {
+        fclose(srv.trace);
+    }
+    if (!cmap) {
+        for (long k = 0; k < CONTOUR_CONFIG_COUNT; ++k) {
+            image_free(srv.cmap[k]);
+        }
+        free(srv.cmap);
+    }
+    return 0;
+}
+
+server_client *server_connect(const char *socket_path) {
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+    const int          fd   = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (fd < 0 || strlen(socket_path) >= sizeof(addr.sun_path)) {
+        return NULL;
+    }
+    strcpy(addr.sun_path, socket_path);
+    if (connect(fd, (struct sockaddr *) &addr, sizeof(addr))) {
+        close(fd);
+        return NULL;
+    }
+
+    server_client *const client = malloc(sizeof(server_client));
+
+    client->fd  = fd;
+    client->in  = fdopen(fd, "r");
+    client->out = fdopen(dup(fd), "w");
+    return client;
+}
+
+void server_disconnect(server_client *const client) {
+    fclose(client->in);
+    fclose(client->out);
+    free(client);
+}
+
+ppm_image *server_request(server_client   *const client,
+                          const int              priority,
+                          const long             budget_ms,
+                          const ppm_image *const image,
+                          long            *const queue_us,
+                          long            *const run_us,
+                          server_status   *const status) {
+    char line[64];
+    long queued, ran;
+    int  shared;
+
+    if (status) {
+        *status = SERVER_FAILED;
+    }
+    if (budget_ms) {
+        fprintf(client->out, "JOB %d %ld\n", priority, budget_ms);
+    } else {
+        fprintf(client->out, "JOB %d\n", priority);
+    }
+    if (stream_write_ppm(client->out, image) || !fgets(line, sizeof(line), client->in)) {
+        return NULL;
+    }
+    if (!strcmp(line, "ERR deadline exceeded\n")) {
+        if (status) {
+            *status = SERVER_EXPIRED;
+        }
+        return NULL;
+    }
+    if (sscanf(line, "OK %ld %ld %d", &queued, &ran, &shared) != 3) {
+        return NULL;
+    }
+    if (status) {
+        *status = shared ? SERVER_SHARED : SERVER_RAN;
+    }
+    if (queue_us) {
+        *queue_us = queued;
+    }
+    if (run_us) {
+        *run_us = ran;
+    }
+    return stream_read_ppm(client->in);
+}
+
+int server_quit(server_client *const client) {
+    char line[64];
+
+    fprintf(client->out, "QUIT\n");
+    fflush(client->out);
+    return fgets(line, sizeof(line), client->in) && !strcmp(line, "OK\n") ? 0 : -1;
+}
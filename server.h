@@ -0,0 +1,67 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <stdio.h>
+
+#include "helpers.h"
+#include "backend.h"
+
+// Serves marching jobs on the Unix socket `socket_path` until a client asks
+// it to quit. A connection sends any number of requests, one at a time:
+//
+//   JOB <priority> [<budget_ms>]\n<P6 image>
+//                               answered by  OK <queue_us> <run_us> <shared>\n<P6 image>
+//   QUIT\n                      answered by  OK\n
+//
+// or gets "ERR <reason>\n" before the server hangs up. Jobs wait in a queue,
+// highest priority first and then in order of arrival, and run one at a time
+// on `nthreads` threads; the times are what the job spent in the queue and
+// running. A job still unfinished `budget_ms` after it was queued, or whose
+// client hung up, is cancelled and answered "ERR deadline exceeded\n",
+// without hanging up. With `coalesce`, a job for the same image as one
+// queued or running joins it instead, and gets its result with <shared> set
+// to 1; the job is moved up to the highest priority waiting for it, and
+// only cancelled once every client waiting for it left. When
+// `filename_trace` is set, every job is appended to it as
+// "<arrival_ms> <width> <height> <priority> <budget_ms>", for loadgen to
+// replay. The tiles are read from ./contours when `cmap` is NULL.
+int server_run(const char    *socket_path,
+               const char    *filename_trace,
+               const int      coalesce,
+               const long     nthreads,
+               const backend *engine,
+               ppm_image    **cmap);
+
+typedef enum {
+    SERVER_FAILED,
+    SERVER_RAN,
+    SERVER_SHARED,   // the result of an identical job
+    SERVER_EXPIRED,  // out of budget, the connection can still be used
+} server_status;
+
+// One connection to a server, for its clients
+typedef struct {
+    int   fd;
+    FILE *in, *out;
+} server_client;
+
+// NULL if nothing listens on `socket_path`
+server_client *server_connect(const char *socket_path);
+void           server_disconnect(server_client *const client);
+
+// Sends `image` as a job, with a budget unless `budget_ms` is 0, and waits
+// for the result, or returns NULL if the server failed it. The times the
+// server reports go to `queue_us` and `run_us`, and how the job went to
+// `status`, when not NULL.
+ppm_image *server_request(server_client   *const client,
+                          const int              priority,
+                          const long             budget_ms,
+                          const ppm_image *const image,
+                          long            *const queue_us,
+                          long            *const run_us,
+                          server_status   *const status);
+int        server_quit(server_client *const client);
+
+#endif
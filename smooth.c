@@ -0,0 +1,120 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "marching.h"
+#include "overlay.h"
+#include "smooth.h"
+#include "smooth_table.h"
+
+void smooth_palette(ppm_image *const *const cmap, ppm_pixel *const palette) {
+    const ppm_image *const c    = cmap[1];
+    long                   best = 0;
+
+    palette[SMOOTH_OUTSIDE] = cmap[0]->data[0];
+    palette[SMOOTH_INSIDE]  = cmap[CONTOUR_CONFIG_COUNT - 1]->data[0];
+    palette[SMOOTH_LINE]    = c->data[0];
+
+    for (int i = 0; i < c->x * c->y; ++i) {
+        long count = 0;
+
+        if (!overlay_is_contour(cmap, c->data[i])) {
+            continue;
+        }
+        for (int j = 0; j < c->x * c->y; ++j) {
+            count += !memcmp(&c->data[i], &c->data[j], sizeof(ppm_pixel));
+        }
+        if (count > best) {
+            best                 = count;
+            palette[SMOOTH_LINE] = c->data[i];
+        }
+    }
+}
+
+void sample_grid_luminance(unsigned char  **const grid,
+                           const ppm_image *const image,
+                           cancel_token    *const cancel,
+                           const long tid,
+                           const long nthreads) {
+    const long         p     = image->x / STEP;
+    const long         q     = image->y / STEP;
+    const thread_slice slice = thread_get_slice(tid, nthreads, p);
+
+    for (long i = slice.start; i < slice.end; ++i) {
+        if ((i - slice.start) % (CANCEL_BAND_ROWS / STEP) == 0 && cancel_check(cancel)) {
+            return;
+        }
+        for (long j = 0; j <= q; ++j) {
+            grid[i][j] = pixel_luminance(image->data[grid_sample_offset(image, i, j)]);
+        }
+    }
+
+    // Task reserved for the thread having the last slice of the range
+    if (tid == nthreads - 1 && !cancel_check(cancel)) {
+        for (long j = 0; j <= q; ++j) {
+            grid[p][j] = pixel_luminance(image->data[grid_sample_offset(image, p, j)]);
+        }
+    }
+}
+
+void smooth_render_tiles(ppm_image       *const tiles,
+                         ppm_image *const *const cmap,
+                         const long tid,
+                         const long nthreads) {
+    const thread_slice slice = thread_get_slice(tid, nthreads,
+                                                CONTOUR_CONFIG_COUNT * SMOOTH_VARIANTS);
+    ppm_pixel          palette[SMOOTH_COLORS];
+
+    smooth_palette(cmap, palette);
+
+    for (long v = slice.start; v < slice.end; ++v) {
+        const uint64_t inside = smooth_table[v][0];
+        const uint64_t line   = smooth_table[v][1];
+
+        tiles[v].x    = STEP;
+        tiles[v].y    = STEP;
+        tiles[v].data = malloc(STEP * STEP * sizeof(ppm_pixel));
+
+        for (int b = 0; b < STEP * STEP; ++b) {
+            tiles[v].data[b] = palette[line >> b & 1 ? SMOOTH_LINE
+                                       : inside >> b & 1 ? SMOOTH_INSIDE : SMOOTH_OUTSIDE];
+        }
+    }
+}
+
+void march_smooth(ppm_image       *const image,
+                  unsigned char   *const *const grid,
+                  const ppm_image *const tiles,
+                  cancel_token    *const cancel,
+                  const long tid,
+                  const long nthreads) {
+    const long p = image->x / STEP;
+    const long q = image->y / STEP;
+
+    const thread_slice slice = thread_get_slice(tid, nthreads, p);
+
+    for (long i = slice.start; i < slice.end; ++i) {
+        if ((i - slice.start) % (CANCEL_BAND_ROWS / STEP) == 0 && cancel_check(cancel)) {
+            return;
+        }
+
+        const unsigned char *const top    = grid[i];
+        const unsigned char *const bottom = grid[i + 1];
+
+        for (long j = 0; j < q; ++j) {
+            const int k = 8 * (top[j] <= SIGMA)
+                        + 4 * (top[j + 1] <= SIGMA)
+                        + 2 * (bottom[j + 1] <= SIGMA)
+                        +     (bottom[j] <= SIGMA);
+            const int levels[4] = {
+                smooth_level(top[j],        top[j + 1]),
+                smooth_level(top[j + 1],    bottom[j + 1]),
+                smooth_level(bottom[j],     bottom[j + 1]),
+                smooth_level(top[j],        bottom[j])
+            };
+
+            march_update(image, &tiles[smooth_variant(k, levels)], i * STEP, j * STEP);
+        }
+    }
+}
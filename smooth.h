@@ -0,0 +1,145 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef SMOOTH_H
+#define SMOOTH_H
+
+#include <math.h>
+#include <stdint.h>
+
+#include "helpers.h"
+#include "cancel.h"
+
+// Levels the crossing point of a cell edge is quantized to, and the number
+// of tile variants per configuration (one level for each of the 4 edges)
+#define SMOOTH_LEVELS     4
+#define SMOOTH_VARIANTS   (SMOOTH_LEVELS * SMOOTH_LEVELS * SMOOTH_LEVELS * SMOOTH_LEVELS)
+#define SMOOTH_LINE_WIDTH 1.5f
+
+// The generated table holds one bit per tile pixel
+_Static_assert(STEP * STEP <= 64, "smooth tiles need STEP <= 8");
+
+enum {
+    SMOOTH_OUTSIDE,
+    SMOOTH_INSIDE,
+    SMOOTH_LINE,
+    SMOOTH_COLORS
+};
+
+// Quantized position of the threshold crossing between two grid points, or
+// 0 if there is none
+static inline int smooth_level(const unsigned char la, const unsigned char lb) {
+    if ((la <= SIGMA) == (lb <= SIGMA)) {
+        return 0;
+    }
+
+    const int level = (SIGMA + 0.5f - la) / (lb - la) * SMOOTH_LEVELS;
+
+    return level < 0 ? 0 : level >= SMOOTH_LEVELS ? SMOOTH_LEVELS - 1 : level;
+}
+
+// Index of the tile variant for configuration `k` and the levels of the top,
+// right, bottom and left edges
+static inline long smooth_variant(const int k, const int *const levels) {
+    return (((k * SMOOTH_LEVELS + levels[0]) * SMOOTH_LEVELS + levels[1])
+            * SMOOTH_LEVELS + levels[2]) * SMOOTH_LEVELS + levels[3];
+}
+
+// Whether X lies left of the line going from P to Q
+static inline int smooth_side(const float *const p, const float *const q, const float *const x) {
+    return (q[0] - p[0]) * (x[1] - p[1]) - (q[1] - p[1]) * (x[0] - p[0]) > 0;
+}
+
+static inline float smooth_distance(const float *const p, const float *const q, const float *const x) {
+    const float dr = q[0] - p[0], dc = q[1] - p[1];
+    const float len = dr * dr + dc * dc;
+    float       t   = len > 0 ? ((x[0] - p[0]) * dr + (x[1] - p[1]) * dc) / len : 0;
+
+    t = t < 0 ? 0 : t > 1 ? 1 : t;
+    return hypotf(x[0] - p[0] - t * dr, x[1] - p[1] - t * dc);
+}
+
+// Colour class of pixel (r, c) of the tile for configuration `k`, the
+// contour crossing the edges at the given levels. Both the table generator
+// and pipeline_reference() use it.
+static inline int smooth_classify(const int k, const int *const levels, const int r, const int c) {
+    // Corners TL, TR, BR, BL, matching the bits of `k` from the highest, and
+    // edges top, right, bottom, left as pairs of corners
+    static const float corners[4][2] = { { 0, 0 }, { 0, STEP }, { STEP, STEP }, { STEP, 0 } };
+    static const int   edges[4][2]   = { { 0, 1 }, { 1, 2 }, { 3, 2 }, { 0, 3 } };
+    // The two edges next to each corner
+    static const int   around[4][2]  = { { 0, 3 }, { 0, 1 }, { 1, 2 }, { 2, 3 } };
+
+    float cross[4][2];
+    int   chords[2][2], nchords = 0, crossed[4], ncrossed = 0;
+
+    for (int e = 0; e < 4; ++e) {
+        const float *const a = corners[edges[e][0]];
+        const float *const b = corners[edges[e][1]];
+        const float        t = (levels[e] + 0.5f) / SMOOTH_LEVELS;
+
+        cross[e][0] = a[0] + t * (b[0] - a[0]);
+        cross[e][1] = a[1] + t * (b[1] - a[1]);
+        if ((k >> (3 - edges[e][0]) & 1) != (k >> (3 - edges[e][1]) & 1)) {
+            crossed[ncrossed++] = e;
+        }
+    }
+
+    if (ncrossed == 2) {
+        chords[nchords][0]   = crossed[0];
+        chords[nchords++][1] = crossed[1];
+    } else if (ncrossed == 4) {
+        // Saddle: the inside corners are cut off on their own
+        for (int n = 0; n < 4; ++n) {
+            if (k >> (3 - n) & 1) {
+                chords[nchords][0]   = around[n][0];
+                chords[nchords++][1] = around[n][1];
+            }
+        }
+    }
+
+    const float x[2]   = { r + 0.5f, c + 0.5f };
+    const int   corner = x[0] < STEP / 2.0f ? (x[1] < STEP / 2.0f ? 0 : 1)
+                                            : (x[1] < STEP / 2.0f ? 3 : 2);
+    int         inside = k >> (3 - corner) & 1;
+
+    for (int n = 0; n < nchords; ++n) {
+        const float *const p = cross[chords[n][0]];
+        const float *const q = cross[chords[n][1]];
+
+        if (smooth_distance(p, q, x) <= SMOOTH_LINE_WIDTH / 2) {
+            return SMOOTH_LINE;
+        }
+        inside ^= smooth_side(p, q, x) != smooth_side(p, q, corners[corner]);
+    }
+
+    return inside ? SMOOTH_INSIDE : SMOOTH_OUTSIDE;
+}
+
+// Outside and inside colours of tiles 0 and 15, and the most common contour
+// colour of tile 1
+void smooth_palette(ppm_image *const *const cmap, ppm_pixel *const palette);
+
+// Same as sample_grid, but keeps the luminance of the grid points
+void sample_grid_luminance(unsigned char  **const grid,
+                           const ppm_image *const image,
+                           cancel_token    *const cancel,
+                           const long tid,
+                           const long nthreads);
+
+// Paints the CONTOUR_CONFIG_COUNT * SMOOTH_VARIANTS tiles from the
+// generated table
+void smooth_render_tiles(ppm_image       *const tiles,
+                         ppm_image *const *const cmap,
+                         const long tid,
+                         const long nthreads);
+
+// Same as march, with the tile variant matching the crossing points of each
+// cell. `grid` holds luminances.
+void march_smooth(ppm_image       *const image,
+                  unsigned char   *const *const grid,
+                  const ppm_image *const tiles,
+                  cancel_token    *const cancel,
+                  const long tid,
+                  const long nthreads);
+
+#endif
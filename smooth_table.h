@@ -0,0 +1,4108 @@
+/* Generated by gen_smooth, do not edit */
+
+#ifndef SMOOTH_TABLE_H
+#define SMOOTH_TABLE_H
+
+#include <stdint.h>
+
+// Bit r * STEP + c of each entry: pixel (r, c) is inside, is on the line
+static const uint64_t smooth_table[4096][2] = {
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0000000000000000 },
+    { 0x0000000000000000, 0x0303010101010101 },
+    { 0x0000000000000000, 0x0301010101010000 },
+    { 0x0000000000000000, 0x0301010100000000 },
+    { 0x0000000000000000, 0x0301000000000000 },
+    { 0x0303010100000000, 0x0c04060203010101 },
+    { 0x0301010000000000, 0x0c06020301010000 },
+    { 0x0100000000000000, 0x0e07030100000000 },
+    { 0x0000000000000000, 0x0f01000000000000 },
+    { 0x0f07030301000000, 0x30180c0406030101 },
+    { 0x0703010000000000, 0x381c0e0703010000 },
+    { 0x0701000000000000, 0x380e030100000000 },
+    { 0x0000000000000000, 0x3f01000000000000 },
+    { 0x1f0f070301000000, 0xe070381c0e070301 },
+    { 0x1f0f030100000000, 0xe0301c0603010000 },
+    { 0x0f03000000000000, 0xf01c070100000000 },
+    { 0x0000000000000000, 0xff03000000000000 },
+    { 0x0000000000000000, 0x0303010101010101 },
+    { 0x0000000000000000, 0x0301010101010000 },
+    { 0x0000000000000000, 0x0301010100000000 },
+    { 0x0000000000000000, 0x0301000000000000 },
+    { 0x0303010100000000, 0x0c04060203010101 },
+    { 0x0301010000000000, 0x0c06020301010000 },
+    { 0x0100000000000000, 0x0e07030100000000 },
+    { 0x0000000000000000, 0x0f01000000000000 },
+    { 0x0f07030301000000, 0x30180c0406030101 },
+    { 0x0703010000000000, 0x381c0e0703010000 },
+    { 0x0701000000000000, 0x380e030100000000 },
+    { 0x0000000000000000, 0x3f01000000000000 },
+    { 0x1f0f070301000000, 0xe070381c0e070301 },
+    { 0x1f0f030100000000, 0xe0301c0603010000 },
+    { 0x0f03000000000000, 0xf01c070100000000 },
+    { 0x0000000000000000, 0xff03000000000000 },
+    { 0x0000000000000000, 0x0303010101010101 },
+    { 0x0000000000000000, 0x0301010101010000 },
+    { 0x0000000000000000, 0x0301010100000000 },
+    { 0x0000000000000000, 0x0301000000000000 },
+    { 0x0303010100000000, 0x0c04060203010101 },
+    { 0x0301010000000000, 0x0c06020301010000 },
+    { 0x0100000000000000, 0x0e07030100000000 },
+    { 0x0000000000000000, 0x0f01000000000000 },
+    { 0x0f07030301000000, 0x30180c0406030101 },
+    { 0x0703010000000000, 0x381c0e0703010000 },
+    { 0x0701000000000000, 0x380e030100000000 },
+    { 0x0000000000000000, 0x3f01000000000000 },
+    { 0x1f0f070301000000, 0xe070381c0e070301 },
+    { 0x1f0f030100000000, 0xe0301c0603010000 },
+    { 0x0f03000000000000, 0xf01c070100000000 },
+    { 0x0000000000000000, 0xff03000000000000 },
+    { 0x0000000000000000, 0x0303010101010101 },
+    { 0x0000000000000000, 0x0301010101010000 },
+    { 0x0000000000000000, 0x0301010100000000 },
+    { 0x0000000000000000, 0x0301000000000000 },
+    { 0x0303010100000000, 0x0c04060203010101 },
+    { 0x0301010000000000, 0x0c06020301010000 },
+    { 0x0100000000000000, 0x0e07030100000000 },
+    { 0x0000000000000000, 0x0f01000000000000 },
+    { 0x0f07030301000000, 0x30180c0406030101 },
+    { 0x0703010000000000, 0x381c0e0703010000 },
+    { 0x0701000000000000, 0x380e030100000000 },
+    { 0x0000000000000000, 0x3f01000000000000 },
+    { 0x1f0f070301000000, 0xe070381c0e070301 },
+    { 0x1f0f030100000000, 0xe0301c0603010000 },
+    { 0x0f03000000000000, 0xf01c070100000000 },
+    { 0x0000000000000000, 0xff03000000000000 },
+    { 0x0000000000000000, 0x0303010101010101 },
+    { 0x0000000000000000, 0x0301010101010000 },
+    { 0x0000000000000000, 0x0301010100000000 },
+    { 0x0000000000000000, 0x0301000000000000 },
+    { 0x0303010100000000, 0x0c04060203010101 },
+    { 0x0301010000000000, 0x0c06020301010000 },
+    { 0x0100000000000000, 0x0e07030100000000 },
+    { 0x0000000000000000, 0x0f01000000000000 },
+    { 0x0f07030301000000, 0x30180c0406030101 },
+    { 0x0703010000000000, 0x381c0e0703010000 },
+    { 0x0701000000000000, 0x380e030100000000 },
+    { 0x0000000000000000, 0x3f01000000000000 },
+    { 0x1f0f070301000000, 0xe070381c0e070301 },
+    { 0x1f0f030100000000, 0xe0301c0603010000 },
+    { 0x0f03000000000000, 0xf01c070100000000 },
+    { 0x0000000000000000, 0xff03000000000000 },
+    { 0x0000000000000000, 0x0303010101010101 },
+    { 0x0000000000000000, 0x0301010101010000 },
+    { 0x0000000000000000, 0x0301010100000000 },
+    { 0x0000000000000000, 0x0301000000000000 },
+    { 0x0303010100000000, 0x0c04060203010101 },
+    { 0x0301010000000000, 0x0c06020301010000 },
+    { 0x0100000000000000, 0x0e07030100000000 },
+    { 0x0000000000000000, 0x0f01000000000000 },
+    { 0x0f07030301000000, 0x30180c0406030101 },
+    { 0x0703010000000000, 0x381c0e0703010000 },
+    { 0x0701000000000000, 0x380e030100000000 },
+    { 0x0000000000000000, 0x3f01000000000000 },
+    { 0x1f0f070301000000, 0xe070381c0e070301 },
+    { 0x1f0f030100000000, 0xe0301c0603010000 },
+    { 0x0f03000000000000, 0xf01c070100000000 },
+    { 0x0000000000000000, 0xff03000000000000 },
+    { 0x0000000000000000, 0x0303010101010101 },
+    { 0x0000000000000000, 0x0301010101010000 },
+    { 0x0000000000000000, 0x0301010100000000 },
+    { 0x0000000000000000, 0x0301000000000000 },
+    { 0x0303010100000000, 0x0c04060203010101 },
+    { 0x0301010000000000, 0x0c06020301010000 },
+    { 0x0100000000000000, 0x0e07030100000000 },
+    { 0x0000000000000000, 0x0f01000000000000 },
+    { 0x0f07030301000000, 0x30180c0406030101 },
+    { 0x0703010000000000, 0x381c0e0703010000 },
+    { 0x0701000000000000, 0x380e030100000000 },
+    { 0x0000000000000000, 0x3f01000000000000 },
+    { 0x1f0f070301000000, 0xe070381c0e070301 },
+    { 0x1f0f030100000000, 0xe0301c0603010000 },
+    { 0x0f03000000000000, 0xf01c070100000000 },
+    { 0x0000000000000000, 0xff03000000000000 },
+    { 0x0000000000000000, 0x0303010101010101 },
+    { 0x0000000000000000, 0x0301010101010000 },
+    { 0x0000000000000000, 0x0301010100000000 },
+    { 0x0000000000000000, 0x0301000000000000 },
+    { 0x0303010100000000, 0x0c04060203010101 },
+    { 0x0301010000000000, 0x0c06020301010000 },
+    { 0x0100000000000000, 0x0e07030100000000 },
+    { 0x0000000000000000, 0x0f01000000000000 },
+    { 0x0f07030301000000, 0x30180c0406030101 },
+    { 0x0703010000000000, 0x381c0e0703010000 },
+    { 0x0701000000000000, 0x380e030100000000 },
+    { 0x0000000000000000, 0x3f01000000000000 },
+    { 0x1f0f070301000000, 0xe070381c0e070301 },
+    { 0x1f0f030100000000, 0xe0301c0603010000 },
+    { 0x0f03000000000000, 0xf01c070100000000 },
+    { 0x0000000000000000, 0xff03000000000000 },
+    { 0x0000000000000000, 0x0303010101010101 },
+    { 0x0000000000000000, 0x0301010101010000 },
+    { 0x0000000000000000, 0x0301010100000000 },
+    { 0x0000000000000000, 0x0301000000000000 },
+    { 0x0303010100000000, 0x0c04060203010101 },
+    { 0x0301010000000000, 0x0c06020301010000 },
+    { 0x0100000000000000, 0x0e07030100000000 },
+    { 0x0000000000000000, 0x0f01000000000000 },
+    { 0x0f07030301000000, 0x30180c0406030101 },
+    { 0x0703010000000000, 0x381c0e0703010000 },
+    { 0x0701000000000000, 0x380e030100000000 },
+    { 0x0000000000000000, 0x3f01000000000000 },
+    { 0x1f0f070301000000, 0xe070381c0e070301 },
+    { 0x1f0f030100000000, 0xe0301c0603010000 },
+    { 0x0f03000000000000, 0xf01c070100000000 },
+    { 0x0000000000000000, 0xff03000000000000 },
+    { 0x0000000000000000, 0x0303010101010101 },
+    { 0x0000000000000000, 0x0301010101010000 },
+    { 0x0000000000000000, 0x0301010100000000 },
+    { 0x0000000000000000, 0x0301000000000000 },
+    { 0x0303010100000000, 0x0c04060203010101 },
+    { 0x0301010000000000, 0x0c06020301010000 },
+    { 0x0100000000000000, 0x0e07030100000000 },
+    { 0x0000000000000000, 0x0f01000000000000 },
+    { 0x0f07030301000000, 0x30180c0406030101 },
+    { 0x0703010000000000, 0x381c0e0703010000 },
+    { 0x0701000000000000, 0x380e030100000000 },
+    { 0x0000000000000000, 0x3f01000000000000 },
+    { 0x1f0f070301000000, 0xe070381c0e070301 },
+    { 0x1f0f030100000000, 0xe0301c0603010000 },
+    { 0x0f03000000000000, 0xf01c070100000000 },
+    { 0x0000000000000000, 0xff03000000000000 },
+    { 0x0000000000000000, 0x0303010101010101 },
+    { 0x0000000000000000, 0x0301010101010000 },
+    { 0x0000000000000000, 0x0301010100000000 },
+    { 0x0000000000000000, 0x0301000000000000 },
+    { 0x0303010100000000, 0x0c04060203010101 },
+    { 0x0301010000000000, 0x0c06020301010000 },
+    { 0x0100000000000000, 0x0e07030100000000 },
+    { 0x0000000000000000, 0x0f01000000000000 },
+    { 0x0f07030301000000, 0x30180c0406030101 },
+    { 0x0703010000000000, 0x381c0e0703010000 },
+    { 0x0701000000000000, 0x380e030100000000 },
+    { 0x0000000000000000, 0x3f01000000000000 },
+    { 0x1f0f070301000000, 0xe070381c0e070301 },
+    { 0x1f0f030100000000, 0xe0301c0603010000 },
+    { 0x0f03000000000000, 0xf01c070100000000 },
+    { 0x0000000000000000, 0xff03000000000000 },
+    { 0x0000000000000000, 0x0303010101010101 },
+    { 0x0000000000000000, 0x0301010101010000 },
+    { 0x0000000000000000, 0x0301010100000000 },
+    { 0x0000000000000000, 0x0301000000000000 },
+    { 0x0303010100000000, 0x0c04060203010101 },
+    { 0x0301010000000000, 0x0c06020301010000 },
+    { 0x0100000000000000, 0x0e07030100000000 },
+    { 0x0000000000000000, 0x0f01000000000000 },
+    { 0x0f07030301000000, 0x30180c0406030101 },
+    { 0x0703010000000000, 0x381c0e0703010000 },
+    { 0x0701000000000000, 0x380e030100000000 },
+    { 0x0000000000000000, 0x3f01000000000000 },
+    { 0x1f0f070301000000, 0xe070381c0e070301 },
+    { 0x1f0f030100000000, 0xe0301c0603010000 },
+    { 0x0f03000000000000, 0xf01c070100000000 },
+    { 0x0000000000000000, 0xff03000000000000 },
+    { 0x0000000000000000, 0x0303010101010101 },
+    { 0x0000000000000000, 0x0301010101010000 },
+    { 0x0000000000000000, 0x0301010100000000 },
+    { 0x0000000000000000, 0x0301000000000000 },
+    { 0x0303010100000000, 0x0c04060203010101 },
+    { 0x0301010000000000, 0x0c06020301010000 },
+    { 0x0100000000000000, 0x0e07030100000000 },
+    { 0x0000000000000000, 0x0f01000000000000 },
+    { 0x0f07030301000000, 0x30180c0406030101 },
+    { 0x0703010000000000, 0x381c0e0703010000 },
+    { 0x0701000000000000, 0x380e030100000000 },
+    { 0x0000000000000000, 0x3f01000000000000 },
+    { 0x1f0f070301000000, 0xe070381c0e070301 },
+    { 0x1f0f030100000000, 0xe0301c0603010000 },
+    { 0x0f03000000000000, 0xf01c070100000000 },
+    { 0x0000000000000000, 0xff03000000000000 },
+    { 0x0000000000000000, 0x0303010101010101 },
+    { 0x0000000000000000, 0x0301010101010000 },
+    { 0x0000000000000000, 0x0301010100000000 },
+    { 0x0000000000000000, 0x0301000000000000 },
+    { 0x0303010100000000, 0x0c04060203010101 },
+    { 0x0301010000000000, 0x0c06020301010000 },
+    { 0x0100000000000000, 0x0e07030100000000 },
+    { 0x0000000000000000, 0x0f01000000000000 },
+    { 0x0f07030301000000, 0x30180c0406030101 },
+    { 0x0703010000000000, 0x381c0e0703010000 },
+    { 0x0701000000000000, 0x380e030100000000 },
+    { 0x0000000000000000, 0x3f01000000000000 },
+    { 0x1f0f070301000000, 0xe070381c0e070301 },
+    { 0x1f0f030100000000, 0xe0301c0603010000 },
+    { 0x0f03000000000000, 0xf01c070100000000 },
+    { 0x0000000000000000, 0xff03000000000000 },
+    { 0x0000000000000000, 0x0303010101010101 },
+    { 0x0000000000000000, 0x0301010101010000 },
+    { 0x0000000000000000, 0x0301010100000000 },
+    { 0x0000000000000000, 0x0301000000000000 },
+    { 0x0303010100000000, 0x0c04060203010101 },
+    { 0x0301010000000000, 0x0c06020301010000 },
+    { 0x0100000000000000, 0x0e07030100000000 },
+    { 0x0000000000000000, 0x0f01000000000000 },
+    { 0x0f07030301000000, 0x30180c0406030101 },
+    { 0x0703010000000000, 0x381c0e0703010000 },
+    { 0x0701000000000000, 0x380e030100000000 },
+    { 0x0000000000000000, 0x3f01000000000000 },
+    { 0x1f0f070301000000, 0xe070381c0e070301 },
+    { 0x1f0f030100000000, 0xe0301c0603010000 },
+    { 0x0f03000000000000, 0xf01c070100000000 },
+    { 0x0000000000000000, 0xff03000000000000 },
+    { 0x0000000000000000, 0x0303010101010101 },
+    { 0x0000000000000000, 0x0301010101010000 },
+    { 0x0000000000000000, 0x0301010100000000 },
+    { 0x0000000000000000, 0x0301000000000000 },
+    { 0x0303010100000000, 0x0c04060203010101 },
+    { 0x0301010000000000, 0x0c06020301010000 },
+    { 0x0100000000000000, 0x0e07030100000000 },
+    { 0x0000000000000000, 0x0f01000000000000 },
+    { 0x0f07030301000000, 0x30180c0406030101 },
+    { 0x0703010000000000, 0x381c0e0703010000 },
+    { 0x0701000000000000, 0x380e030100000000 },
+    { 0x0000000000000000, 0x3f01000000000000 },
+    { 0x1f0f070301000000, 0xe070381c0e070301 },
+    { 0x1f0f030100000000, 0xe0301c0603010000 },
+    { 0x0f03000000000000, 0xf01c070100000000 },
+    { 0x0000000000000000, 0xff03000000000000 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c080 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c080 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c080 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c080 },
+    { 0xf0e0c0c080000000, 0x0c18302060c08080 },
+    { 0xf0e0c0c080000000, 0x0c18302060c08080 },
+    { 0xf0e0c0c080000000, 0x0c18302060c08080 },
+    { 0xf0e0c0c080000000, 0x0c18302060c08080 },
+    { 0xc0c0808000000000, 0x30206040c0808080 },
+    { 0xc0c0808000000000, 0x30206040c0808080 },
+    { 0xc0c0808000000000, 0x30206040c0808080 },
+    { 0xc0c0808000000000, 0x30206040c0808080 },
+    { 0x0000000000000000, 0xc0c0808080808080 },
+    { 0x0000000000000000, 0xc0c0808080808080 },
+    { 0x0000000000000000, 0xc0c0808080808080 },
+    { 0x0000000000000000, 0xc0c0808080808080 },
+    { 0xf8f0c08000000000, 0x070c3860c0800000 },
+    { 0xf8f0c08000000000, 0x070c3860c0800000 },
+    { 0xf8f0c08000000000, 0x070c3860c0800000 },
+    { 0xf8f0c08000000000, 0x070c3860c0800000 },
+    { 0xe0c0800000000000, 0x1c3870e0c0800000 },
+    { 0xe0c0800000000000, 0x1c3870e0c0800000 },
+    { 0xe0c0800000000000, 0x1c3870e0c0800000 },
+    { 0xe0c0800000000000, 0x1c3870e0c0800000 },
+    { 0xc080800000000000, 0x306040c080800000 },
+    { 0xc080800000000000, 0x306040c080800000 },
+    { 0xc080800000000000, 0x306040c080800000 },
+    { 0xc080800000000000, 0x306040c080800000 },
+    { 0x0000000000000000, 0xc080808080800000 },
+    { 0x0000000000000000, 0xc080808080800000 },
+    { 0x0000000000000000, 0xc080808080800000 },
+    { 0x0000000000000000, 0xc080808080800000 },
+    { 0xf0c0000000000000, 0x0f38e08000000000 },
+    { 0xf0c0000000000000, 0x0f38e08000000000 },
+    { 0xf0c0000000000000, 0x0f38e08000000000 },
+    { 0xf0c0000000000000, 0x0f38e08000000000 },
+    { 0xe080000000000000, 0x1c70c08000000000 },
+    { 0xe080000000000000, 0x1c70c08000000000 },
+    { 0xe080000000000000, 0x1c70c08000000000 },
+    { 0xe080000000000000, 0x1c70c08000000000 },
+    { 0x8000000000000000, 0x70e0c08000000000 },
+    { 0x8000000000000000, 0x70e0c08000000000 },
+    { 0x8000000000000000, 0x70e0c08000000000 },
+    { 0x8000000000000000, 0x70e0c08000000000 },
+    { 0x0000000000000000, 0xc080808000000000 },
+    { 0x0000000000000000, 0xc080808000000000 },
+    { 0x0000000000000000, 0xc080808000000000 },
+    { 0x0000000000000000, 0xc080808000000000 },
+    { 0x0000000000000000, 0xffc0000000000000 },
+    { 0x0000000000000000, 0xffc0000000000000 },
+    { 0x0000000000000000, 0xffc0000000000000 },
+    { 0x0000000000000000, 0xffc0000000000000 },
+    { 0x0000000000000000, 0xfc80000000000000 },
+    { 0x0000000000000000, 0xfc80000000000000 },
+    { 0x0000000000000000, 0xfc80000000000000 },
+    { 0x0000000000000000, 0xfc80000000000000 },
+    { 0x0000000000000000, 0xf080000000000000 },
+    { 0x0000000000000000, 0xf080000000000000 },
+    { 0x0000000000000000, 0xf080000000000000 },
+    { 0x0000000000000000, 0xf080000000000000 },
+    { 0x0000000000000000, 0xc080000000000000 },
+    { 0x0000000000000000, 0xc080000000000000 },
+    { 0x0000000000000000, 0xc080000000000000 },
+    { 0x0000000000000000, 0xc080000000000000 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c080 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c080 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c080 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c080 },
+    { 0xf0e0c0c080000000, 0x0c18302060c08080 },
+    { 0xf0e0c0c080000000, 0x0c18302060c08080 },
+    { 0xf0e0c0c080000000, 0x0c18302060c08080 },
+    { 0xf0e0c0c080000000, 0x0c18302060c08080 },
+    { 0xc0c0808000000000, 0x30206040c0808080 },
+    { 0xc0c0808000000000, 0x30206040c0808080 },
+    { 0xc0c0808000000000, 0x30206040c0808080 },
+    { 0xc0c0808000000000, 0x30206040c0808080 },
+    { 0x0000000000000000, 0xc0c0808080808080 },
+    { 0x0000000000000000, 0xc0c0808080808080 },
+    { 0x0000000000000000, 0xc0c0808080808080 },
+    { 0x0000000000000000, 0xc0c0808080808080 },
+    { 0xf8f0c08000000000, 0x070c3860c0800000 },
+    { 0xf8f0c08000000000, 0x070c3860c0800000 },
+    { 0xf8f0c08000000000, 0x070c3860c0800000 },
+    { 0xf8f0c08000000000, 0x070c3860c0800000 },
+    { 0xe0c0800000000000, 0x1c3870e0c0800000 },
+    { 0xe0c0800000000000, 0x1c3870e0c0800000 },
+    { 0xe0c0800000000000, 0x1c3870e0c0800000 },
+    { 0xe0c0800000000000, 0x1c3870e0c0800000 },
+    { 0xc080800000000000, 0x306040c080800000 },
+    { 0xc080800000000000, 0x306040c080800000 },
+    { 0xc080800000000000, 0x306040c080800000 },
+    { 0xc080800000000000, 0x306040c080800000 },
+    { 0x0000000000000000, 0xc080808080800000 },
+    { 0x0000000000000000, 0xc080808080800000 },
+    { 0x0000000000000000, 0xc080808080800000 },
+    { 0x0000000000000000, 0xc080808080800000 },
+    { 0xf0c0000000000000, 0x0f38e08000000000 },
+    { 0xf0c0000000000000, 0x0f38e08000000000 },
+    { 0xf0c0000000000000, 0x0f38e08000000000 },
+    { 0xf0c0000000000000, 0x0f38e08000000000 },
+    { 0xe080000000000000, 0x1c70c08000000000 },
+    { 0xe080000000000000, 0x1c70c08000000000 },
+    { 0xe080000000000000, 0x1c70c08000000000 },
+    { 0xe080000000000000, 0x1c70c08000000000 },
+    { 0x8000000000000000, 0x70e0c08000000000 },
+    { 0x8000000000000000, 0x70e0c08000000000 },
+    { 0x8000000000000000, 0x70e0c08000000000 },
+    { 0x8000000000000000, 0x70e0c08000000000 },
+    { 0x0000000000000000, 0xc080808000000000 },
+    { 0x0000000000000000, 0xc080808000000000 },
+    { 0x0000000000000000, 0xc080808000000000 },
+    { 0x0000000000000000, 0xc080808000000000 },
+    { 0x0000000000000000, 0xffc0000000000000 },
+    { 0x0000000000000000, 0xffc0000000000000 },
+    { 0x0000000000000000, 0xffc0000000000000 },
+    { 0x0000000000000000, 0xffc0000000000000 },
+    { 0x0000000000000000, 0xfc80000000000000 },
+    { 0x0000000000000000, 0xfc80000000000000 },
+    { 0x0000000000000000, 0xfc80000000000000 },
+    { 0x0000000000000000, 0xfc80000000000000 },
+    { 0x0000000000000000, 0xf080000000000000 },
+    { 0x0000000000000000, 0xf080000000000000 },
+    { 0x0000000000000000, 0xf080000000000000 },
+    { 0x0000000000000000, 0xf080000000000000 },
+    { 0x0000000000000000, 0xc080000000000000 },
+    { 0x0000000000000000, 0xc080000000000000 },
+    { 0x0000000000000000, 0xc080000000000000 },
+    { 0x0000000000000000, 0xc080000000000000 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c080 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c080 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c080 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c080 },
+    { 0xf0e0c0c080000000, 0x0c18302060c08080 },
+    { 0xf0e0c0c080000000, 0x0c18302060c08080 },
+    { 0xf0e0c0c080000000, 0x0c18302060c08080 },
+    { 0xf0e0c0c080000000, 0x0c18302060c08080 },
+    { 0xc0c0808000000000, 0x30206040c0808080 },
+    { 0xc0c0808000000000, 0x30206040c0808080 },
+    { 0xc0c0808000000000, 0x30206040c0808080 },
+    { 0xc0c0808000000000, 0x30206040c0808080 },
+    { 0x0000000000000000, 0xc0c0808080808080 },
+    { 0x0000000000000000, 0xc0c0808080808080 },
+    { 0x0000000000000000, 0xc0c0808080808080 },
+    { 0x0000000000000000, 0xc0c0808080808080 },
+    { 0xf8f0c08000000000, 0x070c3860c0800000 },
+    { 0xf8f0c08000000000, 0x070c3860c0800000 },
+    { 0xf8f0c08000000000, 0x070c3860c0800000 },
+    { 0xf8f0c08000000000, 0x070c3860c0800000 },
+    { 0xe0c0800000000000, 0x1c3870e0c0800000 },
+    { 0xe0c0800000000000, 0x1c3870e0c0800000 },
+    { 0xe0c0800000000000, 0x1c3870e0c0800000 },
+    { 0xe0c0800000000000, 0x1c3870e0c0800000 },
+    { 0xc080800000000000, 0x306040c080800000 },
+    { 0xc080800000000000, 0x306040c080800000 },
+    { 0xc080800000000000, 0x306040c080800000 },
+    { 0xc080800000000000, 0x306040c080800000 },
+    { 0x0000000000000000, 0xc080808080800000 },
+    { 0x0000000000000000, 0xc080808080800000 },
+    { 0x0000000000000000, 0xc080808080800000 },
+    { 0x0000000000000000, 0xc080808080800000 },
+    { 0xf0c0000000000000, 0x0f38e08000000000 },
+    { 0xf0c0000000000000, 0x0f38e08000000000 },
+    { 0xf0c0000000000000, 0x0f38e08000000000 },
+    { 0xf0c0000000000000, 0x0f38e08000000000 },
+    { 0xe080000000000000, 0x1c70c08000000000 },
+    { 0xe080000000000000, 0x1c70c08000000000 },
+    { 0xe080000000000000, 0x1c70c08000000000 },
+    { 0xe080000000000000, 0x1c70c08000000000 },
+    { 0x8000000000000000, 0x70e0c08000000000 },
+    { 0x8000000000000000, 0x70e0c08000000000 },
+    { 0x8000000000000000, 0x70e0c08000000000 },
+    { 0x8000000000000000, 0x70e0c08000000000 },
+    { 0x0000000000000000, 0xc080808000000000 },
+    { 0x0000000000000000, 0xc080808000000000 },
+    { 0x0000000000000000, 0xc080808000000000 },
+    { 0x0000000000000000, 0xc080808000000000 },
+    { 0x0000000000000000, 0xffc0000000000000 },
+    { 0x0000000000000000, 0xffc0000000000000 },
+    { 0x0000000000000000, 0xffc0000000000000 },
+    { 0x0000000000000000, 0xffc0000000000000 },
+    { 0x0000000000000000, 0xfc80000000000000 },
+    { 0x0000000000000000, 0xfc80000000000000 },
+    { 0x0000000000000000, 0xfc80000000000000 },
+    { 0x0000000000000000, 0xfc80000000000000 },
+    { 0x0000000000000000, 0xf080000000000000 },
+    { 0x0000000000000000, 0xf080000000000000 },
+    { 0x0000000000000000, 0xf080000000000000 },
+    { 0x0000000000000000, 0xf080000000000000 },
+    { 0x0000000000000000, 0xc080000000000000 },
+    { 0x0000000000000000, 0xc080000000000000 },
+    { 0x0000000000000000, 0xc080000000000000 },
+    { 0x0000000000000000, 0xc080000000000000 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c080 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c080 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c080 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c080 },
+    { 0xf0e0c0c080000000, 0x0c18302060c08080 },
+    { 0xf0e0c0c080000000, 0x0c18302060c08080 },
+    { 0xf0e0c0c080000000, 0x0c18302060c08080 },
+    { 0xf0e0c0c080000000, 0x0c18302060c08080 },
+    { 0xc0c0808000000000, 0x30206040c0808080 },
+    { 0xc0c0808000000000, 0x30206040c0808080 },
+    { 0xc0c0808000000000, 0x30206040c0808080 },
+    { 0xc0c0808000000000, 0x30206040c0808080 },
+    { 0x0000000000000000, 0xc0c0808080808080 },
+    { 0x0000000000000000, 0xc0c0808080808080 },
+    { 0x0000000000000000, 0xc0c0808080808080 },
+    { 0x0000000000000000, 0xc0c0808080808080 },
+    { 0xf8f0c08000000000, 0x070c3860c0800000 },
+    { 0xf8f0c08000000000, 0x070c3860c0800000 },
+    { 0xf8f0c08000000000, 0x070c3860c0800000 },
+    { 0xf8f0c08000000000, 0x070c3860c0800000 },
+    { 0xe0c0800000000000, 0x1c3870e0c0800000 },
+    { 0xe0c0800000000000, 0x1c3870e0c0800000 },
+    { 0xe0c0800000000000, 0x1c3870e0c0800000 },
+    { 0xe0c0800000000000, 0x1c3870e0c0800000 },
+    { 0xc080800000000000, 0x306040c080800000 },
+    { 0xc080800000000000, 0x306040c080800000 },
+    { 0xc080800000000000, 0x306040c080800000 },
+    { 0xc080800000000000, 0x306040c080800000 },
+    { 0x0000000000000000, 0xc080808080800000 },
+    { 0x0000000000000000, 0xc080808080800000 },
+    { 0x0000000000000000, 0xc080808080800000 },
+    { 0x0000000000000000, 0xc080808080800000 },
+    { 0xf0c0000000000000, 0x0f38e08000000000 },
+    { 0xf0c0000000000000, 0x0f38e08000000000 },
+    { 0xf0c0000000000000, 0x0f38e08000000000 },
+    { 0xf0c0000000000000, 0x0f38e08000000000 },
+    { 0xe080000000000000, 0x1c70c08000000000 },
+    { 0xe080000000000000, 0x1c70c08000000000 },
+    { 0xe080000000000000, 0x1c70c08000000000 },
+    { 0xe080000000000000, 0x1c70c08000000000 },
+    { 0x8000000000000000, 0x70e0c08000000000 },
+    { 0x8000000000000000, 0x70e0c08000000000 },
+    { 0x8000000000000000, 0x70e0c08000000000 },
+    { 0x8000000000000000, 0x70e0c08000000000 },
+    { 0x0000000000000000, 0xc080808000000000 },
+    { 0x0000000000000000, 0xc080808000000000 },
+    { 0x0000000000000000, 0xc080808000000000 },
+    { 0x0000000000000000, 0xc080808000000000 },
+    { 0x0000000000000000, 0xffc0000000000000 },
+    { 0x0000000000000000, 0xffc0000000000000 },
+    { 0x0000000000000000, 0xffc0000000000000 },
+    { 0x0000000000000000, 0xffc0000000000000 },
+    { 0x0000000000000000, 0xfc80000000000000 },
+    { 0x0000000000000000, 0xfc80000000000000 },
+    { 0x0000000000000000, 0xfc80000000000000 },
+    { 0x0000000000000000, 0xfc80000000000000 },
+    { 0x0000000000000000, 0xf080000000000000 },
+    { 0x0000000000000000, 0xf080000000000000 },
+    { 0x0000000000000000, 0xf080000000000000 },
+    { 0x0000000000000000, 0xf080000000000000 },
+    { 0x0000000000000000, 0xc080000000000000 },
+    { 0x0000000000000000, 0xc080000000000000 },
+    { 0x0000000000000000, 0xc080000000000000 },
+    { 0x0000000000000000, 0xc080000000000000 },
+    { 0xffffffffffff0000, 0x000000000000ffff },
+    { 0xfffffffffee00000, 0x00000000011ff880 },
+    { 0xfffffef8e0800000, 0x000001071e78e080 },
+    { 0xfefcf8e0c0800000, 0x0103061c3860c080 },
+    { 0xffffffffffff0000, 0x000000000000ffff },
+    { 0xfffffffffee00000, 0x00000000011ff880 },
+    { 0xfffffef8e0800000, 0x000001071e78e080 },
+    { 0xfefcf8e0c0800000, 0x0103061c3860c080 },
+    { 0xffffffffffff0000, 0x000000000000ffff },
+    { 0xfffffffffee00000, 0x00000000011ff880 },
+    { 0xfffffef8e0800000, 0x000001071e78e080 },
+    { 0xfefcf8e0c0800000, 0x0103061c3860c080 },
+    { 0xffffffffffff0000, 0x000000000000ffff },
+    { 0xfffffffffee00000, 0x00000000011ff880 },
+    { 0xfffffef8e0800000, 0x000001071e78e080 },
+    { 0xfefcf8e0c0800000, 0x0103061c3860c080 },
+    { 0xffffffff7f070000, 0x0000000080f81f01 },
+    { 0xffffffff00000000, 0x00000000ffff0000 },
+    { 0xfffffee000000000, 0x0000011ff8800000 },
+    { 0xfef8e08000000000, 0x01071e78e0800000 },
+    { 0xffffffff7f070000, 0x0000000080f81f01 },
+    { 0xffffffff00000000, 0x00000000ffff0000 },
+    { 0xfffffee000000000, 0x0000011ff8800000 },
+    { 0xfef8e08000000000, 0x01071e78e0800000 },
+    { 0xffffffff7f070000, 0x0000000080f81f01 },
+    { 0xffffffff00000000, 0x00000000ffff0000 },
+    { 0xfffffee000000000, 0x0000011ff8800000 },
+    { 0xfef8e08000000000, 0x01071e78e0800000 },
+    { 0xffffffff7f070000, 0x0000000080f81f01 },
+    { 0xffffffff00000000, 0x00000000ffff0000 },
+    { 0xfffffee000000000, 0x0000011ff8800000 },
+    { 0xfef8e08000000000, 0x01071e78e0800000 },
+    { 0xffff7f1f07010000, 0x000080e0781e0701 },
+    { 0xffff7f0700000000, 0x000080f81f010000 },
+    { 0xffff000000000000, 0x0000ffff00000000 },
+    { 0xfee0000000000000, 0x011ff88000000000 },
+    { 0xffff7f1f07010000, 0x000080e0781e0701 },
+    { 0xffff7f0700000000, 0x000080f81f010000 },
+    { 0xffff000000000000, 0x0000ffff00000000 },
+    { 0xfee0000000000000, 0x011ff88000000000 },
+    { 0xffff7f1f07010000, 0x000080e0781e0701 },
+    { 0xffff7f0700000000, 0x000080f81f010000 },
+    { 0xffff000000000000, 0x0000ffff00000000 },
+    { 0xfee0000000000000, 0x011ff88000000000 },
+    { 0xffff7f1f07010000, 0x000080e0781e0701 },
+    { 0xffff7f0700000000, 0x000080f81f010000 },
+    { 0xffff000000000000, 0x0000ffff00000000 },
+    { 0xfee0000000000000, 0x011ff88000000000 },
+    { 0x7f3f1f0703010000, 0x80c060381c060301 },
+    { 0x7f1f070100000000, 0x80e0781e07010000 },
+    { 0x7f07000000000000, 0x80f81f0100000000 },
+    { 0x0000000000000000, 0xffff000000000000 },
+    { 0x7f3f1f0703010000, 0x80c060381c060301 },
+    { 0x7f1f070100000000, 0x80e0781e07010000 },
+    { 0x7f07000000000000, 0x80f81f0100000000 },
+    { 0x0000000000000000, 0xffff000000000000 },
+    { 0x7f3f1f0703010000, 0x80c060381c060301 },
+    { 0x7f1f070100000000, 0x80e0781e07010000 },
+    { 0x7f07000000000000, 0x80f81f0100000000 },
+    { 0x0000000000000000, 0xffff000000000000 },
+    { 0x7f3f1f0703010000, 0x80c060381c060301 },
+    { 0x7f1f070100000000, 0x80e0781e07010000 },
+    { 0x7f07000000000000, 0x80f81f0100000000 },
+    { 0x0000000000000000, 0xffff000000000000 },
+    { 0xffffffffffff0000, 0x000000000000ffff },
+    { 0xfffffffffee00000, 0x00000000011ff880 },
+    { 0xfffffef8e0800000, 0x000001071e78e080 },
+    { 0xfefcf8e0c0800000, 0x0103061c3860c080 },
+    { 0xffffffffffff0000, 0x000000000000ffff },
+    { 0xfffffffffee00000, 0x00000000011ff880 },
+    { 0xfffffef8e0800000, 0x000001071e78e080 },
+    { 0xfefcf8e0c0800000, 0x0103061c3860c080 },
+    { 0xffffffffffff0000, 0x000000000000ffff },
+    { 0xfffffffffee00000, 0x00000000011ff880 },
+    { 0xfffffef8e0800000, 0x000001071e78e080 },
+    { 0xfefcf8e0c0800000, 0x0103061c3860c080 },
+    { 0xffffffffffff0000, 0x000000000000ffff },
+    { 0xfffffffffee00000, 0x00000000011ff880 },
+    { 0xfffffef8e0800000, 0x000001071e78e080 },
+    { 0xfefcf8e0c0800000, 0x0103061c3860c080 },
+    { 0xffffffff7f070000, 0x0000000080f81f01 },
+    { 0xffffffff00000000, 0x00000000ffff0000 },
+    { 0xfffffee000000000, 0x0000011ff8800000 },
+    { 0xfef8e08000000000, 0x01071e78e0800000 },
+    { 0xffffffff7f070000, 0x0000000080f81f01 },
+    { 0xffffffff00000000, 0x00000000ffff0000 },
+    { 0xfffffee000000000, 0x0000011ff8800000 },
+    { 0xfef8e08000000000, 0x01071e78e0800000 },
+    { 0xffffffff7f070000, 0x0000000080f81f01 },
+    { 0xffffffff00000000, 0x00000000ffff0000 },
+    { 0xfffffee000000000, 0x0000011ff8800000 },
+    { 0xfef8e08000000000, 0x01071e78e0800000 },
+    { 0xffffffff7f070000, 0x0000000080f81f01 },
+    { 0xffffffff00000000, 0x00000000ffff0000 },
+    { 0xfffffee000000000, 0x0000011ff8800000 },
+    { 0xfef8e08000000000, 0x01071e78e0800000 },
+    { 0xffff7f1f07010000, 0x000080e0781e0701 },
+    { 0xffff7f0700000000, 0x000080f81f010000 },
+    { 0xffff000000000000, 0x0000ffff00000000 },
+    { 0xfee0000000000000, 0x011ff88000000000 },
+    { 0xffff7f1f07010000, 0x000080e0781e0701 },
+    { 0xffff7f0700000000, 0x000080f81f010000 },
+    { 0xffff000000000000, 0x0000ffff00000000 },
+    { 0xfee0000000000000, 0x011ff88000000000 },
+    { 0xffff7f1f07010000, 0x000080e0781e0701 },
+    { 0xffff7f0700000000, 0x000080f81f010000 },
+    { 0xffff000000000000, 0x0000ffff00000000 },
+    { 0xfee0000000000000, 0x011ff88000000000 },
+    { 0xffff7f1f07010000, 0x000080e0781e0701 },
+    { 0xffff7f0700000000, 0x000080f81f010000 },
+    { 0xffff000000000000, 0x0000ffff00000000 },
+    { 0xfee0000000000000, 0x011ff88000000000 },
+    { 0x7f3f1f0703010000, 0x80c060381c060301 },
+    { 0x7f1f070100000000, 0x80e0781e07010000 },
+    { 0x7f07000000000000, 0x80f81f0100000000 },
+    { 0x0000000000000000, 0xffff000000000000 },
+    { 0x7f3f1f0703010000, 0x80c060381c060301 },
+    { 0x7f1f070100000000, 0x80e0781e07010000 },
+    { 0x7f07000000000000, 0x80f81f0100000000 },
+    { 0x0000000000000000, 0xffff000000000000 },
+    { 0x7f3f1f0703010000, 0x80c060381c060301 },
+    { 0x7f1f070100000000, 0x80e0781e07010000 },
+    { 0x7f07000000000000, 0x80f81f0100000000 },
+    { 0x0000000000000000, 0xffff000000000000 },
+    { 0x7f3f1f0703010000, 0x80c060381c060301 },
+    { 0x7f1f070100000000, 0x80e0781e07010000 },
+    { 0x7f07000000000000, 0x80f81f0100000000 },
+    { 0x0000000000000000, 0xffff000000000000 },
+    { 0xffffffffffff0000, 0x000000000000ffff },
+    { 0xfffffffffee00000, 0x00000000011ff880 },
+    { 0xfffffef8e0800000, 0x000001071e78e080 },
+    { 0xfefcf8e0c0800000, 0x0103061c3860c080 },
+    { 0xffffffffffff0000, 0x000000000000ffff },
+    { 0xfffffffffee00000, 0x00000000011ff880 },
+    { 0xfffffef8e0800000, 0x000001071e78e080 },
+    { 0xfefcf8e0c0800000, 0x0103061c3860c080 },
+    { 0xffffffffffff0000, 0x000000000000ffff },
+    { 0xfffffffffee00000, 0x00000000011ff880 },
+    { 0xfffffef8e0800000, 0x000001071e78e080 },
+    { 0xfefcf8e0c0800000, 0x0103061c3860c080 },
+    { 0xffffffffffff0000, 0x000000000000ffff },
+    { 0xfffffffffee00000, 0x00000000011ff880 },
+    { 0xfffffef8e0800000, 0x000001071e78e080 },
+    { 0xfefcf8e0c0800000, 0x0103061c3860c080 },
+    { 0xffffffff7f070000, 0x0000000080f81f01 },
+    { 0xffffffff00000000, 0x00000000ffff0000 },
+    { 0xfffffee000000000, 0x0000011ff8800000 },
+    { 0xfef8e08000000000, 0x01071e78e0800000 },
+    { 0xffffffff7f070000, 0x0000000080f81f01 },
+    { 0xffffffff00000000, 0x00000000ffff0000 },
+    { 0xfffffee000000000, 0x0000011ff8800000 },
+    { 0xfef8e08000000000, 0x01071e78e0800000 },
+    { 0xffffffff7f070000, 0x0000000080f81f01 },
+    { 0xffffffff00000000, 0x00000000ffff0000 },
+    { 0xfffffee000000000, 0x0000011ff8800000 },
+    { 0xfef8e08000000000, 0x01071e78e0800000 },
+    { 0xffffffff7f070000, 0x0000000080f81f01 },
+    { 0xffffffff00000000, 0x00000000ffff0000 },
+    { 0xfffffee000000000, 0x0000011ff8800000 },
+    { 0xfef8e08000000000, 0x01071e78e0800000 },
+    { 0xffff7f1f07010000, 0x000080e0781e0701 },
+    { 0xffff7f0700000000, 0x000080f81f010000 },
+    { 0xffff000000000000, 0x0000ffff00000000 },
+    { 0xfee0000000000000, 0x011ff88000000000 },
+    { 0xffff7f1f07010000, 0x000080e0781e0701 },
+    { 0xffff7f0700000000, 0x000080f81f010000 },
+    { 0xffff000000000000, 0x0000ffff00000000 },
+    { 0xfee0000000000000, 0x011ff88000000000 },
+    { 0xffff7f1f07010000, 0x000080e0781e0701 },
+    { 0xffff7f0700000000, 0x000080f81f010000 },
+    { 0xffff000000000000, 0x0000ffff00000000 },
+    { 0xfee0000000000000, 0x011ff88000000000 },
+    { 0xffff7f1f07010000, 0x000080e0781e0701 },
+    { 0xffff7f0700000000, 0x000080f81f010000 },
+    { 0xffff000000000000, 0x0000ffff00000000 },
+    { 0xfee0000000000000, 0x011ff88000000000 },
+    { 0x7f3f1f0703010000, 0x80c060381c060301 },
+    { 0x7f1f070100000000, 0x80e0781e07010000 },
+    { 0x7f07000000000000, 0x80f81f0100000000 },
+    { 0x0000000000000000, 0xffff000000000000 },
+    { 0x7f3f1f0703010000, 0x80c060381c060301 },
+    { 0x7f1f070100000000, 0x80e0781e07010000 },
+    { 0x7f07000000000000, 0x80f81f0100000000 },
+    { 0x0000000000000000, 0xffff000000000000 },
+    { 0x7f3f1f0703010000, 0x80c060381c060301 },
+    { 0x7f1f070100000000, 0x80e0781e07010000 },
+    { 0x7f07000000000000, 0x80f81f0100000000 },
+    { 0x0000000000000000, 0xffff000000000000 },
+    { 0x7f3f1f0703010000, 0x80c060381c060301 },
+    { 0x7f1f070100000000, 0x80e0781e07010000 },
+    { 0x7f07000000000000, 0x80f81f0100000000 },
+    { 0x0000000000000000, 0xffff000000000000 },
+    { 0xffffffffffff0000, 0x000000000000ffff },
+    { 0xfffffffffee00000, 0x00000000011ff880 },
+    { 0xfffffef8e0800000, 0x000001071e78e080 },
+    { 0xfefcf8e0c0800000, 0x0103061c3860c080 },
+    { 0xffffffffffff0000, 0x000000000000ffff },
+    { 0xfffffffffee00000, 0x00000000011ff880 },
+    { 0xfffffef8e0800000, 0x000001071e78e080 },
+    { 0xfefcf8e0c0800000, 0x0103061c3860c080 },
+    { 0xffffffffffff0000, 0x000000000000ffff },
+    { 0xfffffffffee00000, 0x00000000011ff880 },
+    { 0xfffffef8e0800000, 0x000001071e78e080 },
+    { 0xfefcf8e0c0800000, 0x0103061c3860c080 },
+    { 0xffffffffffff0000, 0x000000000000ffff },
+    { 0xfffffffffee00000, 0x00000000011ff880 },
+    { 0xfffffef8e0800000, 0x000001071e78e080 },
+    { 0xfefcf8e0c0800000, 0x0103061c3860c080 },
+    { 0xffffffff7f070000, 0x0000000080f81f01 },
+    { 0xffffffff00000000, 0x00000000ffff0000 },
+    { 0xfffffee000000000, 0x0000011ff8800000 },
+    { 0xfef8e08000000000, 0x01071e78e0800000 },
+    { 0xffffffff7f070000, 0x0000000080f81f01 },
+    { 0xffffffff00000000, 0x00000000ffff0000 },
+    { 0xfffffee000000000, 0x0000011ff8800000 },
+    { 0xfef8e08000000000, 0x01071e78e0800000 },
+    { 0xffffffff7f070000, 0x0000000080f81f01 },
+    { 0xffffffff00000000, 0x00000000ffff0000 },
+    { 0xfffffee000000000, 0x0000011ff8800000 },
+    { 0xfef8e08000000000, 0x01071e78e0800000 },
+    { 0xffffffff7f070000, 0x0000000080f81f01 },
+    { 0xffffffff00000000, 0x00000000ffff0000 },
+    { 0xfffffee000000000, 0x0000011ff8800000 },
+    { 0xfef8e08000000000, 0x01071e78e0800000 },
+    { 0xffff7f1f07010000, 0x000080e0781e0701 },
+    { 0xffff7f0700000000, 0x000080f81f010000 },
+    { 0xffff000000000000, 0x0000ffff00000000 },
+    { 0xfee0000000000000, 0x011ff88000000000 },
+    { 0xffff7f1f07010000, 0x000080e0781e0701 },
+    { 0xffff7f0700000000, 0x000080f81f010000 },
+    { 0xffff000000000000, 0x0000ffff00000000 },
+    { 0xfee0000000000000, 0x011ff88000000000 },
+    { 0xffff7f1f07010000, 0x000080e0781e0701 },
+    { 0xffff7f0700000000, 0x000080f81f010000 },
+    { 0xffff000000000000, 0x0000ffff00000000 },
+    { 0xfee0000000000000, 0x011ff88000000000 },
+    { 0xffff7f1f07010000, 0x000080e0781e0701 },
+    { 0xffff7f0700000000, 0x000080f81f010000 },
+    { 0xffff000000000000, 0x0000ffff00000000 },
+    { 0xfee0000000000000, 0x011ff88000000000 },
+    { 0x7f3f1f0703010000, 0x80c060381c060301 },
+    { 0x7f1f070100000000, 0x80e0781e07010000 },
+    { 0x7f07000000000000, 0x80f81f0100000000 },
+    { 0x0000000000000000, 0xffff000000000000 },
+    { 0x7f3f1f0703010000, 0x80c060381c060301 },
+    { 0x7f1f070100000000, 0x80e0781e07010000 },
+    { 0x7f07000000000000, 0x80f81f0100000000 },
+    { 0x0000000000000000, 0xffff000000000000 },
+    { 0x7f3f1f0703010000, 0x80c060381c060301 },
+    { 0x7f1f070100000000, 0x80e0781e07010000 },
+    { 0x7f07000000000000, 0x80f81f0100000000 },
+    { 0x0000000000000000, 0xffff000000000000 },
+    { 0x7f3f1f0703010000, 0x80c060381c060301 },
+    { 0x7f1f070100000000, 0x80e0781e07010000 },
+    { 0x7f07000000000000, 0x80f81f0100000000 },
+    { 0x0000000000000000, 0xffff000000000000 },
+    { 0x0000000000000000, 0x000000000000c0ff },
+    { 0x0000000000000000, 0x000000000000c0ff },
+    { 0x0000000000000000, 0x000000000000c0ff },
+    { 0x0000000000000000, 0x000000000000c0ff },
+    { 0x0000000000000000, 0x000000000000c0ff },
+    { 0x0000000000000000, 0x000000000000c0ff },
+    { 0x0000000000000000, 0x000000000000c0ff },
+    { 0x0000000000000000, 0x000000000000c0ff },
+    { 0x0000000000000000, 0x000000000000c0ff },
+    { 0x0000000000000000, 0x000000000000c0ff },
+    { 0x0000000000000000, 0x000000000000c0ff },
+    { 0x0000000000000000, 0x000000000000c0ff },
+    { 0x0000000000000000, 0x000000000000c0ff },
+    { 0x0000000000000000, 0x000000000000c0ff },
+    { 0x0000000000000000, 0x000000000000c0ff },
+    { 0x0000000000000000, 0x000000000000c0ff },
+    { 0x000000000000c0f0, 0x0000000080e0380f },
+    { 0x000000000000c0f0, 0x0000000080e0380f },
+    { 0x000000000000c0f0, 0x0000000080e0380f },
+    { 0x000000000000c0f0, 0x0000000080e0380f },
+    { 0x000000000000c0f0, 0x0000000080e0380f },
+    { 0x000000000000c0f0, 0x0000000080e0380f },
+    { 0x000000000000c0f0, 0x0000000080e0380f },
+    { 0x000000000000c0f0, 0x0000000080e0380f },
+    { 0x000000000000c0f0, 0x0000000080e0380f },
+    { 0x000000000000c0f0, 0x0000000080e0380f },
+    { 0x000000000000c0f0, 0x0000000080e0380f },
+    { 0x000000000000c0f0, 0x0000000080e0380f },
+    { 0x000000000000c0f0, 0x0000000080e0380f },
+    { 0x000000000000c0f0, 0x0000000080e0380f },
+    { 0x000000000000c0f0, 0x0000000080e0380f },
+    { 0x000000000000c0f0, 0x0000000080e0380f },
+    { 0x0000000080c0f0f8, 0x000080c060380c07 },
+    { 0x0000000080c0f0f8, 0x000080c060380c07 },
+    { 0x0000000080c0f0f8, 0x000080c060380c07 },
+    { 0x0000000080c0f0f8, 0x000080c060380c07 },
+    { 0x0000000080c0f0f8, 0x000080c060380c07 },
+    { 0x0000000080c0f0f8, 0x000080c060380c07 },
+    { 0x0000000080c0f0f8, 0x000080c060380c07 },
+    { 0x0000000080c0f0f8, 0x000080c060380c07 },
+    { 0x0000000080c0f0f8, 0x000080c060380c07 },
+    { 0x0000000080c0f0f8, 0x000080c060380c07 },
+    { 0x0000000080c0f0f8, 0x000080c060380c07 },
+    { 0x0000000080c0f0f8, 0x000080c060380c07 },
+    { 0x0000000080c0f0f8, 0x000080c060380c07 },
+    { 0x0000000080c0f0f8, 0x000080c060380c07 },
+    { 0x0000000080c0f0f8, 0x000080c060380c07 },
+    { 0x0000000080c0f0f8, 0x000080c060380c07 },
+    { 0x00000080c0e0f0f8, 0x80c0e070381c0e07 },
+    { 0x00000080c0e0f0f8, 0x80c0e070381c0e07 },
+    { 0x00000080c0e0f0f8, 0x80c0e070381c0e07 },
+    { 0x00000080c0e0f0f8, 0x80c0e070381c0e07 },
+    { 0x00000080c0e0f0f8, 0x80c0e070381c0e07 },
+    { 0x00000080c0e0f0f8, 0x80c0e070381c0e07 },
+    { 0x00000080c0e0f0f8, 0x80c0e070381c0e07 },
+    { 0x00000080c0e0f0f8, 0x80c0e070381c0e07 },
+    { 0x00000080c0e0f0f8, 0x80c0e070381c0e07 },
+    { 0x00000080c0e0f0f8, 0x80c0e070381c0e07 },
+    { 0x00000080c0e0f0f8, 0x80c0e070381c0e07 },
+    { 0x00000080c0e0f0f8, 0x80c0e070381c0e07 },
+    { 0x00000080c0e0f0f8, 0x80c0e070381c0e07 },
+    { 0x00000080c0e0f0f8, 0x80c0e070381c0e07 },
+    { 0x00000080c0e0f0f8, 0x80c0e070381c0e07 },
+    { 0x00000080c0e0f0f8, 0x80c0e070381c0e07 },
+    { 0x0000000000000000, 0x00000000000080fc },
+    { 0x0000000000000000, 0x00000000000080fc },
+    { 0x0000000000000000, 0x00000000000080fc },
+    { 0x0000000000000000, 0x00000000000080fc },
+    { 0x0000000000000000, 0x00000000000080fc },
+    { 0x0000000000000000, 0x00000000000080fc },
+    { 0x0000000000000000, 0x00000000000080fc },
+    { 0x0000000000000000, 0x00000000000080fc },
+    { 0x0000000000000000, 0x00000000000080fc },
+    { 0x0000000000000000, 0x00000000000080fc },
+    { 0x0000000000000000, 0x00000000000080fc },
+    { 0x0000000000000000, 0x00000000000080fc },
+    { 0x0000000000000000, 0x00000000000080fc },
+    { 0x0000000000000000, 0x00000000000080fc },
+    { 0x0000000000000000, 0x00000000000080fc },
+    { 0x0000000000000000, 0x00000000000080fc },
+    { 0x00000000000080e0, 0x0000000080c0701c },
+    { 0x00000000000080e0, 0x0000000080c0701c },
+    { 0x00000000000080e0, 0x0000000080c0701c },
+    { 0x00000000000080e0, 0x0000000080c0701c },
+    { 0x00000000000080e0, 0x0000000080c0701c },
+    { 0x00000000000080e0, 0x0000000080c0701c },
+    { 0x00000000000080e0, 0x0000000080c0701c },
+    { 0x00000000000080e0, 0x0000000080c0701c },
+    { 0x00000000000080e0, 0x0000000080c0701c },
+    { 0x00000000000080e0, 0x0000000080c0701c },
+    { 0x00000000000080e0, 0x0000000080c0701c },
+    { 0x00000000000080e0, 0x0000000080c0701c },
+    { 0x00000000000080e0, 0x0000000080c0701c },
+    { 0x00000000000080e0, 0x0000000080c0701c },
+    { 0x00000000000080e0, 0x0000000080c0701c },
+    { 0x00000000000080e0, 0x0000000080c0701c },
+    { 0x000000000080c0e0, 0x000080c0e070381c },
+    { 0x000000000080c0e0, 0x000080c0e070381c },
+    { 0x000000000080c0e0, 0x000080c0e070381c },
+    { 0x000000000080c0e0, 0x000080c0e070381c },
+    { 0x000000000080c0e0, 0x000080c0e070381c },
+    { 0x000000000080c0e0, 0x000080c0e070381c },
+    { 0x000000000080c0e0, 0x000080c0e070381c },
+    { 0x000000000080c0e0, 0x000080c0e070381c },
+    { 0x000000000080c0e0, 0x000080c0e070381c },
+    { 0x000000000080c0e0, 0x000080c0e070381c },
+    { 0x000000000080c0e0, 0x000080c0e070381c },
+    { 0x000000000080c0e0, 0x000080c0e070381c },
+    { 0x000000000080c0e0, 0x000080c0e070381c },
+    { 0x000000000080c0e0, 0x000080c0e070381c },
+    { 0x000000000080c0e0, 0x000080c0e070381c },
+    { 0x000000000080c0e0, 0x000080c0e070381c },
+    { 0x00000080c0c0e0f0, 0x8080c0602030180c },
+    { 0x00000080c0c0e0f0, 0x8080c0602030180c },
+    { 0x00000080c0c0e0f0, 0x8080c0602030180c },
+    { 0x00000080c0c0e0f0, 0x8080c0602030180c },
+    { 0x00000080c0c0e0f0, 0x8080c0602030180c },
+    { 0x00000080c0c0e0f0, 0x8080c0602030180c },
+    { 0x00000080c0c0e0f0, 0x8080c0602030180c },
+    { 0x00000080c0c0e0f0, 0x8080c0602030180c },
+    { 0x00000080c0c0e0f0, 0x8080c0602030180c },
+    { 0x00000080c0c0e0f0, 0x8080c0602030180c },
+    { 0x00000080c0c0e0f0, 0x8080c0602030180c },
+    { 0x00000080c0c0e0f0, 0x8080c0602030180c },
+    { 0x00000080c0c0e0f0, 0x8080c0602030180c },
+    { 0x00000080c0c0e0f0, 0x8080c0602030180c },
+    { 0x00000080c0c0e0f0, 0x8080c0602030180c },
+    { 0x00000080c0c0e0f0, 0x8080c0602030180c },
+    { 0x0000000000000000, 0x00000000000080f0 },
+    { 0x0000000000000000, 0x00000000000080f0 },
+    { 0x0000000000000000, 0x00000000000080f0 },
+    { 0x0000000000000000, 0x00000000000080f0 },
+    { 0x0000000000000000, 0x00000000000080f0 },
+    { 0x0000000000000000, 0x00000000000080f0 },
+    { 0x0000000000000000, 0x00000000000080f0 },
+    { 0x0000000000000000, 0x00000000000080f0 },
+    { 0x0000000000000000, 0x00000000000080f0 },
+    { 0x0000000000000000, 0x00000000000080f0 },
+    { 0x0000000000000000, 0x00000000000080f0 },
+    { 0x0000000000000000, 0x00000000000080f0 },
+    { 0x0000000000000000, 0x00000000000080f0 },
+    { 0x0000000000000000, 0x00000000000080f0 },
+    { 0x0000000000000000, 0x00000000000080f0 },
+    { 0x0000000000000000, 0x00000000000080f0 },
+    { 0x0000000000000080, 0x0000000080c0e070 },
+    { 0x0000000000000080, 0x0000000080c0e070 },
+    { 0x0000000000000080, 0x0000000080c0e070 },
+    { 0x0000000000000080, 0x0000000080c0e070 },
+    { 0x0000000000000080, 0x0000000080c0e070 },
+    { 0x0000000000000080, 0x0000000080c0e070 },
+    { 0x0000000000000080, 0x0000000080c0e070 },
+    { 0x0000000000000080, 0x0000000080c0e070 },
+    { 0x0000000000000080, 0x0000000080c0e070 },
+    { 0x0000000000000080, 0x0000000080c0e070 },
+    { 0x0000000000000080, 0x0000000080c0e070 },
+    { 0x0000000000000080, 0x0000000080c0e070 },
+    { 0x0000000000000080, 0x0000000080c0e070 },
+    { 0x0000000000000080, 0x0000000080c0e070 },
+    { 0x0000000000000080, 0x0000000080c0e070 },
+    { 0x0000000000000080, 0x0000000080c0e070 },
+    { 0x00000000008080c0, 0x00008080c0406030 },
+    { 0x00000000008080c0, 0x00008080c0406030 },
+    { 0x00000000008080c0, 0x00008080c0406030 },
+    { 0x00000000008080c0, 0x00008080c0406030 },
+    { 0x00000000008080c0, 0x00008080c0406030 },
+    { 0x00000000008080c0, 0x00008080c0406030 },
+    { 0x00000000008080c0, 0x00008080c0406030 },
+    { 0x00000000008080c0, 0x00008080c0406030 },
+    { 0x00000000008080c0, 0x00008080c0406030 },
+    { 0x00000000008080c0, 0x00008080c0406030 },
+    { 0x00000000008080c0, 0x00008080c0406030 },
+    { 0x00000000008080c0, 0x00008080c0406030 },
+    { 0x00000000008080c0, 0x00008080c0406030 },
+    { 0x00000000008080c0, 0x00008080c0406030 },
+    { 0x00000000008080c0, 0x00008080c0406030 },
+    { 0x00000000008080c0, 0x00008080c0406030 },
+    { 0x000000008080c0c0, 0x808080c040602030 },
+    { 0x000000008080c0c0, 0x808080c040602030 },
+    { 0x000000008080c0c0, 0x808080c040602030 },
+    { 0x000000008080c0c0, 0x808080c040602030 },
+    { 0x000000008080c0c0, 0x808080c040602030 },
+    { 0x000000008080c0c0, 0x808080c040602030 },
+    { 0x000000008080c0c0, 0x808080c040602030 },
+    { 0x000000008080c0c0, 0x808080c040602030 },
+    { 0x000000008080c0c0, 0x808080c040602030 },
+    { 0x000000008080c0c0, 0x808080c040602030 },
+    { 0x000000008080c0c0, 0x808080c040602030 },
+    { 0x000000008080c0c0, 0x808080c040602030 },
+    { 0x000000008080c0c0, 0x808080c040602030 },
+    { 0x000000008080c0c0, 0x808080c040602030 },
+    { 0x000000008080c0c0, 0x808080c040602030 },
+    { 0x000000008080c0c0, 0x808080c040602030 },
+    { 0x0000000000000000, 0x00000000000080c0 },
+    { 0x0000000000000000, 0x00000000000080c0 },
+    { 0x0000000000000000, 0x00000000000080c0 },
+    { 0x0000000000000000, 0x00000000000080c0 },
+    { 0x0000000000000000, 0x00000000000080c0 },
+    { 0x0000000000000000, 0x00000000000080c0 },
+    { 0x0000000000000000, 0x00000000000080c0 },
+    { 0x0000000000000000, 0x00000000000080c0 },
+    { 0x0000000000000000, 0x00000000000080c0 },
+    { 0x0000000000000000, 0x00000000000080c0 },
+    { 0x0000000000000000, 0x00000000000080c0 },
+    { 0x0000000000000000, 0x00000000000080c0 },
+    { 0x0000000000000000, 0x00000000000080c0 },
+    { 0x0000000000000000, 0x00000000000080c0 },
+    { 0x0000000000000000, 0x00000000000080c0 },
+    { 0x0000000000000000, 0x00000000000080c0 },
+    { 0x0000000000000000, 0x00000000808080c0 },
+    { 0x0000000000000000, 0x00000000808080c0 },
+    { 0x0000000000000000, 0x00000000808080c0 },
+    { 0x0000000000000000, 0x00000000808080c0 },
+    { 0x0000000000000000, 0x00000000808080c0 },
+    { 0x0000000000000000, 0x00000000808080c0 },
+    { 0x0000000000000000, 0x00000000808080c0 },
+    { 0x0000000000000000, 0x00000000808080c0 },
+    { 0x0000000000000000, 0x00000000808080c0 },
+    { 0x0000000000000000, 0x00000000808080c0 },
+    { 0x0000000000000000, 0x00000000808080c0 },
+    { 0x0000000000000000, 0x00000000808080c0 },
+    { 0x0000000000000000, 0x00000000808080c0 },
+    { 0x0000000000000000, 0x00000000808080c0 },
+    { 0x0000000000000000, 0x00000000808080c0 },
+    { 0x0000000000000000, 0x00000000808080c0 },
+    { 0x0000000000000000, 0x00008080808080c0 },
+    { 0x0000000000000000, 0x00008080808080c0 },
+    { 0x0000000000000000, 0x00008080808080c0 },
+    { 0x0000000000000000, 0x00008080808080c0 },
+    { 0x0000000000000000, 0x00008080808080c0 },
+    { 0x0000000000000000, 0x00008080808080c0 },
+    { 0x0000000000000000, 0x00008080808080c0 },
+    { 0x0000000000000000, 0x00008080808080c0 },
+    { 0x0000000000000000, 0x00008080808080c0 },
+    { 0x0000000000000000, 0x00008080808080c0 },
+    { 0x0000000000000000, 0x00008080808080c0 },
+    { 0x0000000000000000, 0x00008080808080c0 },
+    { 0x0000000000000000, 0x00008080808080c0 },
+    { 0x0000000000000000, 0x00008080808080c0 },
+    { 0x0000000000000000, 0x00008080808080c0 },
+    { 0x0000000000000000, 0x00008080808080c0 },
+    { 0x0000000000000000, 0x808080808080c0c0 },
+    { 0x0000000000000000, 0x808080808080c0c0 },
+    { 0x0000000000000000, 0x808080808080c0c0 },
+    { 0x0000000000000000, 0x808080808080c0c0 },
+    { 0x0000000000000000, 0x808080808080c0c0 },
+    { 0x0000000000000000, 0x808080808080c0c0 },
+    { 0x0000000000000000, 0x808080808080c0c0 },
+    { 0x0000000000000000, 0x808080808080c0c0 },
+    { 0x0000000000000000, 0x808080808080c0c0 },
+    { 0x0000000000000000, 0x808080808080c0c0 },
+    { 0x0000000000000000, 0x808080808080c0c0 },
+    { 0x0000000000000000, 0x808080808080c0c0 },
+    { 0x0000000000000000, 0x808080808080c0c0 },
+    { 0x0000000000000000, 0x808080808080c0c0 },
+    { 0x0000000000000000, 0x808080808080c0c0 },
+    { 0x0000000000000000, 0x808080808080c0c0 },
+    { 0x0000000000000000, 0x030301010101c1ff },
+    { 0x0000000000000000, 0x030101010101c0ff },
+    { 0x0000000000000000, 0x030101010000c0ff },
+    { 0x0000000000000000, 0x030100000000c0ff },
+    { 0x0303010100000000, 0x0c0406020301c1ff },
+    { 0x0301010000000000, 0x0c0602030101c0ff },
+    { 0x0100000000000000, 0x0e0703010000c0ff },
+    { 0x0000000000000000, 0x0f0100000000c0ff },
+    { 0x0f07030301000000, 0x30180c040603c1ff },
+    { 0x0703010000000000, 0x381c0e070301c0ff },
+    { 0x0701000000000000, 0x380e03010000c0ff },
+    { 0x0000000000000000, 0x3f0100000000c0ff },
+    { 0x1f0f070301000000, 0xe070381c0e07c3ff },
+    { 0x1f0f030100000000, 0xe0301c060301c0ff },
+    { 0x0f03000000000000, 0xf01c07010000c0ff },
+    { 0x0000000000000000, 0xff0300000000c0ff },
+    { 0x000000000000c0f0, 0x0303010181e1390f },
+    { 0x000000000000c0f0, 0x0301010181e1380f },
+    { 0x000000000000c0f0, 0x0301010180e0380f },
+    { 0x000000000000c0f0, 0x0301000080e0380f },
+    { 0x030301010000c0f0, 0x0c04060283e1390f },
+    { 0x030101000000c0f0, 0x0c06020381e1380f },
+    { 0x010000000000c0f0, 0x0e07030180e0380f },
+    { 0x000000000000c0f0, 0x0f01000080e0380f },
+    { 0x0f0703030100c0f0, 0x30180c0486e3390f },
+    { 0x070301000000c0f0, 0x381c0e0783e1380f },
+    { 0x070100000000c0f0, 0x380e030180e0380f },
+    { 0x000000000000c0f0, 0x3f01000080e0380f },
+    { 0x1f0f07030100c0f0, 0xe070381c8ee73b0f },
+    { 0x1f0f03010000c0f0, 0xe0301c0683e1380f },
+    { 0x0f0300000000c0f0, 0xf01c070180e0380f },
+    { 0x000000000000c0f0, 0xff03000080e0380f },
+    { 0x0000000080c0f0f8, 0x030381c161390d07 },
+    { 0x0000000080c0f0f8, 0x030181c161390c07 },
+    { 0x0000000080c0f0f8, 0x030181c160380c07 },
+    { 0x0000000080c0f0f8, 0x030180c060380c07 },
+    { 0x0303010180c0f0f8, 0x0c0486c263390d07 },
+    { 0x0301010080c0f0f8, 0x0c0682c361390c07 },
+    { 0x0100000080c0f0f8, 0x0e0783c160380c07 },
+    { 0x0000000080c0f0f8, 0x0f0180c060380c07 },
+    { 0x0f07030381c0f0f8, 0x30188cc4663b0d07 },
+    { 0x0703010080c0f0f8, 0x381c8ec763390c07 },
+    { 0x0701000080c0f0f8, 0x380e83c160380c07 },
+    { 0x0000000080c0f0f8, 0x3f0180c060380c07 },
+    { 0x1f0f070381c0f0f8, 0xe070b8dc6e3f0f07 },
+    { 0x1f0f030180c0f0f8, 0xe0309cc663390c07 },
+    { 0x0f03000080c0f0f8, 0xf01c87c160380c07 },
+    { 0x0000000080c0f0f8, 0xff0380c060380c07 },
+    { 0x00000080c0e0f0f8, 0x83c3e171391d0f07 },
+    { 0x00000080c0e0f0f8, 0x83c1e171391d0e07 },
+    { 0x00000080c0e0f0f8, 0x83c1e171381c0e07 },
+    { 0x00000080c0e0f0f8, 0x83c1e070381c0e07 },
+    { 0x03030181c0e0f0f8, 0x8cc4e6723b1d0f07 },
+    { 0x03010180c0e0f0f8, 0x8cc6e273391d0e07 },
+    { 0x01000080c0e0f0f8, 0x8ec7e371381c0e07 },
+    { 0x00000080c0e0f0f8, 0x8fc1e070381c0e07 },
+    { 0x0f070383c1e0f0f8, 0xb0d8ec743e1f0f07 },
+    { 0x07030180c0e0f0f8, 0xb8dcee773b1d0e07 },
+    { 0x07010080c0e0f0f8, 0xb8cee371381c0e07 },
+    { 0x00000080c0e0f0f8, 0xbfc1e070381c0e07 },
+    { 0x1f0f0783c1e0f0f8, 0xe0f0f87c3e1f0f07 },
+    { 0x1f0f0381c0e0f0f8, 0xe0f0fc763b1d0e07 },
+    { 0x0f030080c0e0f0f8, 0xf0dce771381c0e07 },
+    { 0x00000080c0e0f0f8, 0xffc3e070381c0e07 },
+    { 0x0000000000000000, 0x03030101010181fd },
+    { 0x0000000000000000, 0x03010101010180fc },
+    { 0x0000000000000000, 0x03010101000080fc },
+    { 0x0000000000000000, 0x03010000000080fc },
+    { 0x0303010100000000, 0x0c040602030181fd },
+    { 0x0301010000000000, 0x0c060203010180fc },
+    { 0x0100000000000000, 0x0e070301000080fc },
+    { 0x0000000000000000, 0x0f010000000080fc },
+    { 0x0f07030301000000, 0x30180c04060381fd },
+    { 0x0703010000000000, 0x381c0e07030180fc },
+    { 0x0701000000000000, 0x380e0301000080fc },
+    { 0x0000000000000000, 0x3f010000000080fc },
+    { 0x1f0f070301000000, 0xe070381c0e0783fd },
+    { 0x1f0f030100000000, 0xe0301c06030180fc },
+    { 0x0f03000000000000, 0xf01c0701000080fc },
+    { 0x0000000000000000, 0xff030000000080fc },
+    { 0x00000000000080e0, 0x0303010181c1711d },
+    { 0x00000000000080e0, 0x0301010181c1701c },
+    { 0x00000000000080e0, 0x0301010180c0701c },
+    { 0x00000000000080e0, 0x0301000080c0701c },
+    { 0x03030101000080e0, 0x0c04060283c1711d },
+    { 0x03010100000080e0, 0x0c06020381c1701c },
+    { 0x01000000000080e0, 0x0e07030180c0701c },
+    { 0x00000000000080e0, 0x0f01000080c0701c },
+    { 0x0f070303010080e0, 0x30180c0486c3711d },
+    { 0x07030100000080e0, 0x381c0e0783c1701c },
+    { 0x07010000000080e0, 0x380e030180c0701c },
+    { 0x00000000000080e0, 0x3f01000080c0701c },
+    { 0x1f0f0703010080e0, 0xe070381c8ec7731d },
+    { 0x1f0f0301000080e0, 0xe0301c0683c1701c },
+    { 0x0f030000000080e0, 0xf01c070180c0701c },
+    { 0x00000000000080e0, 0xff03000080c0701c },
+    { 0x000000000080c0e0, 0x030381c1e171391d },
+    { 0x000000000080c0e0, 0x030181c1e171381c },
+    { 0x000000000080c0e0, 0x030181c1e070381c },
+    { 0x000000000080c0e0, 0x030180c0e070381c },
+    { 0x030301010080c0e0, 0x0c0486c2e371391d },
+    { 0x030101000080c0e0, 0x0c0682c3e171381c },
+    { 0x010000000080c0e0, 0x0e0783c1e070381c },
+    { 0x000000000080c0e0, 0x0f0180c0e070381c },
+    { 0x0f0703030180c0e0, 0x30188cc4e673391d },
+    { 0x070301000080c0e0, 0x381c8ec7e371381c },
+    { 0x070100000080c0e0, 0x380e83c1e070381c },
+    { 0x000000000080c0e0, 0x3f0180c0e070381c },
+    { 0x1f0f07030180c0e0, 0xe070b8dcee773b1d },
+    { 0x1f0f03010080c0e0, 0xe0309cc6e371381c },
+    { 0x0f0300000080c0e0, 0xf01c87c1e070381c },
+    { 0x000000000080c0e0, 0xff0380c0e070381c },
+    { 0x00000080c0c0e0f0, 0x8383c1612131190d },
+    { 0x00000080c0c0e0f0, 0x8381c1612131180c },
+    { 0x00000080c0c0e0f0, 0x8381c1612030180c },
+    { 0x00000080c0c0e0f0, 0x8381c0602030180c },
+    { 0x03030181c0c0e0f0, 0x8c84c6622331190d },
+    { 0x03010180c0c0e0f0, 0x8c86c2632131180c },
+    { 0x01000080c0c0e0f0, 0x8e87c3612030180c },
+    { 0x00000080c0c0e0f0, 0x8f81c0602030180c },
+    { 0x0f070383c1c0e0f0, 0xb098cc642633190d },
+    { 0x07030180c0c0e0f0, 0xb89cce672331180c },
+    { 0x07010080c0c0e0f0, 0xb88ec3612030180c },
+    { 0x00000080c0c0e0f0, 0xbf81c0602030180c },
+    { 0x1f0f0783c1c0e0f0, 0xe0f0f87c2e371b0d },
+    { 0x1f0f0381c0c0e0f0, 0xe0b0dc662331180c },
+    { 0x0f030080c0c0e0f0, 0xf09cc7612030180c },
+    { 0x00000080c0c0e0f0, 0xff83c0602030180c },
+    { 0x0000000000000000, 0x03030101010181f1 },
+    { 0x0000000000000000, 0x03010101010180f0 },
+    { 0x0000000000000000, 0x03010101000080f0 },
+    { 0x0000000000000000, 0x03010000000080f0 },
+    { 0x0303010100000000, 0x0c040602030181f1 },
+    { 0x0301010000000000, 0x0c060203010180f0 },
+    { 0x0100000000000000, 0x0e070301000080f0 },
+    { 0x0000000000000000, 0x0f010000000080f0 },
+    { 0x0f07030301000000, 0x30180c04060381f1 },
+    { 0x0703010000000000, 0x381c0e07030180f0 },
+    { 0x0701000000000000, 0x380e0301000080f0 },
+    { 0x0000000000000000, 0x3f010000000080f0 },
+    { 0x1f0f070301000000, 0xe070381c0e0783f1 },
+    { 0x1f0f030100000000, 0xe0301c06030180f0 },
+    { 0x0f03000000000000, 0xf01c0701000080f0 },
+    { 0x0000000000000000, 0xff030000000080f0 },
+    { 0x0000000000000080, 0x0303010181c1e171 },
+    { 0x0000000000000080, 0x0301010181c1e070 },
+    { 0x0000000000000080, 0x0301010180c0e070 },
+    { 0x0000000000000080, 0x0301000080c0e070 },
+    { 0x0303010100000080, 0x0c04060283c1e171 },
+    { 0x0301010000000080, 0x0c06020381c1e070 },
+    { 0x0100000000000080, 0x0e07030180c0e070 },
+    { 0x0000000000000080, 0x0f01000080c0e070 },
+    { 0x0f07030301000080, 0x30180c0486c3e171 },
+    { 0x0703010000000080, 0x381c0e0783c1e070 },
+    { 0x0701000000000080, 0x380e030180c0e070 },
+    { 0x0000000000000080, 0x3f01000080c0e070 },
+    { 0x1f0f070301000080, 0xe070381c8ec7e371 },
+    { 0x1f0f030100000080, 0xe0301c0683c1e070 },
+    { 0x0f03000000000080, 0xf01c070180c0e070 },
+    { 0x0000000000000080, 0xff03000080c0e070 },
+    { 0x00000000008080c0, 0x03038181c1416131 },
+    { 0x00000000008080c0, 0x03018181c1416030 },
+    { 0x00000000008080c0, 0x03018181c0406030 },
+    { 0x00000000008080c0, 0x03018080c0406030 },
+    { 0x03030101008080c0, 0x0c048682c3416131 },
+    { 0x03010100008080c0, 0x0c068283c1416030 },
+    { 0x01000000008080c0, 0x0e078381c0406030 },
+    { 0x00000000008080c0, 0x0f018080c0406030 },
+    { 0x0f070303018080c0, 0x30188c84c6436131 },
+    { 0x07030100008080c0, 0x381c8e87c3416030 },
+    { 0x07010000008080c0, 0x380e8381c0406030 },
+    { 0x00000000008080c0, 0x3f018080c0406030 },
+    { 0x1f0f0703018080c0, 0xe070b89cce476331 },
+    { 0x1f0f0301008080c0, 0xe0309c86c3416030 },
+    { 0x0f030000008080c0, 0xf01c8781c0406030 },
+    { 0x00000000008080c0, 0xff038080c0406030 },
+    { 0x000000008080c0c0, 0x838381c141612131 },
+    { 0x000000008080c0c0, 0x838181c141612030 },
+    { 0x000000008080c0c0, 0x838181c140602030 },
+    { 0x000000008080c0c0, 0x838180c040602030 },
+    { 0x030301018080c0c0, 0x8c8486c243612131 },
+    { 0x030101008080c0c0, 0x8c8682c341612030 },
+    { 0x010000008080c0c0, 0x8e8783c140602030 },
+    { 0x000000008080c0c0, 0x8f8180c040602030 },
+    { 0x0f0703038180c0c0, 0xb0988cc446632131 },
+    { 0x070301008080c0c0, 0xb89c8ec743612030 },
+    { 0x070100008080c0c0, 0xb88e83c140602030 },
+    { 0x000000008080c0c0, 0xbf8180c040602030 },
+    { 0x1f0f07038180c0c0, 0xe0f0b8dc4e672331 },
+    { 0x1f0f03018080c0c0, 0xe0b09cc643612030 },
+    { 0x0f0300008080c0c0, 0xf09c87c140602030 },
+    { 0x000000008080c0c0, 0xff8380c040602030 },
+    { 0x0000000000000000, 0x03030101010181c1 },
+    { 0x0000000000000000, 0x03010101010180c0 },
+    { 0x0000000000000000, 0x03010101000080c0 },
+    { 0x0000000000000000, 0x03010000000080c0 },
+    { 0x0303010100000000, 0x0c040602030181c1 },
+    { 0x0301010000000000, 0x0c060203010180c0 },
+    { 0x0100000000000000, 0x0e070301000080c0 },
+    { 0x0000000000000000, 0x0f010000000080c0 },
+    { 0x0f07030301000000, 0x30180c04060381c1 },
+    { 0x0703010000000000, 0x381c0e07030180c0 },
+    { 0x0701000000000000, 0x380e0301000080c0 },
+    { 0x0000000000000000, 0x3f010000000080c0 },
+    { 0x1f0f070301000000, 0xe070381c0e0783c1 },
+    { 0x1f0f030100000000, 0xe0301c06030180c0 },
+    { 0x0f03000000000000, 0xf01c0701000080c0 },
+    { 0x0000000000000000, 0xff030000000080c0 },
+    { 0x0000000000000000, 0x03030101818181c1 },
+    { 0x0000000000000000, 0x03010101818180c0 },
+    { 0x0000000000000000, 0x03010101808080c0 },
+    { 0x0000000000000000, 0x03010000808080c0 },
+    { 0x0303010100000000, 0x0c040602838181c1 },
+    { 0x0301010000000000, 0x0c060203818180c0 },
+    { 0x0100000000000000, 0x0e070301808080c0 },
+    { 0x0000000000000000, 0x0f010000808080c0 },
+    { 0x0f07030301000000, 0x30180c04868381c1 },
+    { 0x0703010000000000, 0x381c0e07838180c0 },
+    { 0x0701000000000000, 0x380e0301808080c0 },
+    { 0x0000000000000000, 0x3f010000808080c0 },
+    { 0x1f0f070301000000, 0xe070381c8e8783c1 },
+    { 0x1f0f030100000000, 0xe0301c06838180c0 },
+    { 0x0f03000000000000, 0xf01c0701808080c0 },
+    { 0x0000000000000000, 0xff030000808080c0 },
+    { 0x0000000000000000, 0x03038181818181c1 },
+    { 0x0000000000000000, 0x03018181818180c0 },
+    { 0x0000000000000000, 0x03018181808080c0 },
+    { 0x0000000000000000, 0x03018080808080c0 },
+    { 0x0303010100000000, 0x0c048682838181c1 },
+    { 0x0301010000000000, 0x0c068283818180c0 },
+    { 0x0100000000000000, 0x0e078381808080c0 },
+    { 0x0000000000000000, 0x0f018080808080c0 },
+    { 0x0f07030301000000, 0x30188c84868381c1 },
+    { 0x0703010000000000, 0x381c8e87838180c0 },
+    { 0x0701000000000000, 0x380e8381808080c0 },
+    { 0x0000000000000000, 0x3f018080808080c0 },
+    { 0x1f0f070301000000, 0xe070b89c8e8783c1 },
+    { 0x1f0f030100000000, 0xe0309c86838180c0 },
+    { 0x0f03000000000000, 0xf01c8781808080c0 },
+    { 0x0000000000000000, 0xff038080808080c0 },
+    { 0x0000000000000000, 0x838381818181c1c1 },
+    { 0x0000000000000000, 0x838181818181c0c0 },
+    { 0x0000000000000000, 0x838181818080c0c0 },
+    { 0x0000000000000000, 0x838180808080c0c0 },
+    { 0x0303010100000000, 0x8c8486828381c1c1 },
+    { 0x0301010000000000, 0x8c8682838181c0c0 },
+    { 0x0100000000000000, 0x8e8783818080c0c0 },
+    { 0x0000000000000000, 0x8f8180808080c0c0 },
+    { 0x0f07030301000000, 0xb0988c848683c1c1 },
+    { 0x0703010000000000, 0xb89c8e878381c0c0 },
+    { 0x0701000000000000, 0xb88e83818080c0c0 },
+    { 0x0000000000000000, 0xbf8180808080c0c0 },
+    { 0x1f0f070301000000, 0xe0f0b89c8e87c3c1 },
+    { 0x1f0f030100000000, 0xe0b09c868381c0c0 },
+    { 0x0f03000000000000, 0xf09c87818080c0c0 },
+    { 0x0000000000000000, 0xff8380808080c0c0 },
+    { 0xfcfcfcfcfcfcfcfc, 0x0303030303030303 },
+    { 0xfcfcfcfcfcfcfcfc, 0x0303030303030303 },
+    { 0xfcfcfcfcfcfcfcfc, 0x0303030303030303 },
+    { 0xfcfcfcfcfcfcfcfc, 0x0303030303030303 },
+    { 0xf0f8f8f8f8fcfcfc, 0x0c04040606020203 },
+    { 0xf0f8f8f8f8fcfcfc, 0x0c04040606020203 },
+    { 0xf0f8f8f8f8fcfcfc, 0x0c04040606020203 },
+    { 0xf0f8f8f8f8fcfcfc, 0x0c04040606020203 },
+    { 0xc0e0e0f0f0f8f8fc, 0x3018180c0c060603 },
+    { 0xc0e0e0f0f0f8f8fc, 0x3018180c0c060603 },
+    { 0xc0e0e0f0f0f8f8fc, 0x3018180c0c060603 },
+    { 0xc0e0e0f0f0f8f8fc, 0x3018180c0c060603 },
+    { 0x0080c0e0e0f0f8fc, 0xc0603018180c0603 },
+    { 0x0080c0e0e0f0f8fc, 0xc0603018180c0603 },
+    { 0x0080c0e0e0f0f8fc, 0xc0603018180c0603 },
+    { 0x0080c0e0e0f0f8fc, 0xc0603018180c0603 },
+    { 0xfcfcfcfcfcfcfcfc, 0x0303030303030303 },
+    { 0xfcfcfcfcfcfcfcfc, 0x0303030303030303 },
+    { 0xfcfcfcfcfcfcfcfc, 0x0303030303030303 },
+    { 0xfcfcfcfcfcfcfcfc, 0x0303030303030303 },
+    { 0xf0f8f8f8f8fcfcfc, 0x0c04040606020203 },
+    { 0xf0f8f8f8f8fcfcfc, 0x0c04040606020203 },
+    { 0xf0f8f8f8f8fcfcfc, 0x0c04040606020203 },
+    { 0xf0f8f8f8f8fcfcfc, 0x0c04040606020203 },
+    { 0xc0e0e0f0f0f8f8fc, 0x3018180c0c060603 },
+    { 0xc0e0e0f0f0f8f8fc, 0x3018180c0c060603 },
+    { 0xc0e0e0f0f0f8f8fc, 0x3018180c0c060603 },
+    { 0xc0e0e0f0f0f8f8fc, 0x3018180c0c060603 },
+    { 0x0080c0e0e0f0f8fc, 0xc0603018180c0603 },
+    { 0x0080c0e0e0f0f8fc, 0xc0603018180c0603 },
+    { 0x0080c0e0e0f0f8fc, 0xc0603018180c0603 },
+    { 0x0080c0e0e0f0f8fc, 0xc0603018180c0603 },
+    { 0xfcfcfcfcfcfcfcfc, 0x0303030303030303 },
+    { 0xfcfcfcfcfcfcfcfc, 0x0303030303030303 },
+    { 0xfcfcfcfcfcfcfcfc, 0x0303030303030303 },
+    { 0xfcfcfcfcfcfcfcfc, 0x0303030303030303 },
+    { 0xf0f8f8f8f8fcfcfc, 0x0c04040606020203 },
+    { 0xf0f8f8f8f8fcfcfc, 0x0c04040606020203 },
+    { 0xf0f8f8f8f8fcfcfc, 0x0c04040606020203 },
+    { 0xf0f8f8f8f8fcfcfc, 0x0c04040606020203 },
+    { 0xc0e0e0f0f0f8f8fc, 0x3018180c0c060603 },
+    { 0xc0e0e0f0f0f8f8fc, 0x3018180c0c060603 },
+    { 0xc0e0e0f0f0f8f8fc, 0x3018180c0c060603 },
+    { 0xc0e0e0f0f0f8f8fc, 0x3018180c0c060603 },
+    { 0x0080c0e0e0f0f8fc, 0xc0603018180c0603 },
+    { 0x0080c0e0e0f0f8fc, 0xc0603018180c0603 },
+    { 0x0080c0e0e0f0f8fc, 0xc0603018180c0603 },
+    { 0x0080c0e0e0f0f8fc, 0xc0603018180c0603 },
+    { 0xfcfcfcfcfcfcfcfc, 0x0303030303030303 },
+    { 0xfcfcfcfcfcfcfcfc, 0x0303030303030303 },
+    { 0xfcfcfcfcfcfcfcfc, 0x0303030303030303 },
+    { 0xfcfcfcfcfcfcfcfc, 0x0303030303030303 },
+    { 0xf0f8f8f8f8fcfcfc, 0x0c04040606020203 },
+    { 0xf0f8f8f8f8fcfcfc, 0x0c04040606020203 },
+    { 0xf0f8f8f8f8fcfcfc, 0x0c04040606020203 },
+    { 0xf0f8f8f8f8fcfcfc, 0x0c04040606020203 },
+    { 0xc0e0e0f0f0f8f8fc, 0x3018180c0c060603 },
+    { 0xc0e0e0f0f0f8f8fc, 0x3018180c0c060603 },
+    { 0xc0e0e0f0f0f8f8fc, 0x3018180c0c060603 },
+    { 0xc0e0e0f0f0f8f8fc, 0x3018180c0c060603 },
+    { 0x0080c0e0e0f0f8fc, 0xc0603018180c0603 },
+    { 0x0080c0e0e0f0f8fc, 0xc0603018180c0603 },
+    { 0x0080c0e0e0f0f8fc, 0xc0603018180c0603 },
+    { 0x0080c0e0e0f0f8fc, 0xc0603018180c0603 },
+    { 0xfcfcfcf8f8f8f8f0, 0x030202060604040c },
+    { 0xfcfcfcf8f8f8f8f0, 0x030202060604040c },
+    { 0xfcfcfcf8f8f8f8f0, 0x030202060604040c },
+    { 0xfcfcfcf8f8f8f8f0, 0x030202060604040c },
+    { 0xf0f0f0f0f0f0f0f0, 0x0c0c0c0c0c0c0c0c },
+    { 0xf0f0f0f0f0f0f0f0, 0x0c0c0c0c0c0c0c0c },
+    { 0xf0f0f0f0f0f0f0f0, 0x0c0c0c0c0c0c0c0c },
+    { 0xf0f0f0f0f0f0f0f0, 0x0c0c0c0c0c0c0c0c },
+    { 0xc0e0e0e0e0f0f0f0, 0x301010181808080c },
+    { 0xc0e0e0e0e0f0f0f0, 0x301010181808080c },
+    { 0xc0e0e0e0e0f0f0f0, 0x301010181808080c },
+    { 0xc0e0e0e0e0f0f0f0, 0x301010181808080c },
+    { 0x008080c0c0e0e0f0, 0xc06060303018180c },
+    { 0x008080c0c0e0e0f0, 0xc06060303018180c },
+    { 0x008080c0c0e0e0f0, 0xc06060303018180c },
+    { 0x008080c0c0e0e0f0, 0xc06060303018180c },
+    { 0xfcfcfcf8f8f8f8f0, 0x030202060604040c },
+    { 0xfcfcfcf8f8f8f8f0, 0x030202060604040c },
+    { 0xfcfcfcf8f8f8f8f0, 0x030202060604040c },
+    { 0xfcfcfcf8f8f8f8f0, 0x030202060604040c },
+    { 0xf0f0f0f0f0f0f0f0, 0x0c0c0c0c0c0c0c0c },
+    { 0xf0f0f0f0f0f0f0f0, 0x0c0c0c0c0c0c0c0c },
+    { 0xf0f0f0f0f0f0f0f0, 0x0c0c0c0c0c0c0c0c },
+    { 0xf0f0f0f0f0f0f0f0, 0x0c0c0c0c0c0c0c0c },
+    { 0xc0e0e0e0e0f0f0f0, 0x301010181808080c },
+    { 0xc0e0e0e0e0f0f0f0, 0x301010181808080c },
+    { 0xc0e0e0e0e0f0f0f0, 0x301010181808080c },
+    { 0xc0e0e0e0e0f0f0f0, 0x301010181808080c },
+    { 0x008080c0c0e0e0f0, 0xc06060303018180c },
+    { 0x008080c0c0e0e0f0, 0xc06060303018180c },
+    { 0x008080c0c0e0e0f0, 0xc06060303018180c },
+    { 0x008080c0c0e0e0f0, 0xc06060303018180c },
+    { 0xfcfcfcf8f8f8f8f0, 0x030202060604040c },
+    { 0xfcfcfcf8f8f8f8f0, 0x030202060604040c },
+    { 0xfcfcfcf8f8f8f8f0, 0x030202060604040c },
+    { 0xfcfcfcf8f8f8f8f0, 0x030202060604040c },
+    { 0xf0f0f0f0f0f0f0f0, 0x0c0c0c0c0c0c0c0c },
+    { 0xf0f0f0f0f0f0f0f0, 0x0c0c0c0c0c0c0c0c },
+    { 0xf0f0f0f0f0f0f0f0, 0x0c0c0c0c0c0c0c0c },
+    { 0xf0f0f0f0f0f0f0f0, 0x0c0c0c0c0c0c0c0c },
+    { 0xc0e0e0e0e0f0f0f0, 0x301010181808080c },
+    { 0xc0e0e0e0e0f0f0f0, 0x301010181808080c },
+    { 0xc0e0e0e0e0f0f0f0, 0x301010181808080c },
+    { 0xc0e0e0e0e0f0f0f0, 0x301010181808080c },
+    { 0x008080c0c0e0e0f0, 0xc06060303018180c },
+    { 0x008080c0c0e0e0f0, 0xc06060303018180c },
+    { 0x008080c0c0e0e0f0, 0xc06060303018180c },
+    { 0x008080c0c0e0e0f0, 0xc06060303018180c },
+    { 0xfcfcfcf8f8f8f8f0, 0x030202060604040c },
+    { 0xfcfcfcf8f8f8f8f0, 0x030202060604040c },
+    { 0xfcfcfcf8f8f8f8f0, 0x030202060604040c },
+    { 0xfcfcfcf8f8f8f8f0, 0x030202060604040c },
+    { 0xf0f0f0f0f0f0f0f0, 0x0c0c0c0c0c0c0c0c },
+    { 0xf0f0f0f0f0f0f0f0, 0x0c0c0c0c0c0c0c0c },
+    { 0xf0f0f0f0f0f0f0f0, 0x0c0c0c0c0c0c0c0c },
+    { 0xf0f0f0f0f0f0f0f0, 0x0c0c0c0c0c0c0c0c },
+    { 0xc0e0e0e0e0f0f0f0, 0x301010181808080c },
+    { 0xc0e0e0e0e0f0f0f0, 0x301010181808080c },
+    { 0xc0e0e0e0e0f0f0f0, 0x301010181808080c },
+    { 0xc0e0e0e0e0f0f0f0, 0x301010181808080c },
+    { 0x008080c0c0e0e0f0, 0xc06060303018180c },
+    { 0x008080c0c0e0e0f0, 0xc06060303018180c },
+    { 0x008080c0c0e0e0f0, 0xc06060303018180c },
+    { 0x008080c0c0e0e0f0, 0xc06060303018180c },
+    { 0xfcf8f8f0f0e0e0c0, 0x0306060c0c181830 },
+    { 0xfcf8f8f0f0e0e0c0, 0x0306060c0c181830 },
+    { 0xfcf8f8f0f0e0e0c0, 0x0306060c0c181830 },
+    { 0xfcf8f8f0f0e0e0c0, 0x0306060c0c181830 },
+    { 0xf0f0f0e0e0e0e0c0, 0x0c08081818101030 },
+    { 0xf0f0f0e0e0e0e0c0, 0x0c08081818101030 },
+    { 0xf0f0f0e0e0e0e0c0, 0x0c08081818101030 },
+    { 0xf0f0f0e0e0e0e0c0, 0x0c08081818101030 },
+    { 0xc0c0c0c0c0c0c0c0, 0x3030303030303030 },
+    { 0xc0c0c0c0c0c0c0c0, 0x3030303030303030 },
+    { 0xc0c0c0c0c0c0c0c0, 0x3030303030303030 },
+    { 0xc0c0c0c0c0c0c0c0, 0x3030303030303030 },
+    { 0x0080808080c0c0c0, 0xc040406060202030 },
+    { 0x0080808080c0c0c0, 0xc040406060202030 },
+    { 0x0080808080c0c0c0, 0xc040406060202030 },
+    { 0x0080808080c0c0c0, 0xc040406060202030 },
+    { 0xfcf8f8f0f0e0e0c0, 0x0306060c0c181830 },
+    { 0xfcf8f8f0f0e0e0c0, 0x0306060c0c181830 },
+    { 0xfcf8f8f0f0e0e0c0, 0x0306060c0c181830 },
+    { 0xfcf8f8f0f0e0e0c0, 0x0306060c0c181830 },
+    { 0xf0f0f0e0e0e0e0c0, 0x0c08081818101030 },
+    { 0xf0f0f0e0e0e0e0c0, 0x0c08081818101030 },
+    { 0xf0f0f0e0e0e0e0c0, 0x0c08081818101030 },
+    { 0xf0f0f0e0e0e0e0c0, 0x0c08081818101030 },
+    { 0xc0c0c0c0c0c0c0c0, 0x3030303030303030 },
+    { 0xc0c0c0c0c0c0c0c0, 0x3030303030303030 },
+    { 0xc0c0c0c0c0c0c0c0, 0x3030303030303030 },
+    { 0xc0c0c0c0c0c0c0c0, 0x3030303030303030 },
+    { 0x0080808080c0c0c0, 0xc040406060202030 },
+    { 0x0080808080c0c0c0, 0xc040406060202030 },
+    { 0x0080808080c0c0c0, 0xc040406060202030 },
+    { 0x0080808080c0c0c0, 0xc040406060202030 },
+    { 0xfcf8f8f0f0e0e0c0, 0x0306060c0c181830 },
+    { 0xfcf8f8f0f0e0e0c0, 0x0306060c0c181830 },
+    { 0xfcf8f8f0f0e0e0c0, 0x0306060c0c181830 },
+    { 0xfcf8f8f0f0e0e0c0, 0x0306060c0c181830 },
+    { 0xf0f0f0e0e0e0e0c0, 0x0c08081818101030 },
+    { 0xf0f0f0e0e0e0e0c0, 0x0c08081818101030 },
+    { 0xf0f0f0e0e0e0e0c0, 0x0c08081818101030 },
+    { 0xf0f0f0e0e0e0e0c0, 0x0c08081818101030 },
+    { 0xc0c0c0c0c0c0c0c0, 0x3030303030303030 },
+    { 0xc0c0c0c0c0c0c0c0, 0x3030303030303030 },
+    { 0xc0c0c0c0c0c0c0c0, 0x3030303030303030 },
+    { 0xc0c0c0c0c0c0c0c0, 0x3030303030303030 },
+    { 0x0080808080c0c0c0, 0xc040406060202030 },
+    { 0x0080808080c0c0c0, 0xc040406060202030 },
+    { 0x0080808080c0c0c0, 0xc040406060202030 },
+    { 0x0080808080c0c0c0, 0xc040406060202030 },
+    { 0xfcf8f8f0f0e0e0c0, 0x0306060c0c181830 },
+    { 0xfcf8f8f0f0e0e0c0, 0x0306060c0c181830 },
+    { 0xfcf8f8f0f0e0e0c0, 0x0306060c0c181830 },
+    { 0xfcf8f8f0f0e0e0c0, 0x0306060c0c181830 },
+    { 0xf0f0f0e0e0e0e0c0, 0x0c08081818101030 },
+    { 0xf0f0f0e0e0e0e0c0, 0x0c08081818101030 },
+    { 0xf0f0f0e0e0e0e0c0, 0x0c08081818101030 },
+    { 0xf0f0f0e0e0e0e0c0, 0x0c08081818101030 },
+    { 0xc0c0c0c0c0c0c0c0, 0x3030303030303030 },
+    { 0xc0c0c0c0c0c0c0c0, 0x3030303030303030 },
+    { 0xc0c0c0c0c0c0c0c0, 0x3030303030303030 },
+    { 0xc0c0c0c0c0c0c0c0, 0x3030303030303030 },
+    { 0x0080808080c0c0c0, 0xc040406060202030 },
+    { 0x0080808080c0c0c0, 0xc040406060202030 },
+    { 0x0080808080c0c0c0, 0xc040406060202030 },
+    { 0x0080808080c0c0c0, 0xc040406060202030 },
+    { 0xfcf8f0e0e0c08000, 0x03060c18183060c0 },
+    { 0xfcf8f0e0e0c08000, 0x03060c18183060c0 },
+    { 0xfcf8f0e0e0c08000, 0x03060c18183060c0 },
+    { 0xfcf8f0e0e0c08000, 0x03060c18183060c0 },
+    { 0xf0e0e0c0c0808000, 0x0c181830306060c0 },
+    { 0xf0e0e0c0c0808000, 0x0c181830306060c0 },
+    { 0xf0e0e0c0c0808000, 0x0c181830306060c0 },
+    { 0xf0e0e0c0c0808000, 0x0c181830306060c0 },
+    { 0xc0c0c08080808000, 0x30202060604040c0 },
+    { 0xc0c0c08080808000, 0x30202060604040c0 },
+    { 0xc0c0c08080808000, 0x30202060604040c0 },
+    { 0xc0c0c08080808000, 0x30202060604040c0 },
+    { 0x0000000000000000, 0xc0c0c0c0c0c0c0c0 },
+    { 0x0000000000000000, 0xc0c0c0c0c0c0c0c0 },
+    { 0x0000000000000000, 0xc0c0c0c0c0c0c0c0 },
+    { 0x0000000000000000, 0xc0c0c0c0c0c0c0c0 },
+    { 0xfcf8f0e0e0c08000, 0x03060c18183060c0 },
+    { 0xfcf8f0e0e0c08000, 0x03060c18183060c0 },
+    { 0xfcf8f0e0e0c08000, 0x03060c18183060c0 },
+    { 0xfcf8f0e0e0c08000, 0x03060c18183060c0 },
+    { 0xf0e0e0c0c0808000, 0x0c181830306060c0 },
+    { 0xf0e0e0c0c0808000, 0x0c181830306060c0 },
+    { 0xf0e0e0c0c0808000, 0x0c181830306060c0 },
+    { 0xf0e0e0c0c0808000, 0x0c181830306060c0 },
+    { 0xc0c0c08080808000, 0x30202060604040c0 },
+    { 0xc0c0c08080808000, 0x30202060604040c0 },
+    { 0xc0c0c08080808000, 0x30202060604040c0 },
+    { 0xc0c0c08080808000, 0x30202060604040c0 },
+    { 0x0000000000000000, 0xc0c0c0c0c0c0c0c0 },
+    { 0x0000000000000000, 0xc0c0c0c0c0c0c0c0 },
+    { 0x0000000000000000, 0xc0c0c0c0c0c0c0c0 },
+    { 0x0000000000000000, 0xc0c0c0c0c0c0c0c0 },
+    { 0xfcf8f0e0e0c08000, 0x03060c18183060c0 },
+    { 0xfcf8f0e0e0c08000, 0x03060c18183060c0 },
+    { 0xfcf8f0e0e0c08000, 0x03060c18183060c0 },
+    { 0xfcf8f0e0e0c08000, 0x03060c18183060c0 },
+    { 0xf0e0e0c0c0808000, 0x0c181830306060c0 },
+    { 0xf0e0e0c0c0808000, 0x0c181830306060c0 },
+    { 0xf0e0e0c0c0808000, 0x0c181830306060c0 },
+    { 0xf0e0e0c0c0808000, 0x0c181830306060c0 },
+    { 0xc0c0c08080808000, 0x30202060604040c0 },
+    { 0xc0c0c08080808000, 0x30202060604040c0 },
+    { 0xc0c0c08080808000, 0x30202060604040c0 },
+    { 0xc0c0c08080808000, 0x30202060604040c0 },
+    { 0x0000000000000000, 0xc0c0c0c0c0c0c0c0 },
+    { 0x0000000000000000, 0xc0c0c0c0c0c0c0c0 },
+    { 0x0000000000000000, 0xc0c0c0c0c0c0c0c0 },
+    { 0x0000000000000000, 0xc0c0c0c0c0c0c0c0 },
+    { 0xfcf8f0e0e0c08000, 0x03060c18183060c0 },
+    { 0xfcf8f0e0e0c08000, 0x03060c18183060c0 },
+    { 0xfcf8f0e0e0c08000, 0x03060c18183060c0 },
+    { 0xfcf8f0e0e0c08000, 0x03060c18183060c0 },
+    { 0xf0e0e0c0c0808000, 0x0c181830306060c0 },
+    { 0xf0e0e0c0c0808000, 0x0c181830306060c0 },
+    { 0xf0e0e0c0c0808000, 0x0c181830306060c0 },
+    { 0xf0e0e0c0c0808000, 0x0c181830306060c0 },
+    { 0xc0c0c08080808000, 0x30202060604040c0 },
+    { 0xc0c0c08080808000, 0x30202060604040c0 },
+    { 0xc0c0c08080808000, 0x30202060604040c0 },
+    { 0xc0c0c08080808000, 0x30202060604040c0 },
+    { 0x0000000000000000, 0xc0c0c0c0c0c0c0c0 },
+    { 0x0000000000000000, 0xc0c0c0c0c0c0c0c0 },
+    { 0x0000000000000000, 0xc0c0c0c0c0c0c0c0 },
+    { 0x0000000000000000, 0xc0c0c0c0c0c0c0c0 },
+    { 0xfffffffffffffefc, 0x0000000000000103 },
+    { 0xfffffffffefefefc, 0x0000000001010103 },
+    { 0xfffffefefefefefc, 0x0000010101010103 },
+    { 0xfefefefefefefcfc, 0x0101010101010303 },
+    { 0xfffffffffffffefc, 0x0000000000000103 },
+    { 0xfffffffffefefefc, 0x0000000001010103 },
+    { 0xfffffefefefefefc, 0x0000010101010103 },
+    { 0xfefefefefefefcfc, 0x0101010101010303 },
+    { 0xfffffffffffffefc, 0x0000000000000103 },
+    { 0xfffffffffefefefc, 0x0000000001010103 },
+    { 0xfffffefefefefefc, 0x0000010101010103 },
+    { 0xfefefefefefefcfc, 0x0101010101010303 },
+    { 0xfffffffffffffefc, 0x0000000000000103 },
+    { 0xfffffffffefefefc, 0x0000000001010103 },
+    { 0xfffffefefefefefc, 0x0000010101010103 },
+    { 0xfefefefefefefcfc, 0x0101010101010303 },
+    { 0xfffffffffffffefc, 0x0000000000000103 },
+    { 0xfffffffffefefefc, 0x0000000001010103 },
+    { 0xfffffefefefefefc, 0x0000010101010103 },
+    { 0xfefefefefefefcfc, 0x0101010101010303 },
+    { 0xfffffffffffffefc, 0x0000000000000103 },
+    { 0xfffffffffefefefc, 0x0000000001010103 },
+    { 0xfffffefefefefefc, 0x0000010101010103 },
+    { 0xfefefefefefefcfc, 0x0101010101010303 },
+    { 0xfffffffffffffefc, 0x0000000000000103 },
+    { 0xfffffffffefefefc, 0x0000000001010103 },
+    { 0xfffffefefefefefc, 0x0000010101010103 },
+    { 0xfefefefefefefcfc, 0x0101010101010303 },
+    { 0xfffffffffffffefc, 0x0000000000000103 },
+    { 0xfffffffffefefefc, 0x0000000001010103 },
+    { 0xfffffefefefefefc, 0x0000010101010103 },
+    { 0xfefefefefefefcfc, 0x0101010101010303 },
+    { 0xfffffffffffffefc, 0x0000000000000103 },
+    { 0xfffffffffefefefc, 0x0000000001010103 },
+    { 0xfffffefefefefefc, 0x0000010101010103 },
+    { 0xfefefefefefefcfc, 0x0101010101010303 },
+    { 0xfffffffffffffefc, 0x0000000000000103 },
+    { 0xfffffffffefefefc, 0x0000000001010103 },
+    { 0xfffffefefefefefc, 0x0000010101010103 },
+    { 0xfefefefefefefcfc, 0x0101010101010303 },
+    { 0xfffffffffffffefc, 0x0000000000000103 },
+    { 0xfffffffffefefefc, 0x0000000001010103 },
+    { 0xfffffefefefefefc, 0x0000010101010103 },
+    { 0xfefefefefefefcfc, 0x0101010101010303 },
+    { 0xfffffffffffffefc, 0x0000000000000103 },
+    { 0xfffffffffefefefc, 0x0000000001010103 },
+    { 0xfffffefefefefefc, 0x0000010101010103 },
+    { 0xfefefefefefefcfc, 0x0101010101010303 },
+    { 0xfffffffffffffefc, 0x0000000000000103 },
+    { 0xfffffffffefefefc, 0x0000000001010103 },
+    { 0xfffffefefefefefc, 0x0000010101010103 },
+    { 0xfefefefefefefcfc, 0x0101010101010303 },
+    { 0xfffffffffffffefc, 0x0000000000000103 },
+    { 0xfffffffffefefefc, 0x0000000001010103 },
+    { 0xfffffefefefefefc, 0x0000010101010103 },
+    { 0xfefefefefefefcfc, 0x0101010101010303 },
+    { 0xfffffffffffffefc, 0x0000000000000103 },
+    { 0xfffffffffefefefc, 0x0000000001010103 },
+    { 0xfffffefefefefefc, 0x0000010101010103 },
+    { 0xfefefefefefefcfc, 0x0101010101010303 },
+    { 0xfffffffffffffefc, 0x0000000000000103 },
+    { 0xfffffffffefefefc, 0x0000000001010103 },
+    { 0xfffffefefefefefc, 0x0000010101010103 },
+    { 0xfefefefefefefcfc, 0x0101010101010303 },
+    { 0xfffffffffffffef0, 0x000000000000010f },
+    { 0xfffffffffefcf8f0, 0x000000000103070e },
+    { 0xfffffefefcfcf8f0, 0x000001010302060c },
+    { 0xfefefefcfcf8f8f0, 0x010101030206040c },
+    { 0xfffffffffffffef0, 0x000000000000010f },
+    { 0xfffffffffefcf8f0, 0x000000000103070e },
+    { 0xfffffefefcfcf8f0, 0x000001010302060c },
+    { 0xfefefefcfcf8f8f0, 0x010101030206040c },
+    { 0xfffffffffffffef0, 0x000000000000010f },
+    { 0xfffffffffefcf8f0, 0x000000000103070e },
+    { 0xfffffefefcfcf8f0, 0x000001010302060c },
+    { 0xfefefefcfcf8f8f0, 0x010101030206040c },
+    { 0xfffffffffffffef0, 0x000000000000010f },
+    { 0xfffffffffefcf8f0, 0x000000000103070e },
+    { 0xfffffefefcfcf8f0, 0x000001010302060c },
+    { 0xfefefefcfcf8f8f0, 0x010101030206040c },
+    { 0xfffffffffffffef0, 0x000000000000010f },
+    { 0xfffffffffefcf8f0, 0x000000000103070e },
+    { 0xfffffefefcfcf8f0, 0x000001010302060c },
+    { 0xfefefefcfcf8f8f0, 0x010101030206040c },
+    { 0xfffffffffffffef0, 0x000000000000010f },
+    { 0xfffffffffefcf8f0, 0x000000000103070e },
+    { 0xfffffefefcfcf8f0, 0x000001010302060c },
+    { 0xfefefefcfcf8f8f0, 0x010101030206040c },
+    { 0xfffffffffffffef0, 0x000000000000010f },
+    { 0xfffffffffefcf8f0, 0x000000000103070e },
+    { 0xfffffefefcfcf8f0, 0x000001010302060c },
+    { 0xfefefefcfcf8f8f0, 0x010101030206040c },
+    { 0xfffffffffffffef0, 0x000000000000010f },
+    { 0xfffffffffefcf8f0, 0x000000000103070e },
+    { 0xfffffefefcfcf8f0, 0x000001010302060c },
+    { 0xfefefefcfcf8f8f0, 0x010101030206040c },
+    { 0xfffffffffffffef0, 0x000000000000010f },
+    { 0xfffffffffefcf8f0, 0x000000000103070e },
+    { 0xfffffefefcfcf8f0, 0x000001010302060c },
+    { 0xfefefefcfcf8f8f0, 0x010101030206040c },
+    { 0xfffffffffffffef0, 0x000000000000010f },
+    { 0xfffffffffefcf8f0, 0x000000000103070e },
+    { 0xfffffefefcfcf8f0, 0x000001010302060c },
+    { 0xfefefefcfcf8f8f0, 0x010101030206040c },
+    { 0xfffffffffffffef0, 0x000000000000010f },
+    { 0xfffffffffefcf8f0, 0x000000000103070e },
+    { 0xfffffefefcfcf8f0, 0x000001010302060c },
+    { 0xfefefefcfcf8f8f0, 0x010101030206040c },
+    { 0xfffffffffffffef0, 0x000000000000010f },
+    { 0xfffffffffefcf8f0, 0x000000000103070e },
+    { 0xfffffefefcfcf8f0, 0x000001010302060c },
+    { 0xfefefefcfcf8f8f0, 0x010101030206040c },
+    { 0xfffffffffffffef0, 0x000000000000010f },
+    { 0xfffffffffefcf8f0, 0x000000000103070e },
+    { 0xfffffefefcfcf8f0, 0x000001010302060c },
+    { 0xfefefefcfcf8f8f0, 0x010101030206040c },
+    { 0xfffffffffffffef0, 0x000000000000010f },
+    { 0xfffffffffefcf8f0, 0x000000000103070e },
+    { 0xfffffefefcfcf8f0, 0x000001010302060c },
+    { 0xfefefefcfcf8f8f0, 0x010101030206040c },
+    { 0xfffffffffffffef0, 0x000000000000010f },
+    { 0xfffffffffefcf8f0, 0x000000000103070e },
+    { 0xfffffefefcfcf8f0, 0x000001010302060c },
+    { 0xfefefefcfcf8f8f0, 0x010101030206040c },
+    { 0xfffffffffffffef0, 0x000000000000010f },
+    { 0xfffffffffefcf8f0, 0x000000000103070e },
+    { 0xfffffefefcfcf8f0, 0x000001010302060c },
+    { 0xfefefefcfcf8f8f0, 0x010101030206040c },
+    { 0xfffffffffffffec0, 0x000000000000013f },
+    { 0xfffffffffefcf0c0, 0x0000000001030e38 },
+    { 0xfffffefcf8f0e0c0, 0x00000103070e1c38 },
+    { 0xfefefcf8f8f0e0c0, 0x01010306040c1830 },
+    { 0xfffffffffffffec0, 0x000000000000013f },
+    { 0xfffffffffefcf0c0, 0x0000000001030e38 },
+    { 0xfffffefcf8f0e0c0, 0x00000103070e1c38 },
+    { 0xfefefcf8f8f0e0c0, 0x01010306040c1830 },
+    { 0xfffffffffffffec0, 0x000000000000013f },
+    { 0xfffffffffefcf0c0, 0x0000000001030e38 },
+    { 0xfffffefcf8f0e0c0, 0x00000103070e1c38 },
+    { 0xfefefcf8f8f0e0c0, 0x01010306040c1830 },
+    { 0xfffffffffffffec0, 0x000000000000013f },
+    { 0xfffffffffefcf0c0, 0x0000000001030e38 },
+    { 0xfffffefcf8f0e0c0, 0x00000103070e1c38 },
+    { 0xfefefcf8f8f0e0c0, 0x01010306040c1830 },
+    { 0xfffffffffffffec0, 0x000000000000013f },
+    { 0xfffffffffefcf0c0, 0x0000000001030e38 },
+    { 0xfffffefcf8f0e0c0, 0x00000103070e1c38 },
+    { 0xfefefcf8f8f0e0c0, 0x01010306040c1830 },
+    { 0xfffffffffffffec0, 0x000000000000013f },
+    { 0xfffffffffefcf0c0, 0x0000000001030e38 },
+    { 0xfffffefcf8f0e0c0, 0x00000103070e1c38 },
+    { 0xfefefcf8f8f0e0c0, 0x01010306040c1830 },
+    { 0xfffffffffffffec0, 0x000000000000013f },
+    { 0xfffffffffefcf0c0, 0x0000000001030e38 },
+    { 0xfffffefcf8f0e0c0, 0x00000103070e1c38 },
+    { 0xfefefcf8f8f0e0c0, 0x01010306040c1830 },
+    { 0xfffffffffffffec0, 0x000000000000013f },
+    { 0xfffffffffefcf0c0, 0x0000000001030e38 },
+    { 0xfffffefcf8f0e0c0, 0x00000103070e1c38 },
+    { 0xfefefcf8f8f0e0c0, 0x01010306040c1830 },
+    { 0xfffffffffffffec0, 0x000000000000013f },
+    { 0xfffffffffefcf0c0, 0x0000000001030e38 },
+    { 0xfffffefcf8f0e0c0, 0x00000103070e1c38 },
+    { 0xfefefcf8f8f0e0c0, 0x01010306040c1830 },
+    { 0xfffffffffffffec0, 0x000000000000013f },
+    { 0xfffffffffefcf0c0, 0x0000000001030e38 },
+    { 0xfffffefcf8f0e0c0, 0x00000103070e1c38 },
+    { 0xfefefcf8f8f0e0c0, 0x01010306040c1830 },
+    { 0xfffffffffffffec0, 0x000000000000013f },
+    { 0xfffffffffefcf0c0, 0x0000000001030e38 },
+    { 0xfffffefcf8f0e0c0, 0x00000103070e1c38 },
+    { 0xfefefcf8f8f0e0c0, 0x01010306040c1830 },
+    { 0xfffffffffffffec0, 0x000000000000013f },
+    { 0xfffffffffefcf0c0, 0x0000000001030e38 },
+    { 0xfffffefcf8f0e0c0, 0x00000103070e1c38 },
+    { 0xfefefcf8f8f0e0c0, 0x01010306040c1830 },
+    { 0xfffffffffffffec0, 0x000000000000013f },
+    { 0xfffffffffefcf0c0, 0x0000000001030e38 },
+    { 0xfffffefcf8f0e0c0, 0x00000103070e1c38 },
+    { 0xfefefcf8f8f0e0c0, 0x01010306040c1830 },
+    { 0xfffffffffffffec0, 0x000000000000013f },
+    { 0xfffffffffefcf0c0, 0x0000000001030e38 },
+    { 0xfffffefcf8f0e0c0, 0x00000103070e1c38 },
+    { 0xfefefcf8f8f0e0c0, 0x01010306040c1830 },
+    { 0xfffffffffffffec0, 0x000000000000013f },
+    { 0xfffffffffefcf0c0, 0x0000000001030e38 },
+    { 0xfffffefcf8f0e0c0, 0x00000103070e1c38 },
+    { 0xfefefcf8f8f0e0c0, 0x01010306040c1830 },
+    { 0xfffffffffffffec0, 0x000000000000013f },
+    { 0xfffffffffefcf0c0, 0x0000000001030e38 },
+    { 0xfffffefcf8f0e0c0, 0x00000103070e1c38 },
+    { 0xfefefcf8f8f0e0c0, 0x01010306040c1830 },
+    { 0xfffffffffffffc00, 0x00000000000003ff },
+    { 0xfffffffffef8e000, 0x0000000001071cf0 },
+    { 0xfffffefcf8e0c000, 0x00000103061c30e0 },
+    { 0xfefcf8f0e0c08000, 0x0103070e1c3870e0 },
+    { 0xfffffffffffffc00, 0x00000000000003ff },
+    { 0xfffffffffef8e000, 0x0000000001071cf0 },
+    { 0xfffffefcf8e0c000, 0x00000103061c30e0 },
+    { 0xfefcf8f0e0c08000, 0x0103070e1c3870e0 },
+    { 0xfffffffffffffc00, 0x00000000000003ff },
+    { 0xfffffffffef8e000, 0x0000000001071cf0 },
+    { 0xfffffefcf8e0c000, 0x00000103061c30e0 },
+    { 0xfefcf8f0e0c08000, 0x0103070e1c3870e0 },
+    { 0xfffffffffffffc00, 0x00000000000003ff },
+    { 0xfffffffffef8e000, 0x0000000001071cf0 },
+    { 0xfffffefcf8e0c000, 0x00000103061c30e0 },
+    { 0xfefcf8f0e0c08000, 0x0103070e1c3870e0 },
+    { 0xfffffffffffffc00, 0x00000000000003ff },
+    { 0xfffffffffef8e000, 0x0000000001071cf0 },
+    { 0xfffffefcf8e0c000, 0x00000103061c30e0 },
+    { 0xfefcf8f0e0c08000, 0x0103070e1c3870e0 },
+    { 0xfffffffffffffc00, 0x00000000000003ff },
+    { 0xfffffffffef8e000, 0x0000000001071cf0 },
+    { 0xfffffefcf8e0c000, 0x00000103061c30e0 },
+    { 0xfefcf8f0e0c08000, 0x0103070e1c3870e0 },
+    { 0xfffffffffffffc00, 0x00000000000003ff },
+    { 0xfffffffffef8e000, 0x0000000001071cf0 },
+    { 0xfffffefcf8e0c000, 0x00000103061c30e0 },
+    { 0xfefcf8f0e0c08000, 0x0103070e1c3870e0 },
+    { 0xfffffffffffffc00, 0x00000000000003ff },
+    { 0xfffffffffef8e000, 0x0000000001071cf0 },
+    { 0xfffffefcf8e0c000, 0x00000103061c30e0 },
+    { 0xfefcf8f0e0c08000, 0x0103070e1c3870e0 },
+    { 0xfffffffffffffc00, 0x00000000000003ff },
+    { 0xfffffffffef8e000, 0x0000000001071cf0 },
+    { 0xfffffefcf8e0c000, 0x00000103061c30e0 },
+    { 0xfefcf8f0e0c08000, 0x0103070e1c3870e0 },
+    { 0xfffffffffffffc00, 0x00000000000003ff },
+    { 0xfffffffffef8e000, 0x0000000001071cf0 },
+    { 0xfffffefcf8e0c000, 0x00000103061c30e0 },
+    { 0xfefcf8f0e0c08000, 0x0103070e1c3870e0 },
+    { 0xfffffffffffffc00, 0x00000000000003ff },
+    { 0xfffffffffef8e000, 0x0000000001071cf0 },
+    { 0xfffffefcf8e0c000, 0x00000103061c30e0 },
+    { 0xfefcf8f0e0c08000, 0x0103070e1c3870e0 },
+    { 0xfffffffffffffc00, 0x00000000000003ff },
+    { 0xfffffffffef8e000, 0x0000000001071cf0 },
+    { 0xfffffefcf8e0c000, 0x00000103061c30e0 },
+    { 0xfefcf8f0e0c08000, 0x0103070e1c3870e0 },
+    { 0xfffffffffffffc00, 0x00000000000003ff },
+    { 0xfffffffffef8e000, 0x0000000001071cf0 },
+    { 0xfffffefcf8e0c000, 0x00000103061c30e0 },
+    { 0xfefcf8f0e0c08000, 0x0103070e1c3870e0 },
+    { 0xfffffffffffffc00, 0x00000000000003ff },
+    { 0xfffffffffef8e000, 0x0000000001071cf0 },
+    { 0xfffffefcf8e0c000, 0x00000103061c30e0 },
+    { 0xfefcf8f0e0c08000, 0x0103070e1c3870e0 },
+    { 0xfffffffffffffc00, 0x00000000000003ff },
+    { 0xfffffffffef8e000, 0x0000000001071cf0 },
+    { 0xfffffefcf8e0c000, 0x00000103061c30e0 },
+    { 0xfefcf8f0e0c08000, 0x0103070e1c3870e0 },
+    { 0xfffffffffffffc00, 0x00000000000003ff },
+    { 0xfffffffffef8e000, 0x0000000001071cf0 },
+    { 0xfffffefcf8e0c000, 0x00000103061c30e0 },
+    { 0xfefcf8f0e0c08000, 0x0103070e1c3870e0 },
+    { 0x0000000000000000, 0x0000000000000103 },
+    { 0x0000000000000000, 0x0000000001010103 },
+    { 0x0000000000000000, 0x0000010101010103 },
+    { 0x0000000000000000, 0x0101010101010303 },
+    { 0x0000000000000000, 0x0000000000000103 },
+    { 0x0000000000000000, 0x0000000001010103 },
+    { 0x0000000000000000, 0x0000010101010103 },
+    { 0x0000000000000000, 0x0101010101010303 },
+    { 0x0000000000000000, 0x0000000000000103 },
+    { 0x0000000000000000, 0x0000000001010103 },
+    { 0x0000000000000000, 0x0000010101010103 },
+    { 0x0000000000000000, 0x0101010101010303 },
+    { 0x0000000000000000, 0x0000000000000103 },
+    { 0x0000000000000000, 0x0000000001010103 },
+    { 0x0000000000000000, 0x0000010101010103 },
+    { 0x0000000000000000, 0x0101010101010303 },
+    { 0x0000000000000000, 0x0000000000000103 },
+    { 0x0000000000000000, 0x0000000001010103 },
+    { 0x0000000000000000, 0x0000010101010103 },
+    { 0x0000000000000000, 0x0101010101010303 },
+    { 0x0000000000000000, 0x0000000000000103 },
+    { 0x0000000000000000, 0x0000000001010103 },
+    { 0x0000000000000000, 0x0000010101010103 },
+    { 0x0000000000000000, 0x0101010101010303 },
+    { 0x0000000000000000, 0x0000000000000103 },
+    { 0x0000000000000000, 0x0000000001010103 },
+    { 0x0000000000000000, 0x0000010101010103 },
+    { 0x0000000000000000, 0x0101010101010303 },
+    { 0x0000000000000000, 0x0000000000000103 },
+    { 0x0000000000000000, 0x0000000001010103 },
+    { 0x0000000000000000, 0x0000010101010103 },
+    { 0x0000000000000000, 0x0101010101010303 },
+    { 0x0000000000000000, 0x0000000000000103 },
+    { 0x0000000000000000, 0x0000000001010103 },
+    { 0x0000000000000000, 0x0000010101010103 },
+    { 0x0000000000000000, 0x0101010101010303 },
+    { 0x0000000000000000, 0x0000000000000103 },
+    { 0x0000000000000000, 0x0000000001010103 },
+    { 0x0000000000000000, 0x0000010101010103 },
+    { 0x0000000000000000, 0x0101010101010303 },
+    { 0x0000000000000000, 0x0000000000000103 },
+    { 0x0000000000000000, 0x0000000001010103 },
+    { 0x0000000000000000, 0x0000010101010103 },
+    { 0x0000000000000000, 0x0101010101010303 },
+    { 0x0000000000000000, 0x0000000000000103 },
+    { 0x0000000000000000, 0x0000000001010103 },
+    { 0x0000000000000000, 0x0000010101010103 },
+    { 0x0000000000000000, 0x0101010101010303 },
+    { 0x0000000000000000, 0x0000000000000103 },
+    { 0x0000000000000000, 0x0000000001010103 },
+    { 0x0000000000000000, 0x0000010101010103 },
+    { 0x0000000000000000, 0x0101010101010303 },
+    { 0x0000000000000000, 0x0000000000000103 },
+    { 0x0000000000000000, 0x0000000001010103 },
+    { 0x0000000000000000, 0x0000010101010103 },
+    { 0x0000000000000000, 0x0101010101010303 },
+    { 0x0000000000000000, 0x0000000000000103 },
+    { 0x0000000000000000, 0x0000000001010103 },
+    { 0x0000000000000000, 0x0000010101010103 },
+    { 0x0000000000000000, 0x0101010101010303 },
+    { 0x0000000000000000, 0x0000000000000103 },
+    { 0x0000000000000000, 0x0000000001010103 },
+    { 0x0000000000000000, 0x0000010101010103 },
+    { 0x0000000000000000, 0x0101010101010303 },
+    { 0x0000000000000000, 0x000000000000010f },
+    { 0x0000000000000001, 0x000000000103070e },
+    { 0x0000000000010103, 0x000001010302060c },
+    { 0x0000000001010303, 0x010101030206040c },
+    { 0x0000000000000000, 0x000000000000010f },
+    { 0x0000000000000001, 0x000000000103070e },
+    { 0x0000000000010103, 0x000001010302060c },
+    { 0x0000000001010303, 0x010101030206040c },
+    { 0x0000000000000000, 0x000000000000010f },
+    { 0x0000000000000001, 0x000000000103070e },
+    { 0x0000000000010103, 0x000001010302060c },
+    { 0x0000000001010303, 0x010101030206040c },
+    { 0x0000000000000000, 0x000000000000010f },
+    { 0x0000000000000001, 0x000000000103070e },
+    { 0x0000000000010103, 0x000001010302060c },
+    { 0x0000000001010303, 0x010101030206040c },
+    { 0x0000000000000000, 0x000000000000010f },
+    { 0x0000000000000001, 0x000000000103070e },
+    { 0x0000000000010103, 0x000001010302060c },
+    { 0x0000000001010303, 0x010101030206040c },
+    { 0x0000000000000000, 0x000000000000010f },
+    { 0x0000000000000001, 0x000000000103070e },
+    { 0x0000000000010103, 0x000001010302060c },
+    { 0x0000000001010303, 0x010101030206040c },
+    { 0x0000000000000000, 0x000000000000010f },
+    { 0x0000000000000001, 0x000000000103070e },
+    { 0x0000000000010103, 0x000001010302060c },
+    { 0x0000000001010303, 0x010101030206040c },
+    { 0x0000000000000000, 0x000000000000010f },
+    { 0x0000000000000001, 0x000000000103070e },
+    { 0x0000000000010103, 0x000001010302060c },
+    { 0x0000000001010303, 0x010101030206040c },
+    { 0x0000000000000000, 0x000000000000010f },
+    { 0x0000000000000001, 0x000000000103070e },
+    { 0x0000000000010103, 0x000001010302060c },
+    { 0x0000000001010303, 0x010101030206040c },
+    { 0x0000000000000000, 0x000000000000010f },
+    { 0x0000000000000001, 0x000000000103070e },
+    { 0x0000000000010103, 0x000001010302060c },
+    { 0x0000000001010303, 0x010101030206040c },
+    { 0x0000000000000000, 0x000000000000010f },
+    { 0x0000000000000001, 0x000000000103070e },
+    { 0x0000000000010103, 0x000001010302060c },
+    { 0x0000000001010303, 0x010101030206040c },
+    { 0x0000000000000000, 0x000000000000010f },
+    { 0x0000000000000001, 0x000000000103070e },
+    { 0x0000000000010103, 0x000001010302060c },
+    { 0x0000000001010303, 0x010101030206040c },
+    { 0x0000000000000000, 0x000000000000010f },
+    { 0x0000000000000001, 0x000000000103070e },
+    { 0x0000000000010103, 0x000001010302060c },
+    { 0x0000000001010303, 0x010101030206040c },
+    { 0x0000000000000000, 0x000000000000010f },
+    { 0x0000000000000001, 0x000000000103070e },
+    { 0x0000000000010103, 0x000001010302060c },
+    { 0x0000000001010303, 0x010101030206040c },
+    { 0x0000000000000000, 0x000000000000010f },
+    { 0x0000000000000001, 0x000000000103070e },
+    { 0x0000000000010103, 0x000001010302060c },
+    { 0x0000000001010303, 0x010101030206040c },
+    { 0x0000000000000000, 0x000000000000010f },
+    { 0x0000000000000001, 0x000000000103070e },
+    { 0x0000000000010103, 0x000001010302060c },
+    { 0x0000000001010303, 0x010101030206040c },
+    { 0x0000000000000000, 0x000000000000013f },
+    { 0x0000000000000107, 0x0000000001030e38 },
+    { 0x0000000000010307, 0x00000103070e1c38 },
+    { 0x000000010303070f, 0x01010306040c1830 },
+    { 0x0000000000000000, 0x000000000000013f },
+    { 0x0000000000000107, 0x0000000001030e38 },
+    { 0x0000000000010307, 0x00000103070e1c38 },
+    { 0x000000010303070f, 0x01010306040c1830 },
+    { 0x0000000000000000, 0x000000000000013f },
+    { 0x0000000000000107, 0x0000000001030e38 },
+    { 0x0000000000010307, 0x00000103070e1c38 },
+    { 0x000000010303070f, 0x01010306040c1830 },
+    { 0x0000000000000000, 0x000000000000013f },
+    { 0x0000000000000107, 0x0000000001030e38 },
+    { 0x0000000000010307, 0x00000103070e1c38 },
+    { 0x000000010303070f, 0x01010306040c1830 },
+    { 0x0000000000000000, 0x000000000000013f },
+    { 0x0000000000000107, 0x0000000001030e38 },
+    { 0x0000000000010307, 0x00000103070e1c38 },
+    { 0x000000010303070f, 0x01010306040c1830 },
+    { 0x0000000000000000, 0x000000000000013f },
+    { 0x0000000000000107, 0x0000000001030e38 },
+    { 0x0000000000010307, 0x00000103070e1c38 },
+    { 0x000000010303070f, 0x01010306040c1830 },
+    { 0x0000000000000000, 0x000000000000013f },
+    { 0x0000000000000107, 0x0000000001030e38 },
+    { 0x0000000000010307, 0x00000103070e1c38 },
+    { 0x000000010303070f, 0x01010306040c1830 },
+    { 0x0000000000000000, 0x000000000000013f },
+    { 0x0000000000000107, 0x0000000001030e38 },
+    { 0x0000000000010307, 0x00000103070e1c38 },
+    { 0x000000010303070f, 0x01010306040c1830 },
+    { 0x0000000000000000, 0x000000000000013f },
+    { 0x0000000000000107, 0x0000000001030e38 },
+    { 0x0000000000010307, 0x00000103070e1c38 },
+    { 0x000000010303070f, 0x01010306040c1830 },
+    { 0x0000000000000000, 0x000000000000013f },
+    { 0x0000000000000107, 0x0000000001030e38 },
+    { 0x0000000000010307, 0x00000103070e1c38 },
+    { 0x000000010303070f, 0x01010306040c1830 },
+    { 0x0000000000000000, 0x000000000000013f },
+    { 0x0000000000000107, 0x0000000001030e38 },
+    { 0x0000000000010307, 0x00000103070e1c38 },
+    { 0x000000010303070f, 0x01010306040c1830 },
+    { 0x0000000000000000, 0x000000000000013f },
+    { 0x0000000000000107, 0x0000000001030e38 },
+    { 0x0000000000010307, 0x00000103070e1c38 },
+    { 0x000000010303070f, 0x01010306040c1830 },
+    { 0x0000000000000000, 0x000000000000013f },
+    { 0x0000000000000107, 0x0000000001030e38 },
+    { 0x0000000000010307, 0x00000103070e1c38 },
+    { 0x000000010303070f, 0x01010306040c1830 },
+    { 0x0000000000000000, 0x000000000000013f },
+    { 0x0000000000000107, 0x0000000001030e38 },
+    { 0x0000000000010307, 0x00000103070e1c38 },
+    { 0x000000010303070f, 0x01010306040c1830 },
+    { 0x0000000000000000, 0x000000000000013f },
+    { 0x0000000000000107, 0x0000000001030e38 },
+    { 0x0000000000010307, 0x00000103070e1c38 },
+    { 0x000000010303070f, 0x01010306040c1830 },
+    { 0x0000000000000000, 0x000000000000013f },
+    { 0x0000000000000107, 0x0000000001030e38 },
+    { 0x0000000000010307, 0x00000103070e1c38 },
+    { 0x000000010303070f, 0x01010306040c1830 },
+    { 0x0000000000000000, 0x00000000000003ff },
+    { 0x000000000000030f, 0x0000000001071cf0 },
+    { 0x0000000001030f1f, 0x00000103061c30e0 },
+    { 0x0000000103070f1f, 0x0103070e1c3870e0 },
+    { 0x0000000000000000, 0x00000000000003ff },
+    { 0x000000000000030f, 0x0000000001071cf0 },
+    { 0x0000000001030f1f, 0x00000103061c30e0 },
+    { 0x0000000103070f1f, 0x0103070e1c3870e0 },
+    { 0x0000000000000000, 0x00000000000003ff },
+    { 0x000000000000030f, 0x0000000001071cf0 },
+    { 0x0000000001030f1f, 0x00000103061c30e0 },
+    { 0x0000000103070f1f, 0x0103070e1c3870e0 },
+    { 0x0000000000000000, 0x00000000000003ff },
+    { 0x000000000000030f, 0x0000000001071cf0 },
+    { 0x0000000001030f1f, 0x00000103061c30e0 },
+    { 0x0000000103070f1f, 0x0103070e1c3870e0 },
+    { 0x0000000000000000, 0x00000000000003ff },
+    { 0x000000000000030f, 0x0000000001071cf0 },
+    { 0x0000000001030f1f, 0x00000103061c30e0 },
+    { 0x0000000103070f1f, 0x0103070e1c3870e0 },
+    { 0x0000000000000000, 0x00000000000003ff },
+    { 0x000000000000030f, 0x0000000001071cf0 },
+    { 0x0000000001030f1f, 0x00000103061c30e0 },
+    { 0x0000000103070f1f, 0x0103070e1c3870e0 },
+    { 0x0000000000000000, 0x00000000000003ff },
+    { 0x000000000000030f, 0x0000000001071cf0 },
+    { 0x0000000001030f1f, 0x00000103061c30e0 },
+    { 0x0000000103070f1f, 0x0103070e1c3870e0 },
+    { 0x0000000000000000, 0x00000000000003ff },
+    { 0x000000000000030f, 0x0000000001071cf0 },
+    { 0x0000000001030f1f, 0x00000103061c30e0 },
+    { 0x0000000103070f1f, 0x0103070e1c3870e0 },
+    { 0x0000000000000000, 0x00000000000003ff },
+    { 0x000000000000030f, 0x0000000001071cf0 },
+    { 0x0000000001030f1f, 0x00000103061c30e0 },
+    { 0x0000000103070f1f, 0x0103070e1c3870e0 },
+    { 0x0000000000000000, 0x00000000000003ff },
+    { 0x000000000000030f, 0x0000000001071cf0 },
+    { 0x0000000001030f1f, 0x00000103061c30e0 },
+    { 0x0000000103070f1f, 0x0103070e1c3870e0 },
+    { 0x0000000000000000, 0x00000000000003ff },
+    { 0x000000000000030f, 0x0000000001071cf0 },
+    { 0x0000000001030f1f, 0x00000103061c30e0 },
+    { 0x0000000103070f1f, 0x0103070e1c3870e0 },
+    { 0x0000000000000000, 0x00000000000003ff },
+    { 0x000000000000030f, 0x0000000001071cf0 },
+    { 0x0000000001030f1f, 0x00000103061c30e0 },
+    { 0x0000000103070f1f, 0x0103070e1c3870e0 },
+    { 0x0000000000000000, 0x00000000000003ff },
+    { 0x000000000000030f, 0x0000000001071cf0 },
+    { 0x0000000001030f1f, 0x00000103061c30e0 },
+    { 0x0000000103070f1f, 0x0103070e1c3870e0 },
+    { 0x0000000000000000, 0x00000000000003ff },
+    { 0x000000000000030f, 0x0000000001071cf0 },
+    { 0x0000000001030f1f, 0x00000103061c30e0 },
+    { 0x0000000103070f1f, 0x0103070e1c3870e0 },
+    { 0x0000000000000000, 0x00000000000003ff },
+    { 0x000000000000030f, 0x0000000001071cf0 },
+    { 0x0000000001030f1f, 0x00000103061c30e0 },
+    { 0x0000000103070f1f, 0x0103070e1c3870e0 },
+    { 0x0000000000000000, 0x00000000000003ff },
+    { 0x000000000000030f, 0x0000000001071cf0 },
+    { 0x0000000001030f1f, 0x00000103061c30e0 },
+    { 0x0000000103070f1f, 0x0103070e1c3870e0 },
+    { 0x0000000000000000, 0x0303030303030303 },
+    { 0x0000000000000000, 0x0303030303030303 },
+    { 0x0000000000000000, 0x0303030303030303 },
+    { 0x0000000000000000, 0x0303030303030303 },
+    { 0x0303030101010100, 0x0c04040606020203 },
+    { 0x0303030101010100, 0x0c04040606020203 },
+    { 0x0303030101010100, 0x0c04040606020203 },
+    { 0x0303030101010100, 0x0c04040606020203 },
+    { 0x0f07070303010100, 0x3018180c0c060603 },
+    { 0x0f07070303010100, 0x3018180c0c060603 },
+    { 0x0f07070303010100, 0x3018180c0c060603 },
+    { 0x0f07070303010100, 0x3018180c0c060603 },
+    { 0x3f1f0f0707030100, 0xc0603018180c0603 },
+    { 0x3f1f0f0707030100, 0xc0603018180c0603 },
+    { 0x3f1f0f0707030100, 0xc0603018180c0603 },
+    { 0x3f1f0f0707030100, 0xc0603018180c0603 },
+    { 0x0000000000000000, 0x0303030303030303 },
+    { 0x0000000000000000, 0x0303030303030303 },
+    { 0x0000000000000000, 0x0303030303030303 },
+    { 0x0000000000000000, 0x0303030303030303 },
+    { 0x0303030101010100, 0x0c04040606020203 },
+    { 0x0303030101010100, 0x0c04040606020203 },
+    { 0x0303030101010100, 0x0c04040606020203 },
+    { 0x0303030101010100, 0x0c04040606020203 },
+    { 0x0f07070303010100, 0x3018180c0c060603 },
+    { 0x0f07070303010100, 0x3018180c0c060603 },
+    { 0x0f07070303010100, 0x3018180c0c060603 },
+    { 0x0f07070303010100, 0x3018180c0c060603 },
+    { 0x3f1f0f0707030100, 0xc0603018180c0603 },
+    { 0x3f1f0f0707030100, 0xc0603018180c0603 },
+    { 0x3f1f0f0707030100, 0xc0603018180c0603 },
+    { 0x3f1f0f0707030100, 0xc0603018180c0603 },
+    { 0x0000000000000000, 0x0303030303030303 },
+    { 0x0000000000000000, 0x0303030303030303 },
+    { 0x0000000000000000, 0x0303030303030303 },
+    { 0x0000000000000000, 0x0303030303030303 },
+    { 0x0303030101010100, 0x0c04040606020203 },
+    { 0x0303030101010100, 0x0c04040606020203 },
+    { 0x0303030101010100, 0x0c04040606020203 },
+    { 0x0303030101010100, 0x0c04040606020203 },
+    { 0x0f07070303010100, 0x3018180c0c060603 },
+    { 0x0f07070303010100, 0x3018180c0c060603 },
+    { 0x0f07070303010100, 0x3018180c0c060603 },
+    { 0x0f07070303010100, 0x3018180c0c060603 },
+    { 0x3f1f0f0707030100, 0xc0603018180c0603 },
+    { 0x3f1f0f0707030100, 0xc0603018180c0603 },
+    { 0x3f1f0f0707030100, 0xc0603018180c0603 },
+    { 0x3f1f0f0707030100, 0xc0603018180c0603 },
+    { 0x0000000000000000, 0x0303030303030303 },
+    { 0x0000000000000000, 0x0303030303030303 },
+    { 0x0000000000000000, 0x0303030303030303 },
+    { 0x0000000000000000, 0x0303030303030303 },
+    { 0x0303030101010100, 0x0c04040606020203 },
+    { 0x0303030101010100, 0x0c04040606020203 },
+    { 0x0303030101010100, 0x0c04040606020203 },
+    { 0x0303030101010100, 0x0c04040606020203 },
+    { 0x0f07070303010100, 0x3018180c0c060603 },
+    { 0x0f07070303010100, 0x3018180c0c060603 },
+    { 0x0f07070303010100, 0x3018180c0c060603 },
+    { 0x0f07070303010100, 0x3018180c0c060603 },
+    { 0x3f1f0f0707030100, 0xc0603018180c0603 },
+    { 0x3f1f0f0707030100, 0xc0603018180c0603 },
+    { 0x3f1f0f0707030100, 0xc0603018180c0603 },
+    { 0x3f1f0f0707030100, 0xc0603018180c0603 },
+    { 0x0001010101030303, 0x030202060604040c },
+    { 0x0001010101030303, 0x030202060604040c },
+    { 0x0001010101030303, 0x030202060604040c },
+    { 0x0001010101030303, 0x030202060604040c },
+    { 0x0303030303030303, 0x0c0c0c0c0c0c0c0c },
+    { 0x0303030303030303, 0x0c0c0c0c0c0c0c0c },
+    { 0x0303030303030303, 0x0c0c0c0c0c0c0c0c },
+    { 0x0303030303030303, 0x0c0c0c0c0c0c0c0c },
+    { 0x0f0f0f0707070703, 0x301010181808080c },
+    { 0x0f0f0f0707070703, 0x301010181808080c },
+    { 0x0f0f0f0707070703, 0x301010181808080c },
+    { 0x0f0f0f0707070703, 0x301010181808080c },
+    { 0x3f1f1f0f0f070703, 0xc06060303018180c },
+    { 0x3f1f1f0f0f070703, 0xc06060303018180c },
+    { 0x3f1f1f0f0f070703, 0xc06060303018180c },
+    { 0x3f1f1f0f0f070703, 0xc06060303018180c },
+    { 0x0001010101030303, 0x030202060604040c },
+    { 0x0001010101030303, 0x030202060604040c },
+    { 0x0001010101030303, 0x030202060604040c },
+    { 0x0001010101030303, 0x030202060604040c },
+    { 0x0303030303030303, 0x0c0c0c0c0c0c0c0c },
+    { 0x0303030303030303, 0x0c0c0c0c0c0c0c0c },
+    { 0x0303030303030303, 0x0c0c0c0c0c0c0c0c },
+    { 0x0303030303030303, 0x0c0c0c0c0c0c0c0c },
+    { 0x0f0f0f0707070703, 0x301010181808080c },
+    { 0x0f0f0f0707070703, 0x301010181808080c },
+    { 0x0f0f0f0707070703, 0x301010181808080c },
+    { 0x0f0f0f0707070703, 0x301010181808080c },
+    { 0x3f1f1f0f0f070703, 0xc06060303018180c },
+    { 0x3f1f1f0f0f070703, 0xc06060303018180c },
+    { 0x3f1f1f0f0f070703, 0xc06060303018180c },
+    { 0x3f1f1f0f0f070703, 0xc06060303018180c },
+    { 0x0001010101030303, 0x030202060604040c },
+    { 0x0001010101030303, 0x030202060604040c },
+    { 0x0001010101030303, 0x030202060604040c },
+    { 0x0001010101030303, 0x030202060604040c },
+    { 0x0303030303030303, 0x0c0c0c0c0c0c0c0c },
+    { 0x0303030303030303, 0x0c0c0c0c0c0c0c0c },
+    { 0x0303030303030303, 0x0c0c0c0c0c0c0c0c },
+    { 0x0303030303030303, 0x0c0c0c0c0c0c0c0c },
+    { 0x0f0f0f0707070703, 0x301010181808080c },
+    { 0x0f0f0f0707070703, 0x301010181808080c },
+    { 0x0f0f0f0707070703, 0x301010181808080c },
+    { 0x0f0f0f0707070703, 0x301010181808080c },
+    { 0x3f1f1f0f0f070703, 0xc06060303018180c },
+    { 0x3f1f1f0f0f070703, 0xc06060303018180c },
+    { 0x3f1f1f0f0f070703, 0xc06060303018180c },
+    { 0x3f1f1f0f0f070703, 0xc06060303018180c },
+    { 0x0001010101030303, 0x030202060604040c },
+    { 0x0001010101030303, 0x030202060604040c },
+    { 0x0001010101030303, 0x030202060604040c },
+    { 0x0001010101030303, 0x030202060604040c },
+    { 0x0303030303030303, 0x0c0c0c0c0c0c0c0c },
+    { 0x0303030303030303, 0x0c0c0c0c0c0c0c0c },
+    { 0x0303030303030303, 0x0c0c0c0c0c0c0c0c },
+    { 0x0303030303030303, 0x0c0c0c0c0c0c0c0c },
+    { 0x0f0f0f0707070703, 0x301010181808080c },
+    { 0x0f0f0f0707070703, 0x301010181808080c },
+    { 0x0f0f0f0707070703, 0x301010181808080c },
+    { 0x0f0f0f0707070703, 0x301010181808080c },
+    { 0x3f1f1f0f0f070703, 0xc06060303018180c },
+    { 0x3f1f1f0f0f070703, 0xc06060303018180c },
+    { 0x3f1f1f0f0f070703, 0xc06060303018180c },
+    { 0x3f1f1f0f0f070703, 0xc06060303018180c },
+    { 0x000101030307070f, 0x0306060c0c181830 },
+    { 0x000101030307070f, 0x0306060c0c181830 },
+    { 0x000101030307070f, 0x0306060c0c181830 },
+    { 0x000101030307070f, 0x0306060c0c181830 },
+    { 0x03070707070f0f0f, 0x0c08081818101030 },
+    { 0x03070707070f0f0f, 0x0c08081818101030 },
+    { 0x03070707070f0f0f, 0x0c08081818101030 },
+    { 0x03070707070f0f0f, 0x0c08081818101030 },
+    { 0x0f0f0f0f0f0f0f0f, 0x3030303030303030 },
+    { 0x0f0f0f0f0f0f0f0f, 0x3030303030303030 },
+    { 0x0f0f0f0f0f0f0f0f, 0x3030303030303030 },
+    { 0x0f0f0f0f0f0f0f0f, 0x3030303030303030 },
+    { 0x3f3f3f1f1f1f1f0f, 0xc040406060202030 },
+    { 0x3f3f3f1f1f1f1f0f, 0xc040406060202030 },
+    { 0x3f3f3f1f1f1f1f0f, 0xc040406060202030 },
+    { 0x3f3f3f1f1f1f1f0f, 0xc040406060202030 },
+    { 0x000101030307070f, 0x0306060c0c181830 },
+    { 0x000101030307070f, 0x0306060c0c181830 },
+    { 0x000101030307070f, 0x0306060c0c181830 },
+    { 0x000101030307070f, 0x0306060c0c181830 },
+    { 0x03070707070f0f0f, 0x0c08081818101030 },
+    { 0x03070707070f0f0f, 0x0c08081818101030 },
+    { 0x03070707070f0f0f, 0x0c08081818101030 },
+    { 0x03070707070f0f0f, 0x0c08081818101030 },
+    { 0x0f0f0f0f0f0f0f0f, 0x3030303030303030 },
+    { 0x0f0f0f0f0f0f0f0f, 0x3030303030303030 },
+    { 0x0f0f0f0f0f0f0f0f, 0x3030303030303030 },
+    { 0x0f0f0f0f0f0f0f0f, 0x3030303030303030 },
+    { 0x3f3f3f1f1f1f1f0f, 0xc040406060202030 },
+    { 0x3f3f3f1f1f1f1f0f, 0xc040406060202030 },
+    { 0x3f3f3f1f1f1f1f0f, 0xc040406060202030 },
+    { 0x3f3f3f1f1f1f1f0f, 0xc040406060202030 },
+    { 0x000101030307070f, 0x0306060c0c181830 },
+    { 0x000101030307070f, 0x0306060c0c181830 },
+    { 0x000101030307070f, 0x0306060c0c181830 },
+    { 0x000101030307070f, 0x0306060c0c181830 },
+    { 0x03070707070f0f0f, 0x0c08081818101030 },
+    { 0x03070707070f0f0f, 0x0c08081818101030 },
+    { 0x03070707070f0f0f, 0x0c08081818101030 },
+    { 0x03070707070f0f0f, 0x0c08081818101030 },
+    { 0x0f0f0f0f0f0f0f0f, 0x3030303030303030 },
+    { 0x0f0f0f0f0f0f0f0f, 0x3030303030303030 },
+    { 0x0f0f0f0f0f0f0f0f, 0x3030303030303030 },
+    { 0x0f0f0f0f0f0f0f0f, 0x3030303030303030 },
+    { 0x3f3f3f1f1f1f1f0f, 0xc040406060202030 },
+    { 0x3f3f3f1f1f1f1f0f, 0xc040406060202030 },
+    { 0x3f3f3f1f1f1f1f0f, 0xc040406060202030 },
+    { 0x3f3f3f1f1f1f1f0f, 0xc040406060202030 },
+    { 0x000101030307070f, 0x0306060c0c181830 },
+    { 0x000101030307070f, 0x0306060c0c181830 },
+    { 0x000101030307070f, 0x0306060c0c181830 },
+    { 0x000101030307070f, 0x0306060c0c181830 },
+    { 0x03070707070f0f0f, 0x0c08081818101030 },
+    { 0x03070707070f0f0f, 0x0c08081818101030 },
+    { 0x03070707070f0f0f, 0x0c08081818101030 },
+    { 0x03070707070f0f0f, 0x0c08081818101030 },
+    { 0x0f0f0f0f0f0f0f0f, 0x3030303030303030 },
+    { 0x0f0f0f0f0f0f0f0f, 0x3030303030303030 },
+    { 0x0f0f0f0f0f0f0f0f, 0x3030303030303030 },
+    { 0x0f0f0f0f0f0f0f0f, 0x3030303030303030 },
+    { 0x3f3f3f1f1f1f1f0f, 0xc040406060202030 },
+    { 0x3f3f3f1f1f1f1f0f, 0xc040406060202030 },
+    { 0x3f3f3f1f1f1f1f0f, 0xc040406060202030 },
+    { 0x3f3f3f1f1f1f1f0f, 0xc040406060202030 },
+    { 0x00010307070f1f3f, 0x03060c18183060c0 },
+    { 0x00010307070f1f3f, 0x03060c18183060c0 },
+    { 0x00010307070f1f3f, 0x03060c18183060c0 },
+    { 0x00010307070f1f3f, 0x03060c18183060c0 },
+    { 0x0307070f0f1f1f3f, 0x0c181830306060c0 },
+    { 0x0307070f0f1f1f3f, 0x0c181830306060c0 },
+    { 0x0307070f0f1f1f3f, 0x0c181830306060c0 },
+    { 0x0307070f0f1f1f3f, 0x0c181830306060c0 },
+    { 0x0f1f1f1f1f3f3f3f, 0x30202060604040c0 },
+    { 0x0f1f1f1f1f3f3f3f, 0x30202060604040c0 },
+    { 0x0f1f1f1f1f3f3f3f, 0x30202060604040c0 },
+    { 0x0f1f1f1f1f3f3f3f, 0x30202060604040c0 },
+    { 0x3f3f3f3f3f3f3f3f, 0xc0c0c0c0c0c0c0c0 },
+    { 0x3f3f3f3f3f3f3f3f, 0xc0c0c0c0c0c0c0c0 },
+    { 0x3f3f3f3f3f3f3f3f, 0xc0c0c0c0c0c0c0c0 },
+    { 0x3f3f3f3f3f3f3f3f, 0xc0c0c0c0c0c0c0c0 },
+    { 0x00010307070f1f3f, 0x03060c18183060c0 },
+    { 0x00010307070f1f3f, 0x03060c18183060c0 },
+    { 0x00010307070f1f3f, 0x03060c18183060c0 },
+    { 0x00010307070f1f3f, 0x03060c18183060c0 },
+    { 0x0307070f0f1f1f3f, 0x0c181830306060c0 },
+    { 0x0307070f0f1f1f3f, 0x0c181830306060c0 },
+    { 0x0307070f0f1f1f3f, 0x0c181830306060c0 },
+    { 0x0307070f0f1f1f3f, 0x0c181830306060c0 },
+    { 0x0f1f1f1f1f3f3f3f, 0x30202060604040c0 },
+    { 0x0f1f1f1f1f3f3f3f, 0x30202060604040c0 },
+    { 0x0f1f1f1f1f3f3f3f, 0x30202060604040c0 },
+    { 0x0f1f1f1f1f3f3f3f, 0x30202060604040c0 },
+    { 0x3f3f3f3f3f3f3f3f, 0xc0c0c0c0c0c0c0c0 },
+    { 0x3f3f3f3f3f3f3f3f, 0xc0c0c0c0c0c0c0c0 },
+    { 0x3f3f3f3f3f3f3f3f, 0xc0c0c0c0c0c0c0c0 },
+    { 0x3f3f3f3f3f3f3f3f, 0xc0c0c0c0c0c0c0c0 },
+    { 0x00010307070f1f3f, 0x03060c18183060c0 },
+    { 0x00010307070f1f3f, 0x03060c18183060c0 },
+    { 0x00010307070f1f3f, 0x03060c18183060c0 },
+    { 0x00010307070f1f3f, 0x03060c18183060c0 },
+    { 0x0307070f0f1f1f3f, 0x0c181830306060c0 },
+    { 0x0307070f0f1f1f3f, 0x0c181830306060c0 },
+    { 0x0307070f0f1f1f3f, 0x0c181830306060c0 },
+    { 0x0307070f0f1f1f3f, 0x0c181830306060c0 },
+    { 0x0f1f1f1f1f3f3f3f, 0x30202060604040c0 },
+    { 0x0f1f1f1f1f3f3f3f, 0x30202060604040c0 },
+    { 0x0f1f1f1f1f3f3f3f, 0x30202060604040c0 },
+    { 0x0f1f1f1f1f3f3f3f, 0x30202060604040c0 },
+    { 0x3f3f3f3f3f3f3f3f, 0xc0c0c0c0c0c0c0c0 },
+    { 0x3f3f3f3f3f3f3f3f, 0xc0c0c0c0c0c0c0c0 },
+    { 0x3f3f3f3f3f3f3f3f, 0xc0c0c0c0c0c0c0c0 },
+    { 0x3f3f3f3f3f3f3f3f, 0xc0c0c0c0c0c0c0c0 },
+    { 0x00010307070f1f3f, 0x03060c18183060c0 },
+    { 0x00010307070f1f3f, 0x03060c18183060c0 },
+    { 0x00010307070f1f3f, 0x03060c18183060c0 },
+    { 0x00010307070f1f3f, 0x03060c18183060c0 },
+    { 0x0307070f0f1f1f3f, 0x0c181830306060c0 },
+    { 0x0307070f0f1f1f3f, 0x0c181830306060c0 },
+    { 0x0307070f0f1f1f3f, 0x0c181830306060c0 },
+    { 0x0307070f0f1f1f3f, 0x0c181830306060c0 },
+    { 0x0f1f1f1f1f3f3f3f, 0x30202060604040c0 },
+    { 0x0f1f1f1f1f3f3f3f, 0x30202060604040c0 },
+    { 0x0f1f1f1f1f3f3f3f, 0x30202060604040c0 },
+    { 0x0f1f1f1f1f3f3f3f, 0x30202060604040c0 },
+    { 0x3f3f3f3f3f3f3f3f, 0xc0c0c0c0c0c0c0c0 },
+    { 0x3f3f3f3f3f3f3f3f, 0xc0c0c0c0c0c0c0c0 },
+    { 0x3f3f3f3f3f3f3f3f, 0xc0c0c0c0c0c0c0c0 },
+    { 0x3f3f3f3f3f3f3f3f, 0xc0c0c0c0c0c0c0c0 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c183 },
+    { 0xf8f0e0c080000000, 0x070e1c3871e1c183 },
+    { 0xf8f0e0c080000000, 0x070e1d3971e1c183 },
+    { 0xf8f0e0c080000000, 0x070f1d3971e1c383 },
+    { 0xf0e0c0c080000000, 0x0c18302060c08183 },
+    { 0xf0e0c0c080000000, 0x0c18302061c18183 },
+    { 0xf0e0c0c080000000, 0x0c18312161c18183 },
+    { 0xf0e0c0c080000000, 0x0d19312161c18383 },
+    { 0xc0c0808000000000, 0x30206040c0808183 },
+    { 0xc0c0808000000000, 0x30206040c1818183 },
+    { 0xc0c0808000000000, 0x30206141c1818183 },
+    { 0xc0c0808000000000, 0x31216141c1818383 },
+    { 0x0000000000000000, 0xc0c0808080808183 },
+    { 0x0000000000000000, 0xc0c0808081818183 },
+    { 0x0000000000000000, 0xc0c0818181818183 },
+    { 0x0000000000000000, 0xc1c1818181818383 },
+    { 0xf8f0c08000000000, 0x070c3860c0800103 },
+    { 0xf8f0c08000000000, 0x070c3860c1810103 },
+    { 0xf8f0c08000000000, 0x070c3961c1810103 },
+    { 0xf8f0c08000000000, 0x070d3961c1810303 },
+    { 0xe0c0800000000000, 0x1c3870e0c0800103 },
+    { 0xe0c0800000000000, 0x1c3870e0c1810103 },
+    { 0xe0c0800000000000, 0x1c3871e1c1810103 },
+    { 0xe0c0800000000000, 0x1d3971e1c1810303 },
+    { 0xc080800000000000, 0x306040c080800103 },
+    { 0xc080800000000000, 0x306040c081810103 },
+    { 0xc080800000000000, 0x306041c181810103 },
+    { 0xc080800000000000, 0x316141c181810303 },
+    { 0x0000000000000000, 0xc080808080800103 },
+    { 0x0000000000000000, 0xc080808081810103 },
+    { 0x0000000000000000, 0xc080818181810103 },
+    { 0x0000000000000000, 0xc181818181810303 },
+    { 0xf0c0000000000000, 0x0f38e08000000103 },
+    { 0xf0c0000000000000, 0x0f38e08001010103 },
+    { 0xf0c0000000000000, 0x0f38e18101010103 },
+    { 0xf0c0000000000000, 0x0f39e18101010303 },
+    { 0xe080000000000000, 0x1c70c08000000103 },
+    { 0xe080000000000000, 0x1c70c08001010103 },
+    { 0xe080000000000000, 0x1c70c18101010103 },
+    { 0xe080000000000000, 0x1d71c18101010303 },
+    { 0x8000000000000000, 0x70e0c08000000103 },
+    { 0x8000000000000000, 0x70e0c08001010103 },
+    { 0x8000000000000000, 0x70e0c18101010103 },
+    { 0x8000000000000000, 0x71e1c18101010303 },
+    { 0x0000000000000000, 0xc080808000000103 },
+    { 0x0000000000000000, 0xc080808001010103 },
+    { 0x0000000000000000, 0xc080818101010103 },
+    { 0x0000000000000000, 0xc181818101010303 },
+    { 0x0000000000000000, 0xffc0000000000103 },
+    { 0x0000000000000000, 0xffc0000001010103 },
+    { 0x0000000000000000, 0xffc0010101010103 },
+    { 0x0000000000000000, 0xffc1010101010303 },
+    { 0x0000000000000000, 0xfc80000000000103 },
+    { 0x0000000000000000, 0xfc80000001010103 },
+    { 0x0000000000000000, 0xfc80010101010103 },
+    { 0x0000000000000000, 0xfd81010101010303 },
+    { 0x0000000000000000, 0xf080000000000103 },
+    { 0x0000000000000000, 0xf080000001010103 },
+    { 0x0000000000000000, 0xf080010101010103 },
+    { 0x0000000000000000, 0xf181010101010303 },
+    { 0x0000000000000000, 0xc080000000000103 },
+    { 0x0000000000000000, 0xc080000001010103 },
+    { 0x0000000000000000, 0xc080010101010103 },
+    { 0x0000000000000000, 0xc181010101010303 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c18f },
+    { 0xf8f0e0c080000001, 0x070e1c3871e3c78e },
+    { 0xf8f0e0c080010103, 0x070e1d3973e2c68c },
+    { 0xf8f0e0c081010303, 0x070f1d3b72e6c48c },
+    { 0xf0e0c0c080000000, 0x0c18302060c0818f },
+    { 0xf0e0c0c080000001, 0x0c18302061c3878e },
+    { 0xf0e0c0c080010103, 0x0c18312163c2868c },
+    { 0xf0e0c0c081010303, 0x0d19312362c6848c },
+    { 0xc0c0808000000000, 0x30206040c080818f },
+    { 0xc0c0808000000001, 0x30206040c183878e },
+    { 0xc0c0808000010103, 0x30206141c382868c },
+    { 0xc0c0808001010303, 0x31216143c286848c },
+    { 0x0000000000000000, 0xc0c080808080818f },
+    { 0x0000000000000001, 0xc0c080808183878e },
+    { 0x0000000000010103, 0xc0c081818382868c },
+    { 0x0000000001010303, 0xc1c181838286848c },
+    { 0xf8f0c08000000000, 0x070c3860c080010f },
+    { 0xf8f0c08000000001, 0x070c3860c183070e },
+    { 0xf8f0c08000010103, 0x070c3961c382060c },
+    { 0xf8f0c08001010303, 0x070d3963c286040c },
+    { 0xe0c0800000000000, 0x1c3870e0c080010f },
+    { 0xe0c0800000000001, 0x1c3870e0c183070e },
+    { 0xe0c0800000010103, 0x1c3871e1c382060c },
+    { 0xe0c0800001010303, 0x1d3971e3c286040c },
+    { 0xc080800000000000, 0x306040c08080010f },
+    { 0xc080800000000001, 0x306040c08183070e },
+    { 0xc080800000010103, 0x306041c18382060c },
+    { 0xc080800001010303, 0x316141c38286040c },
+    { 0x0000000000000000, 0xc08080808080010f },
+    { 0x0000000000000001, 0xc08080808183070e },
+    { 0x0000000000010103, 0xc08081818382060c },
+    { 0x0000000001010303, 0xc18181838286040c },
+    { 0xf0c0000000000000, 0x0f38e0800000010f },
+    { 0xf0c0000000000001, 0x0f38e0800103070e },
+    { 0xf0c0000000010103, 0x0f38e1810302060c },
+    { 0xf0c0000001010303, 0x0f39e1830206040c },
+    { 0xe080000000000000, 0x1c70c0800000010f },
+    { 0xe080000000000001, 0x1c70c0800103070e },
+    { 0xe080000000010103, 0x1c70c1810302060c },
+    { 0xe080000001010303, 0x1d71c1830206040c },
+    { 0x8000000000000000, 0x70e0c0800000010f },
+    { 0x8000000000000001, 0x70e0c0800103070e },
+    { 0x8000000000010103, 0x70e0c1810302060c },
+    { 0x8000000001010303, 0x71e1c1830206040c },
+    { 0x0000000000000000, 0xc08080800000010f },
+    { 0x0000000000000001, 0xc08080800103070e },
+    { 0x0000000000010103, 0xc08081810302060c },
+    { 0x0000000001010303, 0xc18181830206040c },
+    { 0x0000000000000000, 0xffc000000000010f },
+    { 0x0000000000000001, 0xffc000000103070e },
+    { 0x0000000000010103, 0xffc001010302060c },
+    { 0x0000000001010303, 0xffc101030206040c },
+    { 0x0000000000000000, 0xfc8000000000010f },
+    { 0x0000000000000001, 0xfc8000000103070e },
+    { 0x0000000000010103, 0xfc8001010302060c },
+    { 0x0000000001010303, 0xfd8101030206040c },
+    { 0x0000000000000000, 0xf08000000000010f },
+    { 0x0000000000000001, 0xf08000000103070e },
+    { 0x0000000000010103, 0xf08001010302060c },
+    { 0x0000000001010303, 0xf18101030206040c },
+    { 0x0000000000000000, 0xc08000000000010f },
+    { 0x0000000000000001, 0xc08000000103070e },
+    { 0x0000000000010103, 0xc08001010302060c },
+    { 0x0000000001010303, 0xc18101030206040c },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c1bf },
+    { 0xf8f0e0c080000107, 0x070e1c3871e3ceb8 },
+    { 0xf8f0e0c080010307, 0x070e1d3b77eedcb8 },
+    { 0xf8f0e0c18303070f, 0x070f1f3e74ecd8b0 },
+    { 0xf0e0c0c080000000, 0x0c18302060c081bf },
+    { 0xf0e0c0c080000107, 0x0c18302061c38eb8 },
+    { 0xf0e0c0c080010307, 0x0c18312367ce9cb8 },
+    { 0xf0e0c0c18303070f, 0x0d19332664cc98b0 },
+    { 0xc0c0808000000000, 0x30206040c08081bf },
+    { 0xc0c0808000000107, 0x30206040c1838eb8 },
+    { 0xc0c0808000010307, 0x30206143c78e9cb8 },
+    { 0xc0c080810303070f, 0x31216346c48c98b0 },
+    { 0x0000000000000000, 0xc0c08080808081bf },
+    { 0x0000000000000107, 0xc0c0808081838eb8 },
+    { 0x0000000000010307, 0xc0c08183878e9cb8 },
+    { 0x000000010303070f, 0xc1c18386848c98b0 },
+    { 0xf8f0c08000000000, 0x070c3860c080013f },
+    { 0xf8f0c08000000107, 0x070c3860c1830e38 },
+    { 0xf8f0c08000010307, 0x070c3963c78e1c38 },
+    { 0xf8f0c0810303070f, 0x070d3b66c48c1830 },
+    { 0xe0c0800000000000, 0x1c3870e0c080013f },
+    { 0xe0c0800000000107, 0x1c3870e0c1830e38 },
+    { 0xe0c0800000010307, 0x1c3871e3c78e1c38 },
+    { 0xe0c080010303070f, 0x1d3973e6c48c1830 },
+    { 0xc080800000000000, 0x306040c08080013f },
+    { 0xc080800000000107, 0x306040c081830e38 },
+    { 0xc080800000010307, 0x306041c3878e1c38 },
+    { 0xc08080010303070f, 0x316143c6848c1830 },
+    { 0x0000000000000000, 0xc08080808080013f },
+    { 0x0000000000000107, 0xc080808081830e38 },
+    { 0x0000000000010307, 0xc0808183878e1c38 },
+    { 0x000000010303070f, 0xc1818386848c1830 },
+    { 0xf0c0000000000000, 0x0f38e0800000013f },
+    { 0xf0c0000000000107, 0x0f38e08001030e38 },
+    { 0xf0c0000000010307, 0x0f38e183070e1c38 },
+    { 0xf0c000010303070f, 0x0f39e386040c1830 },
+    { 0xe080000000000000, 0x1c70c0800000013f },
+    { 0xe080000000000107, 0x1c70c08001030e38 },
+    { 0xe080000000010307, 0x1c70c183070e1c38 },
+    { 0xe08000010303070f, 0x1d71c386040c1830 },
+    { 0x8000000000000000, 0x70e0c0800000013f },
+    { 0x8000000000000107, 0x70e0c08001030e38 },
+    { 0x8000000000010307, 0x70e0c183070e1c38 },
+    { 0x800000010303070f, 0x71e1c386040c1830 },
+    { 0x0000000000000000, 0xc08080800000013f },
+    { 0x0000000000000107, 0xc080808001030e38 },
+    { 0x0000000000010307, 0xc0808183070e1c38 },
+    { 0x000000010303070f, 0xc1818386040c1830 },
+    { 0x0000000000000000, 0xffc000000000013f },
+    { 0x0000000000000107, 0xffc0000001030e38 },
+    { 0x0000000000010307, 0xffc00103070e1c38 },
+    { 0x000000010303070f, 0xffc10306040c1830 },
+    { 0x0000000000000000, 0xfc8000000000013f },
+    { 0x0000000000000107, 0xfc80000001030e38 },
+    { 0x0000000000010307, 0xfc800103070e1c38 },
+    { 0x000000010303070f, 0xfd810306040c1830 },
+    { 0x0000000000000000, 0xf08000000000013f },
+    { 0x0000000000000107, 0xf080000001030e38 },
+    { 0x0000000000010307, 0xf0800103070e1c38 },
+    { 0x000000010303070f, 0xf1810306040c1830 },
+    { 0x0000000000000000, 0xc08000000000013f },
+    { 0x0000000000000107, 0xc080000001030e38 },
+    { 0x0000000000010307, 0xc0800103070e1c38 },
+    { 0x000000010303070f, 0xc1810306040c1830 },
+    { 0xf8f0e0c080000000, 0x070e1c3870e0c3ff },
+    { 0xf8f0e0c08000030f, 0x070e1c3871e7dcf0 },
+    { 0xf8f0e0c081030f1f, 0x070e1d3b76fcf0e0 },
+    { 0xf8f0e0c183070f1f, 0x070f1f3e7cf8f0e0 },
+    { 0xf0e0c0c080000000, 0x0c18302060c083ff },
+    { 0xf0e0c0c08000030f, 0x0c18302061c79cf0 },
+    { 0xf0e0c0c081030f1f, 0x0c18312366dcb0e0 },
+    { 0xf0e0c0c183070f1f, 0x0d1b372e7cf8f0e0 },
+    { 0xc0c0808000000000, 0x30206040c08083ff },
+    { 0xc0c080800000030f, 0x30206040c1879cf0 },
+    { 0xc0c0808001030f1f, 0x30206143c69cb0e0 },
+    { 0xc0c0808103070f1f, 0x3123674edcb8f0e0 },
+    { 0x0000000000000000, 0xc0c08080808083ff },
+    { 0x000000000000030f, 0xc0c0808081879cf0 },
+    { 0x0000000001030f1f, 0xc0c08183869cb0e0 },
+    { 0x0000000103070f1f, 0xc1c3878e9cb8f0e0 },
+    { 0xf8f0c08000000000, 0x070c3860c08003ff },
+    { 0xf8f0c0800000030f, 0x070c3860c1871cf0 },
+    { 0xf8f0c08001030f1f, 0x070c3963c69c30e0 },
+    { 0xf8f0c08103070f1f, 0x070f3f6edcb870e0 },
+    { 0xe0c0800000000000, 0x1c3870e0c08003ff },
+    { 0xe0c080000000030f, 0x1c3870e0c1871cf0 },
+    { 0xe0c0800001030f1f, 0x1c3871e3c69c30e0 },
+    { 0xe0c0800103070f1f, 0x1d3b77eedcb870e0 },
+    { 0xc080800000000000, 0x306040c0808003ff },
+    { 0xc08080000000030f, 0x306040c081871cf0 },
+    { 0xc080800001030f1f, 0x306041c3869c30e0 },
+    { 0xc080800103070f1f, 0x316347ce9cb870e0 },
+    { 0x0000000000000000, 0xc0808080808003ff },
+    { 0x000000000000030f, 0xc080808081871cf0 },
+    { 0x0000000001030f1f, 0xc0808183869c30e0 },
+    { 0x0000000103070f1f, 0xc183878e9cb870e0 },
+    { 0xf0c0000000000000, 0x0f38e080000003ff },
+    { 0xf0c000000000030f, 0x0f38e08001071cf0 },
+    { 0xf0c0000001030f1f, 0x0f38e183061c30e0 },
+    { 0xf0c0000103070f1f, 0x0f3be78e1c3870e0 },
+    { 0xe080000000000000, 0x1c70c080000003ff },
+    { 0xe08000000000030f, 0x1c70c08001071cf0 },
+    { 0xe080000001030f1f, 0x1c70c183061c30e0 },
+    { 0xe080000103070f1f, 0x1d73c78e1c3870e0 },
+    { 0x8000000000000000, 0x70e0c080000003ff },
+    { 0x800000000000030f, 0x70e0c08001071cf0 },
+    { 0x8000000001030f1f, 0x70e0c183061c30e0 },
+    { 0x8000000103070f1f, 0x71e3c78e1c3870e0 },
+    { 0x0000000000000000, 0xc0808080000003ff },
+    { 0x000000000000030f, 0xc080808001071cf0 },
+    { 0x0000000001030f1f, 0xc0808183061c30e0 },
+    { 0x0000000103070f1f, 0xc183878e1c3870e0 },
+    { 0x0000000000000000, 0xffc00000000003ff },
+    { 0x000000000000030f, 0xffc0000001071cf0 },
+    { 0x0000000001030f1f, 0xffc00103061c30e0 },
+    { 0x0000000103070f1f, 0xffc3070e1c3870e0 },
+    { 0x0000000000000000, 0xfc800000000003ff },
+    { 0x000000000000030f, 0xfc80000001071cf0 },
+    { 0x0000000001030f1f, 0xfc800103061c30e0 },
+    { 0x0000000103070f1f, 0xfd83070e1c3870e0 },
+    { 0x0000000000000000, 0xf0800000000003ff },
+    { 0x000000000000030f, 0xf080000001071cf0 },
+    { 0x0000000001030f1f, 0xf0800103061c30e0 },
+    { 0x0000000103070f1f, 0xf183070e1c3870e0 },
+    { 0x0000000000000000, 0xc0800000000003ff },
+    { 0x000000000000030f, 0xc080000001071cf0 },
+    { 0x0000000001030f1f, 0xc0800103061c30e0 },
+    { 0x0000000103070f1f, 0xc183070e1c3870e0 },
+    { 0xffffffffffff3f00, 0x000000000000c0ff },
+    { 0xffffffffffff3f00, 0x000000000000c0ff },
+    { 0xffffffffffff3f00, 0x000000000000c0ff },
+    { 0xffffffffffff3f00, 0x000000000000c0ff },
+    { 0xffffffffffff3f00, 0x000000000000c0ff },
+    { 0xffffffffffff3f00, 0x000000000000c0ff },
+    { 0xffffffffffff3f00, 0x000000000000c0ff },
+    { 0xffffffffffff3f00, 0x000000000000c0ff },
+    { 0xffffffffffff3f00, 0x000000000000c0ff },
+    { 0xffffffffffff3f00, 0x000000000000c0ff },
+    { 0xffffffffffff3f00, 0x000000000000c0ff },
+    { 0xffffffffffff3f00, 0x000000000000c0ff },
+    { 0xffffffffffff3f00, 0x000000000000c0ff },
+    { 0xffffffffffff3f00, 0x000000000000c0ff },
+    { 0xffffffffffff3f00, 0x000000000000c0ff },
+    { 0xffffffffffff3f00, 0x000000000000c0ff },
+    { 0xffffffff7f1f0700, 0x0000000080e0380f },
+    { 0xffffffff7f1f0700, 0x0000000080e0380f },
+    { 0xffffffff7f1f0700, 0x0000000080e0380f },
+    { 0xffffffff7f1f0700, 0x0000000080e0380f },
+    { 0xffffffff7f1f0700, 0x0000000080e0380f },
+    { 0xffffffff7f1f0700, 0x0000000080e0380f },
+    { 0xffffffff7f1f0700, 0x0000000080e0380f },
+    { 0xffffffff7f1f0700, 0x0000000080e0380f },
+    { 0xffffffff7f1f0700, 0x0000000080e0380f },
+    { 0xffffffff7f1f0700, 0x0000000080e0380f },
+    { 0xffffffff7f1f0700, 0x0000000080e0380f },
+    { 0xffffffff7f1f0700, 0x0000000080e0380f },
+    { 0xffffffff7f1f0700, 0x0000000080e0380f },
+    { 0xffffffff7f1f0700, 0x0000000080e0380f },
+    { 0xffffffff7f1f0700, 0x0000000080e0380f },
+    { 0xffffffff7f1f0700, 0x0000000080e0380f },
+    { 0xffff7f3f1f070300, 0x000080c060380c07 },
+    { 0xffff7f3f1f070300, 0x000080c060380c07 },
+    { 0xffff7f3f1f070300, 0x000080c060380c07 },
+    { 0xffff7f3f1f070300, 0x000080c060380c07 },
+    { 0xffff7f3f1f070300, 0x000080c060380c07 },
+    { 0xffff7f3f1f070300, 0x000080c060380c07 },
+    { 0xffff7f3f1f070300, 0x000080c060380c07 },
+    { 0xffff7f3f1f070300, 0x000080c060380c07 },
+    { 0xffff7f3f1f070300, 0x000080c060380c07 },
+    { 0xffff7f3f1f070300, 0x000080c060380c07 },
+    { 0xffff7f3f1f070300, 0x000080c060380c07 },
+    { 0xffff7f3f1f070300, 0x000080c060380c07 },
+    { 0xffff7f3f1f070300, 0x000080c060380c07 },
+    { 0xffff7f3f1f070300, 0x000080c060380c07 },
+    { 0xffff7f3f1f070300, 0x000080c060380c07 },
+    { 0xffff7f3f1f070300, 0x000080c060380c07 },
+    { 0x7f3f1f0f07030100, 0x80c0e070381c0e07 },
+    { 0x7f3f1f0f07030100, 0x80c0e070381c0e07 },
+    { 0x7f3f1f0f07030100, 0x80c0e070381c0e07 },
+    { 0x7f3f1f0f07030100, 0x80c0e070381c0e07 },
+    { 0x7f3f1f0f07030100, 0x80c0e070381c0e07 },
+    { 0x7f3f1f0f07030100, 0x80c0e070381c0e07 },
+    { 0x7f3f1f0f07030100, 0x80c0e070381c0e07 },
+    { 0x7f3f1f0f07030100, 0x80c0e070381c0e07 },
+    { 0x7f3f1f0f07030100, 0x80c0e070381c0e07 },
+    { 0x7f3f1f0f07030100, 0x80c0e070381c0e07 },
+    { 0x7f3f1f0f07030100, 0x80c0e070381c0e07 },
+    { 0x7f3f1f0f07030100, 0x80c0e070381c0e07 },
+    { 0x7f3f1f0f07030100, 0x80c0e070381c0e07 },
+    { 0x7f3f1f0f07030100, 0x80c0e070381c0e07 },
+    { 0x7f3f1f0f07030100, 0x80c0e070381c0e07 },
+    { 0x7f3f1f0f07030100, 0x80c0e070381c0e07 },
+    { 0xffffffffffff7f03, 0x00000000000080fc },
+    { 0xffffffffffff7f03, 0x00000000000080fc },
+    { 0xffffffffffff7f03, 0x00000000000080fc },
+    { 0xffffffffffff7f03, 0x00000000000080fc },
+    { 0xffffffffffff7f03, 0x00000000000080fc },
+    { 0xffffffffffff7f03, 0x00000000000080fc },
+    { 0xffffffffffff7f03, 0x00000000000080fc },
+    { 0xffffffffffff7f03, 0x00000000000080fc },
+    { 0xffffffffffff7f03, 0x00000000000080fc },
+    { 0xffffffffffff7f03, 0x00000000000080fc },
+    { 0xffffffffffff7f03, 0x00000000000080fc },
+    { 0xffffffffffff7f03, 0x00000000000080fc },
+    { 0xffffffffffff7f03, 0x00000000000080fc },
+    { 0xffffffffffff7f03, 0x00000000000080fc },
+    { 0xffffffffffff7f03, 0x00000000000080fc },
+    { 0xffffffffffff7f03, 0x00000000000080fc },
+    { 0xffffffff7f3f0f03, 0x0000000080c0701c },
+    { 0xffffffff7f3f0f03, 0x0000000080c0701c },
+    { 0xffffffff7f3f0f03, 0x0000000080c0701c },
+    { 0xffffffff7f3f0f03, 0x0000000080c0701c },
+    { 0xffffffff7f3f0f03, 0x0000000080c0701c },
+    { 0xffffffff7f3f0f03, 0x0000000080c0701c },
+    { 0xffffffff7f3f0f03, 0x0000000080c0701c },
+    { 0xffffffff7f3f0f03, 0x0000000080c0701c },
+    { 0xffffffff7f3f0f03, 0x0000000080c0701c },
+    { 0xffffffff7f3f0f03, 0x0000000080c0701c },
+    { 0xffffffff7f3f0f03, 0x0000000080c0701c },
+    { 0xffffffff7f3f0f03, 0x0000000080c0701c },
+    { 0xffffffff7f3f0f03, 0x0000000080c0701c },
+    { 0xffffffff7f3f0f03, 0x0000000080c0701c },
+    { 0xffffffff7f3f0f03, 0x0000000080c0701c },
+    { 0xffffffff7f3f0f03, 0x0000000080c0701c },
+    { 0xffff7f3f1f0f0703, 0x000080c0e070381c },
+    { 0xffff7f3f1f0f0703, 0x000080c0e070381c },
+    { 0xffff7f3f1f0f0703, 0x000080c0e070381c },
+    { 0xffff7f3f1f0f0703, 0x000080c0e070381c },
+    { 0xffff7f3f1f0f0703, 0x000080c0e070381c },
+    { 0xffff7f3f1f0f0703, 0x000080c0e070381c },
+    { 0xffff7f3f1f0f0703, 0x000080c0e070381c },
+    { 0xffff7f3f1f0f0703, 0x000080c0e070381c },
+    { 0xffff7f3f1f0f0703, 0x000080c0e070381c },
+    { 0xffff7f3f1f0f0703, 0x000080c0e070381c },
+    { 0xffff7f3f1f0f0703, 0x000080c0e070381c },
+    { 0xffff7f3f1f0f0703, 0x000080c0e070381c },
+    { 0xffff7f3f1f0f0703, 0x000080c0e070381c },
+    { 0xffff7f3f1f0f0703, 0x000080c0e070381c },
+    { 0xffff7f3f1f0f0703, 0x000080c0e070381c },
+    { 0xffff7f3f1f0f0703, 0x000080c0e070381c },
+    { 0x7f7f3f1f1f0f0703, 0x8080c0602030180c },
+    { 0x7f7f3f1f1f0f0703, 0x8080c0602030180c },
+    { 0x7f7f3f1f1f0f0703, 0x8080c0602030180c },
+    { 0x7f7f3f1f1f0f0703, 0x8080c0602030180c },
+    { 0x7f7f3f1f1f0f0703, 0x8080c0602030180c },
+    { 0x7f7f3f1f1f0f0703, 0x8080c0602030180c },
+    { 0x7f7f3f1f1f0f0703, 0x8080c0602030180c },
+    { 0x7f7f3f1f1f0f0703, 0x8080c0602030180c },
+    { 0x7f7f3f1f1f0f0703, 0x8080c0602030180c },
+    { 0x7f7f3f1f1f0f0703, 0x8080c0602030180c },
+    { 0x7f7f3f1f1f0f0703, 0x8080c0602030180c },
+    { 0x7f7f3f1f1f0f0703, 0x8080c0602030180c },
+    { 0x7f7f3f1f1f0f0703, 0x8080c0602030180c },
+    { 0x7f7f3f1f1f0f0703, 0x8080c0602030180c },
+    { 0x7f7f3f1f1f0f0703, 0x8080c0602030180c },
+    { 0x7f7f3f1f1f0f0703, 0x8080c0602030180c },
+    { 0xffffffffffff7f0f, 0x00000000000080f0 },
+    { 0xffffffffffff7f0f, 0x00000000000080f0 },
+    { 0xffffffffffff7f0f, 0x00000000000080f0 },
+    { 0xffffffffffff7f0f, 0x00000000000080f0 },
+    { 0xffffffffffff7f0f, 0x00000000000080f0 },
+    { 0xffffffffffff7f0f, 0x00000000000080f0 },
+    { 0xffffffffffff7f0f, 0x00000000000080f0 },
+    { 0xffffffffffff7f0f, 0x00000000000080f0 },
+    { 0xffffffffffff7f0f, 0x00000000000080f0 },
+    { 0xffffffffffff7f0f, 0x00000000000080f0 },
+    { 0xffffffffffff7f0f, 0x00000000000080f0 },
+    { 0xffffffffffff7f0f, 0x00000000000080f0 },
+    { 0xffffffffffff7f0f, 0x00000000000080f0 },
+    { 0xffffffffffff7f0f, 0x00000000000080f0 },
+    { 0xffffffffffff7f0f, 0x00000000000080f0 },
+    { 0xffffffffffff7f0f, 0x00000000000080f0 },
+    { 0xffffffff7f3f1f0f, 0x0000000080c0e070 },
+    { 0xffffffff7f3f1f0f, 0x0000000080c0e070 },
+    { 0xffffffff7f3f1f0f, 0x0000000080c0e070 },
+    { 0xffffffff7f3f1f0f, 0x0000000080c0e070 },
+    { 0xffffffff7f3f1f0f, 0x0000000080c0e070 },
+    { 0xffffffff7f3f1f0f, 0x0000000080c0e070 },
+    { 0xffffffff7f3f1f0f, 0x0000000080c0e070 },
+    { 0xffffffff7f3f1f0f, 0x0000000080c0e070 },
+    { 0xffffffff7f3f1f0f, 0x0000000080c0e070 },
+    { 0xffffffff7f3f1f0f, 0x0000000080c0e070 },
+    { 0xffffffff7f3f1f0f, 0x0000000080c0e070 },
+    { 0xffffffff7f3f1f0f, 0x0000000080c0e070 },
+    { 0xffffffff7f3f1f0f, 0x0000000080c0e070 },
+    { 0xffffffff7f3f1f0f, 0x0000000080c0e070 },
+    { 0xffffffff7f3f1f0f, 0x0000000080c0e070 },
+    { 0xffffffff7f3f1f0f, 0x0000000080c0e070 },
+    { 0xffff7f7f3f3f1f0f, 0x00008080c0406030 },
+    { 0xffff7f7f3f3f1f0f, 0x00008080c0406030 },
+    { 0xffff7f7f3f3f1f0f, 0x00008080c0406030 },
+    { 0xffff7f7f3f3f1f0f, 0x00008080c0406030 },
+    { 0xffff7f7f3f3f1f0f, 0x00008080c0406030 },
+    { 0xffff7f7f3f3f1f0f, 0x00008080c0406030 },
+    { 0xffff7f7f3f3f1f0f, 0x00008080c0406030 },
+    { 0xffff7f7f3f3f1f0f, 0x00008080c0406030 },
+    { 0xffff7f7f3f3f1f0f, 0x00008080c0406030 },
+    { 0xffff7f7f3f3f1f0f, 0x00008080c0406030 },
+    { 0xffff7f7f3f3f1f0f, 0x00008080c0406030 },
+    { 0xffff7f7f3f3f1f0f, 0x00008080c0406030 },
+    { 0xffff7f7f3f3f1f0f, 0x00008080c0406030 },
+    { 0xffff7f7f3f3f1f0f, 0x00008080c0406030 },
+    { 0xffff7f7f3f3f1f0f, 0x00008080c0406030 },
+    { 0xffff7f7f3f3f1f0f, 0x00008080c0406030 },
+    { 0x7f7f7f3f3f1f1f0f, 0x808080c040602030 },
+    { 0x7f7f7f3f3f1f1f0f, 0x808080c040602030 },
+    { 0x7f7f7f3f3f1f1f0f, 0x808080c040602030 },
+    { 0x7f7f7f3f3f1f1f0f, 0x808080c040602030 },
+    { 0x7f7f7f3f3f1f1f0f, 0x808080c040602030 },
+    { 0x7f7f7f3f3f1f1f0f, 0x808080c040602030 },
+    { 0x7f7f7f3f3f1f1f0f, 0x808080c040602030 },
+    { 0x7f7f7f3f3f1f1f0f, 0x808080c040602030 },
+    { 0x7f7f7f3f3f1f1f0f, 0x808080c040602030 },
+    { 0x7f7f7f3f3f1f1f0f, 0x808080c040602030 },
+    { 0x7f7f7f3f3f1f1f0f, 0x808080c040602030 },
+    { 0x7f7f7f3f3f1f1f0f, 0x808080c040602030 },
+    { 0x7f7f7f3f3f1f1f0f, 0x808080c040602030 },
+    { 0x7f7f7f3f3f1f1f0f, 0x808080c040602030 },
+    { 0x7f7f7f3f3f1f1f0f, 0x808080c040602030 },
+    { 0x7f7f7f3f3f1f1f0f, 0x808080c040602030 },
+    { 0xffffffffffff7f3f, 0x00000000000080c0 },
+    { 0xffffffffffff7f3f, 0x00000000000080c0 },
+    { 0xffffffffffff7f3f, 0x00000000000080c0 },
+    { 0xffffffffffff7f3f, 0x00000000000080c0 },
+    { 0xffffffffffff7f3f, 0x00000000000080c0 },
+    { 0xffffffffffff7f3f, 0x00000000000080c0 },
+    { 0xffffffffffff7f3f, 0x00000000000080c0 },
+    { 0xffffffffffff7f3f, 0x00000000000080c0 },
+    { 0xffffffffffff7f3f, 0x00000000000080c0 },
+    { 0xffffffffffff7f3f, 0x00000000000080c0 },
+    { 0xffffffffffff7f3f, 0x00000000000080c0 },
+    { 0xffffffffffff7f3f, 0x00000000000080c0 },
+    { 0xffffffffffff7f3f, 0x00000000000080c0 },
+    { 0xffffffffffff7f3f, 0x00000000000080c0 },
+    { 0xffffffffffff7f3f, 0x00000000000080c0 },
+    { 0xffffffffffff7f3f, 0x00000000000080c0 },
+    { 0xffffffff7f7f7f3f, 0x00000000808080c0 },
+    { 0xffffffff7f7f7f3f, 0x00000000808080c0 },
+    { 0xffffffff7f7f7f3f, 0x00000000808080c0 },
+    { 0xffffffff7f7f7f3f, 0x00000000808080c0 },
+    { 0xffffffff7f7f7f3f, 0x00000000808080c0 },
+    { 0xffffffff7f7f7f3f, 0x00000000808080c0 },
+    { 0xffffffff7f7f7f3f, 0x00000000808080c0 },
+    { 0xffffffff7f7f7f3f, 0x00000000808080c0 },
+    { 0xffffffff7f7f7f3f, 0x00000000808080c0 },
+    { 0xffffffff7f7f7f3f, 0x00000000808080c0 },
+    { 0xffffffff7f7f7f3f, 0x00000000808080c0 },
+    { 0xffffffff7f7f7f3f, 0x00000000808080c0 },
+    { 0xffffffff7f7f7f3f, 0x00000000808080c0 },
+    { 0xffffffff7f7f7f3f, 0x00000000808080c0 },
+    { 0xffffffff7f7f7f3f, 0x00000000808080c0 },
+    { 0xffffffff7f7f7f3f, 0x00000000808080c0 },
+    { 0xffff7f7f7f7f7f3f, 0x00008080808080c0 },
+    { 0xffff7f7f7f7f7f3f, 0x00008080808080c0 },
+    { 0xffff7f7f7f7f7f3f, 0x00008080808080c0 },
+    { 0xffff7f7f7f7f7f3f, 0x00008080808080c0 },
+    { 0xffff7f7f7f7f7f3f, 0x00008080808080c0 },
+    { 0xffff7f7f7f7f7f3f, 0x00008080808080c0 },
+    { 0xffff7f7f7f7f7f3f, 0x00008080808080c0 },
+    { 0xffff7f7f7f7f7f3f, 0x00008080808080c0 },
+    { 0xffff7f7f7f7f7f3f, 0x00008080808080c0 },
+    { 0xffff7f7f7f7f7f3f, 0x00008080808080c0 },
+    { 0xffff7f7f7f7f7f3f, 0x00008080808080c0 },
+    { 0xffff7f7f7f7f7f3f, 0x00008080808080c0 },
+    { 0xffff7f7f7f7f7f3f, 0x00008080808080c0 },
+    { 0xffff7f7f7f7f7f3f, 0x00008080808080c0 },
+    { 0xffff7f7f7f7f7f3f, 0x00008080808080c0 },
+    { 0xffff7f7f7f7f7f3f, 0x00008080808080c0 },
+    { 0x7f7f7f7f7f7f3f3f, 0x808080808080c0c0 },
+    { 0x7f7f7f7f7f7f3f3f, 0x808080808080c0c0 },
+    { 0x7f7f7f7f7f7f3f3f, 0x808080808080c0c0 },
+    { 0x7f7f7f7f7f7f3f3f, 0x808080808080c0c0 },
+    { 0x7f7f7f7f7f7f3f3f, 0x808080808080c0c0 },
+    { 0x7f7f7f7f7f7f3f3f, 0x808080808080c0c0 },
+    { 0x7f7f7f7f7f7f3f3f, 0x808080808080c0c0 },
+    { 0x7f7f7f7f7f7f3f3f, 0x808080808080c0c0 },
+    { 0x7f7f7f7f7f7f3f3f, 0x808080808080c0c0 },
+    { 0x7f7f7f7f7f7f3f3f, 0x808080808080c0c0 },
+    { 0x7f7f7f7f7f7f3f3f, 0x808080808080c0c0 },
+    { 0x7f7f7f7f7f7f3f3f, 0x808080808080c0c0 },
+    { 0x7f7f7f7f7f7f3f3f, 0x808080808080c0c0 },
+    { 0x7f7f7f7f7f7f3f3f, 0x808080808080c0c0 },
+    { 0x7f7f7f7f7f7f3f3f, 0x808080808080c0c0 },
+    { 0x7f7f7f7f7f7f3f3f, 0x808080808080c0c0 },
+    { 0x0000000000000000, 0x000000000000ffff },
+    { 0x000000000000077f, 0x00000000011ff880 },
+    { 0x0000000001071f7f, 0x000001071e78e080 },
+    { 0x00000103071f3f7f, 0x0103061c3860c080 },
+    { 0x0000000000000000, 0x000000000000ffff },
+    { 0x000000000000077f, 0x00000000011ff880 },
+    { 0x0000000001071f7f, 0x000001071e78e080 },
+    { 0x00000103071f3f7f, 0x0103061c3860c080 },
+    { 0x0000000000000000, 0x000000000000ffff },
+    { 0x000000000000077f, 0x00000000011ff880 },
+    { 0x0000000001071f7f, 0x000001071e78e080 },
+    { 0x00000103071f3f7f, 0x0103061c3860c080 },
+    { 0x0000000000000000, 0x000000000000ffff },
+    { 0x000000000000077f, 0x00000000011ff880 },
+    { 0x0000000001071f7f, 0x000001071e78e080 },
+    { 0x00000103071f3f7f, 0x0103061c3860c080 },
+    { 0x000000000000e0fe, 0x0000000080f81f01 },
+    { 0x000000000000ffff, 0x00000000ffff0000 },
+    { 0x00000000077fffff, 0x0000011ff8800000 },
+    { 0x000001071f7fffff, 0x01071e78e0800000 },
+    { 0x000000000000e0fe, 0x0000000080f81f01 },
+    { 0x000000000000ffff, 0x00000000ffff0000 },
+    { 0x00000000077fffff, 0x0000011ff8800000 },
+    { 0x000001071f7fffff, 0x01071e78e0800000 },
+    { 0x000000000000e0fe, 0x0000000080f81f01 },
+    { 0x000000000000ffff, 0x00000000ffff0000 },
+    { 0x00000000077fffff, 0x0000011ff8800000 },
+    { 0x000001071f7fffff, 0x01071e78e0800000 },
+    { 0x000000000000e0fe, 0x0000000080f81f01 },
+    { 0x000000000000ffff, 0x00000000ffff0000 },
+    { 0x00000000077fffff, 0x0000011ff8800000 },
+    { 0x000001071f7fffff, 0x01071e78e0800000 },
+    { 0x0000000080e0f8fe, 0x000080e0781e0701 },
+    { 0x00000000e0feffff, 0x000080f81f010000 },
+    { 0x00000000ffffffff, 0x0000ffff00000000 },
+    { 0x0000077fffffffff, 0x011ff88000000000 },
+    { 0x0000000080e0f8fe, 0x000080e0781e0701 },
+    { 0x00000000e0feffff, 0x000080f81f010000 },
+    { 0x00000000ffffffff, 0x0000ffff00000000 },
+    { 0x0000077fffffffff, 0x011ff88000000000 },
+    { 0x0000000080e0f8fe, 0x000080e0781e0701 },
+    { 0x00000000e0feffff, 0x000080f81f010000 },
+    { 0x00000000ffffffff, 0x0000ffff00000000 },
+    { 0x0000077fffffffff, 0x011ff88000000000 },
+    { 0x0000000080e0f8fe, 0x000080e0781e0701 },
+    { 0x00000000e0feffff, 0x000080f81f010000 },
+    { 0x00000000ffffffff, 0x0000ffff00000000 },
+    { 0x0000077fffffffff, 0x011ff88000000000 },
+    { 0x000080c0e0f8fcfe, 0x80c060381c060301 },
+    { 0x000080e0f8feffff, 0x80e0781e07010000 },
+    { 0x0000e0feffffffff, 0x80f81f0100000000 },
+    { 0x0000ffffffffffff, 0xffff000000000000 },
+    { 0x000080c0e0f8fcfe, 0x80c060381c060301 },
+    { 0x000080e0f8feffff, 0x80e0781e07010000 },
+    { 0x0000e0feffffffff, 0x80f81f0100000000 },
+    { 0x0000ffffffffffff, 0xffff000000000000 },
+    { 0x000080c0e0f8fcfe, 0x80c060381c060301 },
+    { 0x000080e0f8feffff, 0x80e0781e07010000 },
+    { 0x0000e0feffffffff, 0x80f81f0100000000 },
+    { 0x0000ffffffffffff, 0xffff000000000000 },
+    { 0x000080c0e0f8fcfe, 0x80c060381c060301 },
+    { 0x000080e0f8feffff, 0x80e0781e07010000 },
+    { 0x0000e0feffffffff, 0x80f81f0100000000 },
+    { 0x0000ffffffffffff, 0xffff000000000000 },
+    { 0x0000000000000000, 0x000000000000ffff },
+    { 0x000000000000077f, 0x00000000011ff880 },
+    { 0x0000000001071f7f, 0x000001071e78e080 },
+    { 0x00000103071f3f7f, 0x0103061c3860c080 },
+    { 0x0000000000000000, 0x000000000000ffff },
+    { 0x000000000000077f, 0x00000000011ff880 },
+    { 0x0000000001071f7f, 0x000001071e78e080 },
+    { 0x00000103071f3f7f, 0x0103061c3860c080 },
+    { 0x0000000000000000, 0x000000000000ffff },
+    { 0x000000000000077f, 0x00000000011ff880 },
+    { 0x0000000001071f7f, 0x000001071e78e080 },
+    { 0x00000103071f3f7f, 0x0103061c3860c080 },
+    { 0x0000000000000000, 0x000000000000ffff },
+    { 0x000000000000077f, 0x00000000011ff880 },
+    { 0x0000000001071f7f, 0x000001071e78e080 },
+    { 0x00000103071f3f7f, 0x0103061c3860c080 },
+    { 0x000000000000e0fe, 0x0000000080f81f01 },
+    { 0x000000000000ffff, 0x00000000ffff0000 },
+    { 0x00000000077fffff, 0x0000011ff8800000 },
+    { 0x000001071f7fffff, 0x01071e78e0800000 },
+    { 0x000000000000e0fe, 0x0000000080f81f01 },
+    { 0x000000000000ffff, 0x00000000ffff0000 },
+    { 0x00000000077fffff, 0x0000011ff8800000 },
+    { 0x000001071f7fffff, 0x01071e78e0800000 },
+    { 0x000000000000e0fe, 0x0000000080f81f01 },
+    { 0x000000000000ffff, 0x00000000ffff0000 },
+    { 0x00000000077fffff, 0x0000011ff8800000 },
+    { 0x000001071f7fffff, 0x01071e78e0800000 },
+    { 0x000000000000e0fe, 0x0000000080f81f01 },
+    { 0x000000000000ffff, 0x00000000ffff0000 },
+    { 0x00000000077fffff, 0x0000011ff8800000 },
+    { 0x000001071f7fffff, 0x01071e78e0800000 },
+    { 0x0000000080e0f8fe, 0x000080e0781e0701 },
+    { 0x00000000e0feffff, 0x000080f81f010000 },
+    { 0x00000000ffffffff, 0x0000ffff00000000 },
+    { 0x0000077fffffffff, 0x011ff88000000000 },
+    { 0x0000000080e0f8fe, 0x000080e0781e0701 },
+    { 0x00000000e0feffff, 0x000080f81f010000 },
+    { 0x00000000ffffffff, 0x0000ffff00000000 },
+    { 0x0000077fffffffff, 0x011ff88000000000 },
+    { 0x0000000080e0f8fe, 0x000080e0781e0701 },
+    { 0x00000000e0feffff, 0x000080f81f010000 },
+    { 0x00000000ffffffff, 0x0000ffff00000000 },
+    { 0x0000077fffffffff, 0x011ff88000000000 },
+    { 0x0000000080e0f8fe, 0x000080e0781e0701 },
+    { 0x00000000e0feffff, 0x000080f81f010000 },
+    { 0x00000000ffffffff, 0x0000ffff00000000 },
+    { 0x0000077fffffffff, 0x011ff88000000000 },
+    { 0x000080c0e0f8fcfe, 0x80c060381c060301 },
+    { 0x000080e0f8feffff, 0x80e0781e07010000 },
+    { 0x0000e0feffffffff, 0x80f81f0100000000 },
+    { 0x0000ffffffffffff, 0xffff000000000000 },
+    { 0x000080c0e0f8fcfe, 0x80c060381c060301 },
+    { 0x000080e0f8feffff, 0x80e0781e07010000 },
+    { 0x0000e0feffffffff, 0x80f81f0100000000 },
+    { 0x0000ffffffffffff, 0xffff000000000000 },
+    { 0x000080c0e0f8fcfe, 0x80c060381c060301 },
+    { 0x000080e0f8feffff, 0x80e0781e07010000 },
+    { 0x0000e0feffffffff, 0x80f81f0100000000 },
+    { 0x0000ffffffffffff, 0xffff000000000000 },
+    { 0x000080c0e0f8fcfe, 0x80c060381c060301 },
+    { 0x000080e0f8feffff, 0x80e0781e07010000 },
+    { 0x0000e0feffffffff, 0x80f81f0100000000 },
+    { 0x0000ffffffffffff, 0xffff000000000000 },
+    { 0x0000000000000000, 0x000000000000ffff },
+    { 0x000000000000077f, 0x00000000011ff880 },
+    { 0x0000000001071f7f, 0x000001071e78e080 },
+    { 0x00000103071f3f7f, 0x0103061c3860c080 },
+    { 0x0000000000000000, 0x000000000000ffff },
+    { 0x000000000000077f, 0x00000000011ff880 },
+    { 0x0000000001071f7f, 0x000001071e78e080 },
+    { 0x00000103071f3f7f, 0x0103061c3860c080 },
+    { 0x0000000000000000, 0x000000000000ffff },
+    { 0x000000000000077f, 0x00000000011ff880 },
+    { 0x0000000001071f7f, 0x000001071e78e080 },
+    { 0x00000103071f3f7f, 0x0103061c3860c080 },
+    { 0x0000000000000000, 0x000000000000ffff },
+    { 0x000000000000077f, 0x00000000011ff880 },
+    { 0x0000000001071f7f, 0x000001071e78e080 },
+    { 0x00000103071f3f7f, 0x0103061c3860c080 },
+    { 0x000000000000e0fe, 0x0000000080f81f01 },
+    { 0x000000000000ffff, 0x00000000ffff0000 },
+    { 0x00000000077fffff, 0x0000011ff8800000 },
+    { 0x000001071f7fffff, 0x01071e78e0800000 },
+    { 0x000000000000e0fe, 0x0000000080f81f01 },
+    { 0x000000000000ffff, 0x00000000ffff0000 },
+    { 0x00000000077fffff, 0x0000011ff8800000 },
+    { 0x000001071f7fffff, 0x01071e78e0800000 },
+    { 0x000000000000e0fe, 0x0000000080f81f01 },
+    { 0x000000000000ffff, 0x00000000ffff0000 },
+    { 0x00000000077fffff, 0x0000011ff8800000 },
+    { 0x000001071f7fffff, 0x01071e78e0800000 },
+    { 0x000000000000e0fe, 0x0000000080f81f01 },
+    { 0x000000000000ffff, 0x00000000ffff0000 },
+    { 0x00000000077fffff, 0x0000011ff8800000 },
+    { 0x000001071f7fffff, 0x01071e78e0800000 },
+    { 0x0000000080e0f8fe, 0x000080e0781e0701 },
+    { 0x00000000e0feffff, 0x000080f81f010000 },
+    { 0x00000000ffffffff, 0x0000ffff00000000 },
+    { 0x0000077fffffffff, 0x011ff88000000000 },
+    { 0x0000000080e0f8fe, 0x000080e0781e0701 },
+    { 0x00000000e0feffff, 0x000080f81f010000 },
+    { 0x00000000ffffffff, 0x0000ffff00000000 },
+    { 0x0000077fffffffff, 0x011ff88000000000 },
+    { 0x0000000080e0f8fe, 0x000080e0781e0701 },
+    { 0x00000000e0feffff, 0x000080f81f010000 },
+    { 0x00000000ffffffff, 0x0000ffff00000000 },
+    { 0x0000077fffffffff, 0x011ff88000000000 },
+    { 0x0000000080e0f8fe, 0x000080e0781e0701 },
+    { 0x00000000e0feffff, 0x000080f81f010000 },
+    { 0x00000000ffffffff, 0x0000ffff00000000 },
+    { 0x0000077fffffffff, 0x011ff88000000000 },
+    { 0x000080c0e0f8fcfe, 0x80c060381c060301 },
+    { 0x000080e0f8feffff, 0x80e0781e07010000 },
+    { 0x0000e0feffffffff, 0x80f81f0100000000 },
+    { 0x0000ffffffffffff, 0xffff000000000000 },
+    { 0x000080c0e0f8fcfe, 0x80c060381c060301 },
+    { 0x000080e0f8feffff, 0x80e0781e07010000 },
+    { 0x0000e0feffffffff, 0x80f81f0100000000 },
+    { 0x0000ffffffffffff, 0xffff000000000000 },
+    { 0x000080c0e0f8fcfe, 0x80c060381c060301 },
+    { 0x000080e0f8feffff, 0x80e0781e07010000 },
+    { 0x0000e0feffffffff, 0x80f81f0100000000 },
+    { 0x0000ffffffffffff, 0xffff000000000000 },
+    { 0x000080c0e0f8fcfe, 0x80c060381c060301 },
+    { 0x000080e0f8feffff, 0x80e0781e07010000 },
+    { 0x0000e0feffffffff, 0x80f81f0100000000 },
+    { 0x0000ffffffffffff, 0xffff000000000000 },
+    { 0x0000000000000000, 0x000000000000ffff },
+    { 0x000000000000077f, 0x00000000011ff880 },
+    { 0x0000000001071f7f, 0x000001071e78e080 },
+    { 0x00000103071f3f7f, 0x0103061c3860c080 },
+    { 0x0000000000000000, 0x000000000000ffff },
+    { 0x000000000000077f, 0x00000000011ff880 },
+    { 0x0000000001071f7f, 0x000001071e78e080 },
+    { 0x00000103071f3f7f, 0x0103061c3860c080 },
+    { 0x0000000000000000, 0x000000000000ffff },
+    { 0x000000000000077f, 0x00000000011ff880 },
+    { 0x0000000001071f7f, 0x000001071e78e080 },
+    { 0x00000103071f3f7f, 0x0103061c3860c080 },
+    { 0x0000000000000000, 0x000000000000ffff },
+    { 0x000000000000077f, 0x00000000011ff880 },
+    { 0x0000000001071f7f, 0x000001071e78e080 },
+    { 0x00000103071f3f7f, 0x0103061c3860c080 },
+    { 0x000000000000e0fe, 0x0000000080f81f01 },
+    { 0x000000000000ffff, 0x00000000ffff0000 },
+    { 0x00000000077fffff, 0x0000011ff8800000 },
+    { 0x000001071f7fffff, 0x01071e78e0800000 },
+    { 0x000000000000e0fe, 0x0000000080f81f01 },
+    { 0x000000000000ffff, 0x00000000ffff0000 },
+    { 0x00000000077fffff, 0x0000011ff8800000 },
+    { 0x000001071f7fffff, 0x01071e78e0800000 },
+    { 0x000000000000e0fe, 0x0000000080f81f01 },
+    { 0x000000000000ffff, 0x00000000ffff0000 },
+    { 0x00000000077fffff, 0x0000011ff8800000 },
+    { 0x000001071f7fffff, 0x01071e78e0800000 },
+    { 0x000000000000e0fe, 0x0000000080f81f01 },
+    { 0x000000000000ffff, 0x00000000ffff0000 },
+    { 0x00000000077fffff, 0x0000011ff8800000 },
+    { 0x000001071f7fffff, 0x01071e78e0800000 },
+    { 0x0000000080e0f8fe, 0x000080e0781e0701 },
+    { 0x00000000e0feffff, 0x000080f81f010000 },
+    { 0x00000000ffffffff, 0x0000ffff00000000 },
+    { 0x0000077fffffffff, 0x011ff88000000000 },
+    { 0x0000000080e0f8fe, 0x000080e0781e0701 },
+    { 0x00000000e0feffff, 0x000080f81f010000 },
+    { 0x00000000ffffffff, 0x0000ffff00000000 },
+    { 0x0000077fffffffff, 0x011ff88000000000 },
+    { 0x0000000080e0f8fe, 0x000080e0781e0701 },
+    { 0x00000000e0feffff, 0x000080f81f010000 },
+    { 0x00000000ffffffff, 0x0000ffff00000000 },
+    { 0x0000077fffffffff, 0x011ff88000000000 },
+    { 0x0000000080e0f8fe, 0x000080e0781e0701 },
+    { 0x00000000e0feffff, 0x000080f81f010000 },
+    { 0x00000000ffffffff, 0x0000ffff00000000 },
+    { 0x0000077fffffffff, 0x011ff88000000000 },
+    { 0x000080c0e0f8fcfe, 0x80c060381c060301 },
+    { 0x000080e0f8feffff, 0x80e0781e07010000 },
+    { 0x0000e0feffffffff, 0x80f81f0100000000 },
+    { 0x0000ffffffffffff, 0xffff000000000000 },
+    { 0x000080c0e0f8fcfe, 0x80c060381c060301 },
+    { 0x000080e0f8feffff, 0x80e0781e07010000 },
+    { 0x0000e0feffffffff, 0x80f81f0100000000 },
+    { 0x0000ffffffffffff, 0xffff000000000000 },
+    { 0x000080c0e0f8fcfe, 0x80c060381c060301 },
+    { 0x000080e0f8feffff, 0x80e0781e07010000 },
+    { 0x0000e0feffffffff, 0x80f81f0100000000 },
+    { 0x0000ffffffffffff, 0xffff000000000000 },
+    { 0x000080c0e0f8fcfe, 0x80c060381c060301 },
+    { 0x000080e0f8feffff, 0x80e0781e07010000 },
+    { 0x0000e0feffffffff, 0x80f81f0100000000 },
+    { 0x0000ffffffffffff, 0xffff000000000000 },
+    { 0x000103070f1f3f7f, 0x070e1c3870e0c080 },
+    { 0x000103070f1f3f7f, 0x070e1c3870e0c080 },
+    { 0x000103070f1f3f7f, 0x070e1c3870e0c080 },
+    { 0x000103070f1f3f7f, 0x070e1c3870e0c080 },
+    { 0x03070f1f1f3f7f7f, 0x0c18302060c08080 },
+    { 0x03070f1f1f3f7f7f, 0x0c18302060c08080 },
+    { 0x03070f1f1f3f7f7f, 0x0c18302060c08080 },
+    { 0x03070f1f1f3f7f7f, 0x0c18302060c08080 },
+    { 0x0f1f1f3f3f7f7f7f, 0x30206040c0808080 },
+    { 0x0f1f1f3f3f7f7f7f, 0x30206040c0808080 },
+    { 0x0f1f1f3f3f7f7f7f, 0x30206040c0808080 },
+    { 0x0f1f1f3f3f7f7f7f, 0x30206040c0808080 },
+    { 0x3f3f7f7f7f7f7f7f, 0xc0c0808080808080 },
+    { 0x3f3f7f7f7f7f7f7f, 0xc0c0808080808080 },
+    { 0x3f3f7f7f7f7f7f7f, 0xc0c0808080808080 },
+    { 0x3f3f7f7f7f7f7f7f, 0xc0c0808080808080 },
+    { 0x0003071f3f7fffff, 0x070c3860c0800000 },
+    { 0x0003071f3f7fffff, 0x070c3860c0800000 },
+    { 0x0003071f3f7fffff, 0x070c3860c0800000 },
+    { 0x0003071f3f7fffff, 0x070c3860c0800000 },
+    { 0x03070f1f3f7fffff, 0x1c3870e0c0800000 },
+    { 0x03070f1f3f7fffff, 0x1c3870e0c0800000 },
+    { 0x03070f1f3f7fffff, 0x1c3870e0c0800000 },
+    { 0x03070f1f3f7fffff, 0x1c3870e0c0800000 },
+    { 0x0f1f3f3f7f7fffff, 0x306040c080800000 },
+    { 0x0f1f3f3f7f7fffff, 0x306040c080800000 },
+    { 0x0f1f3f3f7f7fffff, 0x306040c080800000 },
+    { 0x0f1f3f3f7f7fffff, 0x306040c080800000 },
+    { 0x3f7f7f7f7f7fffff, 0xc080808080800000 },
+    { 0x3f7f7f7f7f7fffff, 0xc080808080800000 },
+    { 0x3f7f7f7f7f7fffff, 0xc080808080800000 },
+    { 0x3f7f7f7f7f7fffff, 0xc080808080800000 },
+    { 0x00071f7fffffffff, 0x0f38e08000000000 },
+    { 0x00071f7fffffffff, 0x0f38e08000000000 },
+    { 0x00071f7fffffffff, 0x0f38e08000000000 },
+    { 0x00071f7fffffffff, 0x0f38e08000000000 },
+    { 0x030f3f7fffffffff, 0x1c70c08000000000 },
+    { 0x030f3f7fffffffff, 0x1c70c08000000000 },
+    { 0x030f3f7fffffffff, 0x1c70c08000000000 },
+    { 0x030f3f7fffffffff, 0x1c70c08000000000 },
+    { 0x0f1f3f7fffffffff, 0x70e0c08000000000 },
+    { 0x0f1f3f7fffffffff, 0x70e0c08000000000 },
+    { 0x0f1f3f7fffffffff, 0x70e0c08000000000 },
+    { 0x0f1f3f7fffffffff, 0x70e0c08000000000 },
+    { 0x3f7f7f7fffffffff, 0xc080808000000000 },
+    { 0x3f7f7f7fffffffff, 0xc080808000000000 },
+    { 0x3f7f7f7fffffffff, 0xc080808000000000 },
+    { 0x3f7f7f7fffffffff, 0xc080808000000000 },
+    { 0x003fffffffffffff, 0xffc0000000000000 },
+    { 0x003fffffffffffff, 0xffc0000000000000 },
+    { 0x003fffffffffffff, 0xffc0000000000000 },
+    { 0x003fffffffffffff, 0xffc0000000000000 },
+    { 0x037fffffffffffff, 0xfc80000000000000 },
+    { 0x037fffffffffffff, 0xfc80000000000000 },
+    { 0x037fffffffffffff, 0xfc80000000000000 },
+    { 0x037fffffffffffff, 0xfc80000000000000 },
+    { 0x0f7fffffffffffff, 0xf080000000000000 },
+    { 0x0f7fffffffffffff, 0xf080000000000000 },
+    { 0x0f7fffffffffffff, 0xf080000000000000 },
+    { 0x0f7fffffffffffff, 0xf080000000000000 },
+    { 0x3f7fffffffffffff, 0xc080000000000000 },
+    { 0x3f7fffffffffffff, 0xc080000000000000 },
+    { 0x3f7fffffffffffff, 0xc080000000000000 },
+    { 0x3f7fffffffffffff, 0xc080000000000000 },
+    { 0x000103070f1f3f7f, 0x070e1c3870e0c080 },
+    { 0x000103070f1f3f7f, 0x070e1c3870e0c080 },
+    { 0x000103070f1f3f7f, 0x070e1c3870e0c080 },
+    { 0x000103070f1f3f7f, 0x070e1c3870e0c080 },
+    { 0x03070f1f1f3f7f7f, 0x0c18302060c08080 },
+    { 0x03070f1f1f3f7f7f, 0x0c18302060c08080 },
+    { 0x03070f1f1f3f7f7f, 0x0c18302060c08080 },
+    { 0x03070f1f1f3f7f7f, 0x0c18302060c08080 },
+    { 0x0f1f1f3f3f7f7f7f, 0x30206040c0808080 },
+    { 0x0f1f1f3f3f7f7f7f, 0x30206040c0808080 },
+    { 0x0f1f1f3f3f7f7f7f, 0x30206040c0808080 },
+    { 0x0f1f1f3f3f7f7f7f, 0x30206040c0808080 },
+    { 0x3f3f7f7f7f7f7f7f, 0xc0c0808080808080 },
+    { 0x3f3f7f7f7f7f7f7f, 0xc0c0808080808080 },
+    { 0x3f3f7f7f7f7f7f7f, 0xc0c0808080808080 },
+    { 0x3f3f7f7f7f7f7f7f, 0xc0c0808080808080 },
+    { 0x0003071f3f7fffff, 0x070c3860c0800000 },
+    { 0x0003071f3f7fffff, 0x070c3860c0800000 },
+    { 0x0003071f3f7fffff, 0x070c3860c0800000 },
+    { 0x0003071f3f7fffff, 0x070c3860c0800000 },
+    { 0x03070f1f3f7fffff, 0x1c3870e0c0800000 },
+    { 0x03070f1f3f7fffff, 0x1c3870e0c0800000 },
+    { 0x03070f1f3f7fffff, 0x1c3870e0c0800000 },
+    { 0x03070f1f3f7fffff, 0x1c3870e0c0800000 },
+    { 0x0f1f3f3f7f7fffff, 0x306040c080800000 },
+    { 0x0f1f3f3f7f7fffff, 0x306040c080800000 },
+    { 0x0f1f3f3f7f7fffff, 0x306040c080800000 },
+    { 0x0f1f3f3f7f7fffff, 0x306040c080800000 },
+    { 0x3f7f7f7f7f7fffff, 0xc080808080800000 },
+    { 0x3f7f7f7f7f7fffff, 0xc080808080800000 },
+    { 0x3f7f7f7f7f7fffff, 0xc080808080800000 },
+    { 0x3f7f7f7f7f7fffff, 0xc080808080800000 },
+    { 0x00071f7fffffffff, 0x0f38e08000000000 },
+    { 0x00071f7fffffffff, 0x0f38e08000000000 },
+    { 0x00071f7fffffffff, 0x0f38e08000000000 },
+    { 0x00071f7fffffffff, 0x0f38e08000000000 },
+    { 0x030f3f7fffffffff, 0x1c70c08000000000 },
+    { 0x030f3f7fffffffff, 0x1c70c08000000000 },
+    { 0x030f3f7fffffffff, 0x1c70c08000000000 },
+    { 0x030f3f7fffffffff, 0x1c70c08000000000 },
+    { 0x0f1f3f7fffffffff, 0x70e0c08000000000 },
+    { 0x0f1f3f7fffffffff, 0x70e0c08000000000 },
+    { 0x0f1f3f7fffffffff, 0x70e0c08000000000 },
+    { 0x0f1f3f7fffffffff, 0x70e0c08000000000 },
+    { 0x3f7f7f7fffffffff, 0xc080808000000000 },
+    { 0x3f7f7f7fffffffff, 0xc080808000000000 },
+    { 0x3f7f7f7fffffffff, 0xc080808000000000 },
+    { 0x3f7f7f7fffffffff, 0xc080808000000000 },
+    { 0x003fffffffffffff, 0xffc0000000000000 },
+    { 0x003fffffffffffff, 0xffc0000000000000 },
+    { 0x003fffffffffffff, 0xffc0000000000000 },
+    { 0x003fffffffffffff, 0xffc0000000000000 },
+    { 0x037fffffffffffff, 0xfc80000000000000 },
+    { 0x037fffffffffffff, 0xfc80000000000000 },
+    { 0x037fffffffffffff, 0xfc80000000000000 },
+    { 0x037fffffffffffff, 0xfc80000000000000 },
+    { 0x0f7fffffffffffff, 0xf080000000000000 },
+    { 0x0f7fffffffffffff, 0xf080000000000000 },
+    { 0x0f7fffffffffffff, 0xf080000000000000 },
+    { 0x0f7fffffffffffff, 0xf080000000000000 },
+    { 0x3f7fffffffffffff, 0xc080000000000000 },
+    { 0x3f7fffffffffffff, 0xc080000000000000 },
+    { 0x3f7fffffffffffff, 0xc080000000000000 },
+    { 0x3f7fffffffffffff, 0xc080000000000000 },
+    { 0x000103070f1f3f7f, 0x070e1c3870e0c080 },
+    { 0x000103070f1f3f7f, 0x070e1c3870e0c080 },
+    { 0x000103070f1f3f7f, 0x070e1c3870e0c080 },
+    { 0x000103070f1f3f7f, 0x070e1c3870e0c080 },
+    { 0x03070f1f1f3f7f7f, 0x0c18302060c08080 },
+    { 0x03070f1f1f3f7f7f, 0x0c18302060c08080 },
+    { 0x03070f1f1f3f7f7f, 0x0c18302060c08080 },
+    { 0x03070f1f1f3f7f7f, 0x0c18302060c08080 },
+    { 0x0f1f1f3f3f7f7f7f, 0x30206040c0808080 },
+    { 0x0f1f1f3f3f7f7f7f, 0x30206040c0808080 },
+    { 0x0f1f1f3f3f7f7f7f, 0x30206040c0808080 },
+    { 0x0f1f1f3f3f7f7f7f, 0x30206040c0808080 },
+    { 0x3f3f7f7f7f7f7f7f, 0xc0c0808080808080 },
+    { 0x3f3f7f7f7f7f7f7f, 0xc0c0808080808080 },
+    { 0x3f3f7f7f7f7f7f7f, 0xc0c0808080808080 },
+    { 0x3f3f7f7f7f7f7f7f, 0xc0c0808080808080 },
+    { 0x0003071f3f7fffff, 0x070c3860c0800000 },
+    { 0x0003071f3f7fffff, 0x070c3860c0800000 },
+    { 0x0003071f3f7fffff, 0x070c3860c0800000 },
+    { 0x0003071f3f7fffff, 0x070c3860c0800000 },
+    { 0x03070f1f3f7fffff, 0x1c3870e0c0800000 },
+    { 0x03070f1f3f7fffff, 0x1c3870e0c0800000 },
+    { 0x03070f1f3f7fffff, 0x1c3870e0c0800000 },
+    { 0x03070f1f3f7fffff, 0x1c3870e0c0800000 },
+    { 0x0f1f3f3f7f7fffff, 0x306040c080800000 },
+    { 0x0f1f3f3f7f7fffff, 0x306040c080800000 },
+    { 0x0f1f3f3f7f7fffff, 0x306040c080800000 },
+    { 0x0f1f3f3f7f7fffff, 0x306040c080800000 },
+    { 0x3f7f7f7f7f7fffff, 0xc080808080800000 },
+    { 0x3f7f7f7f7f7fffff, 0xc080808080800000 },
+    { 0x3f7f7f7f7f7fffff, 0xc080808080800000 },
+    { 0x3f7f7f7f7f7fffff, 0xc080808080800000 },
+    { 0x00071f7fffffffff, 0x0f38e08000000000 },
+    { 0x00071f7fffffffff, 0x0f38e08000000000 },
+    { 0x00071f7fffffffff, 0x0f38e08000000000 },
+    { 0x00071f7fffffffff, 0x0f38e08000000000 },
+    { 0x030f3f7fffffffff, 0x1c70c08000000000 },
+    { 0x030f3f7fffffffff, 0x1c70c08000000000 },
+    { 0x030f3f7fffffffff, 0x1c70c08000000000 },
+    { 0x030f3f7fffffffff, 0x1c70c08000000000 },
+    { 0x0f1f3f7fffffffff, 0x70e0c08000000000 },
+    { 0x0f1f3f7fffffffff, 0x70e0c08000000000 },
+    { 0x0f1f3f7fffffffff, 0x70e0c08000000000 },
+    { 0x0f1f3f7fffffffff, 0x70e0c08000000000 },
+    { 0x3f7f7f7fffffffff, 0xc080808000000000 },
+    { 0x3f7f7f7fffffffff, 0xc080808000000000 },
+    { 0x3f7f7f7fffffffff, 0xc080808000000000 },
+    { 0x3f7f7f7fffffffff, 0xc080808000000000 },
+    { 0x003fffffffffffff, 0xffc0000000000000 },
+    { 0x003fffffffffffff, 0xffc0000000000000 },
+    { 0x003fffffffffffff, 0xffc0000000000000 },
+    { 0x003fffffffffffff, 0xffc0000000000000 },
+    { 0x037fffffffffffff, 0xfc80000000000000 },
+    { 0x037fffffffffffff, 0xfc80000000000000 },
+    { 0x037fffffffffffff, 0xfc80000000000000 },
+    { 0x037fffffffffffff, 0xfc80000000000000 },
+    { 0x0f7fffffffffffff, 0xf080000000000000 },
+    { 0x0f7fffffffffffff, 0xf080000000000000 },
+    { 0x0f7fffffffffffff, 0xf080000000000000 },
+    { 0x0f7fffffffffffff, 0xf080000000000000 },
+    { 0x3f7fffffffffffff, 0xc080000000000000 },
+    { 0x3f7fffffffffffff, 0xc080000000000000 },
+    { 0x3f7fffffffffffff, 0xc080000000000000 },
+    { 0x3f7fffffffffffff, 0xc080000000000000 },
+    { 0x000103070f1f3f7f, 0x070e1c3870e0c080 },
+    { 0x000103070f1f3f7f, 0x070e1c3870e0c080 },
+    { 0x000103070f1f3f7f, 0x070e1c3870e0c080 },
+    { 0x000103070f1f3f7f, 0x070e1c3870e0c080 },
+    { 0x03070f1f1f3f7f7f, 0x0c18302060c08080 },
+    { 0x03070f1f1f3f7f7f, 0x0c18302060c08080 },
+    { 0x03070f1f1f3f7f7f, 0x0c18302060c08080 },
+    { 0x03070f1f1f3f7f7f, 0x0c18302060c08080 },
+    { 0x0f1f1f3f3f7f7f7f, 0x30206040c0808080 },
+    { 0x0f1f1f3f3f7f7f7f, 0x30206040c0808080 },
+    { 0x0f1f1f3f3f7f7f7f, 0x30206040c0808080 },
+    { 0x0f1f1f3f3f7f7f7f, 0x30206040c0808080 },
+    { 0x3f3f7f7f7f7f7f7f, 0xc0c0808080808080 },
+    { 0x3f3f7f7f7f7f7f7f, 0xc0c0808080808080 },
+    { 0x3f3f7f7f7f7f7f7f, 0xc0c0808080808080 },
+    { 0x3f3f7f7f7f7f7f7f, 0xc0c0808080808080 },
+    { 0x0003071f3f7fffff, 0x070c3860c0800000 },
+    { 0x0003071f3f7fffff, 0x070c3860c0800000 },
+    { 0x0003071f3f7fffff, 0x070c3860c0800000 },
+    { 0x0003071f3f7fffff, 0x070c3860c0800000 },
+    { 0x03070f1f3f7fffff, 0x1c3870e0c0800000 },
+    { 0x03070f1f3f7fffff, 0x1c3870e0c0800000 },
+    { 0x03070f1f3f7fffff, 0x1c3870e0c0800000 },
+    { 0x03070f1f3f7fffff, 0x1c3870e0c0800000 },
+    { 0x0f1f3f3f7f7fffff, 0x306040c080800000 },
+    { 0x0f1f3f3f7f7fffff, 0x306040c080800000 },
+    { 0x0f1f3f3f7f7fffff, 0x306040c080800000 },
+    { 0x0f1f3f3f7f7fffff, 0x306040c080800000 },
+    { 0x3f7f7f7f7f7fffff, 0xc080808080800000 },
+    { 0x3f7f7f7f7f7fffff, 0xc080808080800000 },
+    { 0x3f7f7f7f7f7fffff, 0xc080808080800000 },
+    { 0x3f7f7f7f7f7fffff, 0xc080808080800000 },
+    { 0x00071f7fffffffff, 0x0f38e08000000000 },
+    { 0x00071f7fffffffff, 0x0f38e08000000000 },
+    { 0x00071f7fffffffff, 0x0f38e08000000000 },
+    { 0x00071f7fffffffff, 0x0f38e08000000000 },
+    { 0x030f3f7fffffffff, 0x1c70c08000000000 },
+    { 0x030f3f7fffffffff, 0x1c70c08000000000 },
+    { 0x030f3f7fffffffff, 0x1c70c08000000000 },
+    { 0x030f3f7fffffffff, 0x1c70c08000000000 },
+    { 0x0f1f3f7fffffffff, 0x70e0c08000000000 },
+    { 0x0f1f3f7fffffffff, 0x70e0c08000000000 },
+    { 0x0f1f3f7fffffffff, 0x70e0c08000000000 },
+    { 0x0f1f3f7fffffffff, 0x70e0c08000000000 },
+    { 0x3f7f7f7fffffffff, 0xc080808000000000 },
+    { 0x3f7f7f7fffffffff, 0xc080808000000000 },
+    { 0x3f7f7f7fffffffff, 0xc080808000000000 },
+    { 0x3f7f7f7fffffffff, 0xc080808000000000 },
+    { 0x003fffffffffffff, 0xffc0000000000000 },
+    { 0x003fffffffffffff, 0xffc0000000000000 },
+    { 0x003fffffffffffff, 0xffc0000000000000 },
+    { 0x003fffffffffffff, 0xffc0000000000000 },
+    { 0x037fffffffffffff, 0xfc80000000000000 },
+    { 0x037fffffffffffff, 0xfc80000000000000 },
+    { 0x037fffffffffffff, 0xfc80000000000000 },
+    { 0x037fffffffffffff, 0xfc80000000000000 },
+    { 0x0f7fffffffffffff, 0xf080000000000000 },
+    { 0x0f7fffffffffffff, 0xf080000000000000 },
+    { 0x0f7fffffffffffff, 0xf080000000000000 },
+    { 0x0f7fffffffffffff, 0xf080000000000000 },
+    { 0x3f7fffffffffffff, 0xc080000000000000 },
+    { 0x3f7fffffffffffff, 0xc080000000000000 },
+    { 0x3f7fffffffffffff, 0xc080000000000000 },
+    { 0x3f7fffffffffffff, 0xc080000000000000 },
+    { 0xfcfcfefefefefefe, 0x0303010101010101 },
+    { 0xfcfefefefefeffff, 0x0301010101010000 },
+    { 0xfcfefefeffffffff, 0x0301010100000000 },
+    { 0xfcfeffffffffffff, 0x0301000000000000 },
+    { 0xf0f8f8fcfcfefefe, 0x0c04060203010101 },
+    { 0xf0f8fcfcfefeffff, 0x0c06020301010000 },
+    { 0xf0f8fcfeffffffff, 0x0e07030100000000 },
+    { 0xf0feffffffffffff, 0x0f01000000000000 },
+    { 0xc0e0f0f8f8fcfefe, 0x30180c0406030101 },
+    { 0xc0e0f0f8fcfeffff, 0x381c0e0703010000 },
+    { 0xc0f0fcfeffffffff, 0x380e030100000000 },
+    { 0xc0feffffffffffff, 0x3f01000000000000 },
+    { 0x0080c0e0f0f8fcfe, 0xe070381c0e070301 },
+    { 0x00c0e0f8fcfeffff, 0xe0301c0603010000 },
+    { 0x00e0f8feffffffff, 0xf01c070100000000 },
+    { 0x00fcffffffffffff, 0xff03000000000000 },
+    { 0xfcfcfefefefefefe, 0x0303010101010101 },
+    { 0xfcfefefefefeffff, 0x0301010101010000 },
+    { 0xfcfefefeffffffff, 0x0301010100000000 },
+    { 0xfcfeffffffffffff, 0x0301000000000000 },
+    { 0xf0f8f8fcfcfefefe, 0x0c04060203010101 },
+    { 0xf0f8fcfcfefeffff, 0x0c06020301010000 },
+    { 0xf0f8fcfeffffffff, 0x0e07030100000000 },
+    { 0xf0feffffffffffff, 0x0f01000000000000 },
+    { 0xc0e0f0f8f8fcfefe, 0x30180c0406030101 },
+    { 0xc0e0f0f8fcfeffff, 0x381c0e0703010000 },
+    { 0xc0f0fcfeffffffff, 0x380e030100000000 },
+    { 0xc0feffffffffffff, 0x3f01000000000000 },
+    { 0x0080c0e0f0f8fcfe, 0xe070381c0e070301 },
+    { 0x00c0e0f8fcfeffff, 0xe0301c0603010000 },
+    { 0x00e0f8feffffffff, 0xf01c070100000000 },
+    { 0x00fcffffffffffff, 0xff03000000000000 },
+    { 0xfcfcfefefefefefe, 0x0303010101010101 },
+    { 0xfcfefefefefeffff, 0x0301010101010000 },
+    { 0xfcfefefeffffffff, 0x0301010100000000 },
+    { 0xfcfeffffffffffff, 0x0301000000000000 },
+    { 0xf0f8f8fcfcfefefe, 0x0c04060203010101 },
+    { 0xf0f8fcfcfefeffff, 0x0c06020301010000 },
+    { 0xf0f8fcfeffffffff, 0x0e07030100000000 },
+    { 0xf0feffffffffffff, 0x0f01000000000000 },
+    { 0xc0e0f0f8f8fcfefe, 0x30180c0406030101 },
+    { 0xc0e0f0f8fcfeffff, 0x381c0e0703010000 },
+    { 0xc0f0fcfeffffffff, 0x380e030100000000 },
+    { 0xc0feffffffffffff, 0x3f01000000000000 },
+    { 0x0080c0e0f0f8fcfe, 0xe070381c0e070301 },
+    { 0x00c0e0f8fcfeffff, 0xe0301c0603010000 },
+    { 0x00e0f8feffffffff, 0xf01c070100000000 },
+    { 0x00fcffffffffffff, 0xff03000000000000 },
+    { 0xfcfcfefefefefefe, 0x0303010101010101 },
+    { 0xfcfefefefefeffff, 0x0301010101010000 },
+    { 0xfcfefefeffffffff, 0x0301010100000000 },
+    { 0xfcfeffffffffffff, 0x0301000000000000 },
+    { 0xf0f8f8fcfcfefefe, 0x0c04060203010101 },
+    { 0xf0f8fcfcfefeffff, 0x0c06020301010000 },
+    { 0xf0f8fcfeffffffff, 0x0e07030100000000 },
+    { 0xf0feffffffffffff, 0x0f01000000000000 },
+    { 0xc0e0f0f8f8fcfefe, 0x30180c0406030101 },
+    { 0xc0e0f0f8fcfeffff, 0x381c0e0703010000 },
+    { 0xc0f0fcfeffffffff, 0x380e030100000000 },
+    { 0xc0feffffffffffff, 0x3f01000000000000 },
+    { 0x0080c0e0f0f8fcfe, 0xe070381c0e070301 },
+    { 0x00c0e0f8fcfeffff, 0xe0301c0603010000 },
+    { 0x00e0f8feffffffff, 0xf01c070100000000 },
+    { 0x00fcffffffffffff, 0xff03000000000000 },
+    { 0xfcfcfefefefefefe, 0x0303010101010101 },
+    { 0xfcfefefefefeffff, 0x0301010101010000 },
+    { 0xfcfefefeffffffff, 0x0301010100000000 },
+    { 0xfcfeffffffffffff, 0x0301000000000000 },
+    { 0xf0f8f8fcfcfefefe, 0x0c04060203010101 },
+    { 0xf0f8fcfcfefeffff, 0x0c06020301010000 },
+    { 0xf0f8fcfeffffffff, 0x0e07030100000000 },
+    { 0xf0feffffffffffff, 0x0f01000000000000 },
+    { 0xc0e0f0f8f8fcfefe, 0x30180c0406030101 },
+    { 0xc0e0f0f8fcfeffff, 0x381c0e0703010000 },
+    { 0xc0f0fcfeffffffff, 0x380e030100000000 },
+    { 0xc0feffffffffffff, 0x3f01000000000000 },
+    { 0x0080c0e0f0f8fcfe, 0xe070381c0e070301 },
+    { 0x00c0e0f8fcfeffff, 0xe0301c0603010000 },
+    { 0x00e0f8feffffffff, 0xf01c070100000000 },
+    { 0x00fcffffffffffff, 0xff03000000000000 },
+    { 0xfcfcfefefefefefe, 0x0303010101010101 },
+    { 0xfcfefefefefeffff, 0x0301010101010000 },
+    { 0xfcfefefeffffffff, 0x0301010100000000 },
+    { 0xfcfeffffffffffff, 0x0301000000000000 },
+    { 0xf0f8f8fcfcfefefe, 0x0c04060203010101 },
+    { 0xf0f8fcfcfefeffff, 0x0c06020301010000 },
+    { 0xf0f8fcfeffffffff, 0x0e07030100000000 },
+    { 0xf0feffffffffffff, 0x0f01000000000000 },
+    { 0xc0e0f0f8f8fcfefe, 0x30180c0406030101 },
+    { 0xc0e0f0f8fcfeffff, 0x381c0e0703010000 },
+    { 0xc0f0fcfeffffffff, 0x380e030100000000 },
+    { 0xc0feffffffffffff, 0x3f01000000000000 },
+    { 0x0080c0e0f0f8fcfe, 0xe070381c0e070301 },
+    { 0x00c0e0f8fcfeffff, 0xe0301c0603010000 },
+    { 0x00e0f8feffffffff, 0xf01c070100000000 },
+    { 0x00fcffffffffffff, 0xff03000000000000 },
+    { 0xfcfcfefefefefefe, 0x0303010101010101 },
+    { 0xfcfefefefefeffff, 0x0301010101010000 },
+    { 0xfcfefefeffffffff, 0x0301010100000000 },
+    { 0xfcfeffffffffffff, 0x0301000000000000 },
+    { 0xf0f8f8fcfcfefefe, 0x0c04060203010101 },
+    { 0xf0f8fcfcfefeffff, 0x0c06020301010000 },
+    { 0xf0f8fcfeffffffff, 0x0e07030100000000 },
+    { 0xf0feffffffffffff, 0x0f01000000000000 },
+    { 0xc0e0f0f8f8fcfefe, 0x30180c0406030101 },
+    { 0xc0e0f0f8fcfeffff, 0x381c0e0703010000 },
+    { 0xc0f0fcfeffffffff, 0x380e030100000000 },
+    { 0xc0feffffffffffff, 0x3f01000000000000 },
+    { 0x0080c0e0f0f8fcfe, 0xe070381c0e070301 },
+    { 0x00c0e0f8fcfeffff, 0xe0301c0603010000 },
+    { 0x00e0f8feffffffff, 0xf01c070100000000 },
+    { 0x00fcffffffffffff, 0xff03000000000000 },
+    { 0xfcfcfefefefefefe, 0x0303010101010101 },
+    { 0xfcfefefefefeffff, 0x0301010101010000 },
+    { 0xfcfefefeffffffff, 0x0301010100000000 },
+    { 0xfcfeffffffffffff, 0x0301000000000000 },
+    { 0xf0f8f8fcfcfefefe, 0x0c04060203010101 },
+    { 0xf0f8fcfcfefeffff, 0x0c06020301010000 },
+    { 0xf0f8fcfeffffffff, 0x0e07030100000000 },
+    { 0xf0feffffffffffff, 0x0f01000000000000 },
+    { 0xc0e0f0f8f8fcfefe, 0x30180c0406030101 },
+    { 0xc0e0f0f8fcfeffff, 0x381c0e0703010000 },
+    { 0xc0f0fcfeffffffff, 0x380e030100000000 },
+    { 0xc0feffffffffffff, 0x3f01000000000000 },
+    { 0x0080c0e0f0f8fcfe, 0xe070381c0e070301 },
+    { 0x00c0e0f8fcfeffff, 0xe0301c0603010000 },
+    { 0x00e0f8feffffffff, 0xf01c070100000000 },
+    { 0x00fcffffffffffff, 0xff03000000000000 },
+    { 0xfcfcfefefefefefe, 0x0303010101010101 },
+    { 0xfcfefefefefeffff, 0x0301010101010000 },
+    { 0xfcfefefeffffffff, 0x0301010100000000 },
+    { 0xfcfeffffffffffff, 0x0301000000000000 },
+    { 0xf0f8f8fcfcfefefe, 0x0c04060203010101 },
+    { 0xf0f8fcfcfefeffff, 0x0c06020301010000 },
+    { 0xf0f8fcfeffffffff, 0x0e07030100000000 },
+    { 0xf0feffffffffffff, 0x0f01000000000000 },
+    { 0xc0e0f0f8f8fcfefe, 0x30180c0406030101 },
+    { 0xc0e0f0f8fcfeffff, 0x381c0e0703010000 },
+    { 0xc0f0fcfeffffffff, 0x380e030100000000 },
+    { 0xc0feffffffffffff, 0x3f01000000000000 },
+    { 0x0080c0e0f0f8fcfe, 0xe070381c0e070301 },
+    { 0x00c0e0f8fcfeffff, 0xe0301c0603010000 },
+    { 0x00e0f8feffffffff, 0xf01c070100000000 },
+    { 0x00fcffffffffffff, 0xff03000000000000 },
+    { 0xfcfcfefefefefefe, 0x0303010101010101 },
+    { 0xfcfefefefefeffff, 0x0301010101010000 },
+    { 0xfcfefefeffffffff, 0x0301010100000000 },
+    { 0xfcfeffffffffffff, 0x0301000000000000 },
+    { 0xf0f8f8fcfcfefefe, 0x0c04060203010101 },
+    { 0xf0f8fcfcfefeffff, 0x0c06020301010000 },
+    { 0xf0f8fcfeffffffff, 0x0e07030100000000 },
+    { 0xf0feffffffffffff, 0x0f01000000000000 },
+    { 0xc0e0f0f8f8fcfefe, 0x30180c0406030101 },
+    { 0xc0e0f0f8fcfeffff, 0x381c0e0703010000 },
+    { 0xc0f0fcfeffffffff, 0x380e030100000000 },
+    { 0xc0feffffffffffff, 0x3f01000000000000 },
+    { 0x0080c0e0f0f8fcfe, 0xe070381c0e070301 },
+    { 0x00c0e0f8fcfeffff, 0xe0301c0603010000 },
+    { 0x00e0f8feffffffff, 0xf01c070100000000 },
+    { 0x00fcffffffffffff, 0xff03000000000000 },
+    { 0xfcfcfefefefefefe, 0x0303010101010101 },
+    { 0xfcfefefefefeffff, 0x0301010101010000 },
+    { 0xfcfefefeffffffff, 0x0301010100000000 },
+    { 0xfcfeffffffffffff, 0x0301000000000000 },
+    { 0xf0f8f8fcfcfefefe, 0x0c04060203010101 },
+    { 0xf0f8fcfcfefeffff, 0x0c06020301010000 },
+    { 0xf0f8fcfeffffffff, 0x0e07030100000000 },
+    { 0xf0feffffffffffff, 0x0f01000000000000 },
+    { 0xc0e0f0f8f8fcfefe, 0x30180c0406030101 },
+    { 0xc0e0f0f8fcfeffff, 0x381c0e0703010000 },
+    { 0xc0f0fcfeffffffff, 0x380e030100000000 },
+    { 0xc0feffffffffffff, 0x3f01000000000000 },
+    { 0x0080c0e0f0f8fcfe, 0xe070381c0e070301 },
+    { 0x00c0e0f8fcfeffff, 0xe0301c0603010000 },
+    { 0x00e0f8feffffffff, 0xf01c070100000000 },
+    { 0x00fcffffffffffff, 0xff03000000000000 },
+    { 0xfcfcfefefefefefe, 0x0303010101010101 },
+    { 0xfcfefefefefeffff, 0x0301010101010000 },
+    { 0xfcfefefeffffffff, 0x0301010100000000 },
+    { 0xfcfeffffffffffff, 0x0301000000000000 },
+    { 0xf0f8f8fcfcfefefe, 0x0c04060203010101 },
+    { 0xf0f8fcfcfefeffff, 0x0c06020301010000 },
+    { 0xf0f8fcfeffffffff, 0x0e07030100000000 },
+    { 0xf0feffffffffffff, 0x0f01000000000000 },
+    { 0xc0e0f0f8f8fcfefe, 0x30180c0406030101 },
+    { 0xc0e0f0f8fcfeffff, 0x381c0e0703010000 },
+    { 0xc0f0fcfeffffffff, 0x380e030100000000 },
+    { 0xc0feffffffffffff, 0x3f01000000000000 },
+    { 0x0080c0e0f0f8fcfe, 0xe070381c0e070301 },
+    { 0x00c0e0f8fcfeffff, 0xe0301c0603010000 },
+    { 0x00e0f8feffffffff, 0xf01c070100000000 },
+    { 0x00fcffffffffffff, 0xff03000000000000 },
+    { 0xfcfcfefefefefefe, 0x0303010101010101 },
+    { 0xfcfefefefefeffff, 0x0301010101010000 },
+    { 0xfcfefefeffffffff, 0x0301010100000000 },
+    { 0xfcfeffffffffffff, 0x0301000000000000 },
+    { 0xf0f8f8fcfcfefefe, 0x0c04060203010101 },
+    { 0xf0f8fcfcfefeffff, 0x0c06020301010000 },
+    { 0xf0f8fcfeffffffff, 0x0e07030100000000 },
+    { 0xf0feffffffffffff, 0x0f01000000000000 },
+    { 0xc0e0f0f8f8fcfefe, 0x30180c0406030101 },
+    { 0xc0e0f0f8fcfeffff, 0x381c0e0703010000 },
+    { 0xc0f0fcfeffffffff, 0x380e030100000000 },
+    { 0xc0feffffffffffff, 0x3f01000000000000 },
+    { 0x0080c0e0f0f8fcfe, 0xe070381c0e070301 },
+    { 0x00c0e0f8fcfeffff, 0xe0301c0603010000 },
+    { 0x00e0f8feffffffff, 0xf01c070100000000 },
+    { 0x00fcffffffffffff, 0xff03000000000000 },
+    { 0xfcfcfefefefefefe, 0x0303010101010101 },
+    { 0xfcfefefefefeffff, 0x0301010101010000 },
+    { 0xfcfefefeffffffff, 0x0301010100000000 },
+    { 0xfcfeffffffffffff, 0x0301000000000000 },
+    { 0xf0f8f8fcfcfefefe, 0x0c04060203010101 },
+    { 0xf0f8fcfcfefeffff, 0x0c06020301010000 },
+    { 0xf0f8fcfeffffffff, 0x0e07030100000000 },
+    { 0xf0feffffffffffff, 0x0f01000000000000 },
+    { 0xc0e0f0f8f8fcfefe, 0x30180c0406030101 },
+    { 0xc0e0f0f8fcfeffff, 0x381c0e0703010000 },
+    { 0xc0f0fcfeffffffff, 0x380e030100000000 },
+    { 0xc0feffffffffffff, 0x3f01000000000000 },
+    { 0x0080c0e0f0f8fcfe, 0xe070381c0e070301 },
+    { 0x00c0e0f8fcfeffff, 0xe0301c0603010000 },
+    { 0x00e0f8feffffffff, 0xf01c070100000000 },
+    { 0x00fcffffffffffff, 0xff03000000000000 },
+    { 0xfcfcfefefefefefe, 0x0303010101010101 },
+    { 0xfcfefefefefeffff, 0x0301010101010000 },
+    { 0xfcfefefeffffffff, 0x0301010100000000 },
+    { 0xfcfeffffffffffff, 0x0301000000000000 },
+    { 0xf0f8f8fcfcfefefe, 0x0c04060203010101 },
+    { 0xf0f8fcfcfefeffff, 0x0c06020301010000 },
+    { 0xf0f8fcfeffffffff, 0x0e07030100000000 },
+    { 0xf0feffffffffffff, 0x0f01000000000000 },
+    { 0xc0e0f0f8f8fcfefe, 0x30180c0406030101 },
+    { 0xc0e0f0f8fcfeffff, 0x381c0e0703010000 },
+    { 0xc0f0fcfeffffffff, 0x380e030100000000 },
+    { 0xc0feffffffffffff, 0x3f01000000000000 },
+    { 0x0080c0e0f0f8fcfe, 0xe070381c0e070301 },
+    { 0x00c0e0f8fcfeffff, 0xe0301c0603010000 },
+    { 0x00e0f8feffffffff, 0xf01c070100000000 },
+    { 0x00fcffffffffffff, 0xff03000000000000 },
+    { 0xfcfcfefefefefefe, 0x0303010101010101 },
+    { 0xfcfefefefefeffff, 0x0301010101010000 },
+    { 0xfcfefefeffffffff, 0x0301010100000000 },
+    { 0xfcfeffffffffffff, 0x0301000000000000 },
+    { 0xf0f8f8fcfcfefefe, 0x0c04060203010101 },
+    { 0xf0f8fcfcfefeffff, 0x0c06020301010000 },
+    { 0xf0f8fcfeffffffff, 0x0e07030100000000 },
+    { 0xf0feffffffffffff, 0x0f01000000000000 },
+    { 0xc0e0f0f8f8fcfefe, 0x30180c0406030101 },
+    { 0xc0e0f0f8fcfeffff, 0x381c0e0703010000 },
+    { 0xc0f0fcfeffffffff, 0x380e030100000000 },
+    { 0xc0feffffffffffff, 0x3f01000000000000 },
+    { 0x0080c0e0f0f8fcfe, 0xe070381c0e070301 },
+    { 0x00c0e0f8fcfeffff, 0xe0301c0603010000 },
+    { 0x00e0f8feffffffff, 0xf01c070100000000 },
+    { 0x00fcffffffffffff, 0xff03000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+    { 0xffffffffffffffff, 0x0000000000000000 },
+};
+
+#endif
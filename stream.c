@@ -0,0 +1,279 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "marching.h"
+#include "pipeline.h"
+#include "stream.h"
+
+ppm_image *stream_read_ppm(FILE *const in) {
+    int x, y, maxval;
+
+    if (fscanf(in, " P6 %d %d %d", &x, &y, &maxval) != 3 || maxval != RGB_COMPONENT_COLOR
+        || x <= 0 || y <= 0 || x > STREAM_MAX_SIDE || y > STREAM_MAX_SIDE || fgetc(in) == EOF) {
+        return NULL;
+    }
+
+    ppm_image *const image = malloc(sizeof(ppm_image));
+
+    image->x    = x;
+    image->y    = y;
+    image->data = malloc((size_t) x * y * sizeof(ppm_pixel));
+    if (fread(image->data, sizeof(ppm_pixel), (size_t) x * y, in) != (size_t) x * y) {
+        free(image->data);
+        free(image);
+        return NULL;
+    }
+    return image;
+}
+
+int stream_write_ppm(FILE *const out, const ppm_image *const image) {
+    fprintf(out, "P6\n%d %d\n%d\n", image->x, image->y, RGB_COMPONENT_COLOR);
+    fwrite(image->data, sizeof(ppm_pixel), (size_t) image->x * image->y, out);
+    return fflush(out) ? -1 : 0;
+}
+
+static void image_free(ppm_image *const image) {
+    free(image->data);
+    free(image);
+}
+
+// A frame, and its result once marched: the frame itself when it isn't
+// rescaled
+typedef struct {
+    ppm_image *frame;
+    ppm_image *result;
+} stream_frame;
+
+static void stream_frame_free(const stream_frame *const f) {
+    if (f->result && f->result != f->frame) {
+        image_free(f->result);
+    }
+    image_free(f->frame);
+}
+
+// Hands the frames from one stage to the next, one at a time, so that no
+// stage gets more than a frame ahead of the next. Closed by the stage
+// putting once it is done, or by the one taking should it fail.
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t  changed;
+    stream_frame    slot;
+    int             full;
+    int             closed;
+} stream_handoff;
+
+typedef struct {
+    const char     *filename_in;
+    FILE           *in, *out;
+    stream_handoff  decoded, marched;
+    long            frames;
+    double          busy[3];   // seconds decoding, marching and encoding
+    int             failed;
+} stream_state;
+
+static double stream_seconds(const struct timespec *const from, const struct timespec *const to) {
+    return (to->tv_sec - from->tv_sec) + (to->tv_nsec - from->tv_nsec) / 1e9;
+}
+
+static void handoff_init(stream_handoff *const h) {
+    memset(h, 0, sizeof(*h));
+    pthread_mutex_init(&h->lock, NULL);
+    pthread_cond_init(&h->changed, NULL);
+}
+
+// Frees a frame left behind by a failed stage
+static void handoff_destroy(stream_handoff *const h) {
+    if (h->full) {
+        stream_frame_free(&h->slot);
+    }
+    pthread_cond_destroy(&h->changed);
+    pthread_mutex_destroy(&h->lock);
+}
+
+// Fails once the next stage is gone, the frame is then still the caller's
+static int handoff_put(stream_handoff *const h, const stream_frame *const f) {
+    pthread_mutex_lock(&h->lock);
+    while (h->full && !h->closed) {
+        pthread_cond_wait(&h->changed, &h->lock);
+    }
+
+    const int closed = h->closed;
+
+    if (!closed) {
+        h->slot = *f;
+        h->full = 1;
+        pthread_cond_broadcast(&h->changed);
+    }
+    pthread_mutex_unlock(&h->lock);
+    return closed ? -1 : 0;
+}
+
+// 0 once the stage before is done and every frame was taken
+static int handoff_take(stream_handoff *const h, stream_frame *const f) {
+    pthread_mutex_lock(&h->lock);
+    while (!h->full && !h->closed) {
+        pthread_cond_wait(&h->changed, &h->lock);
+    }
+
+    const int full = h->full;
+
+    if (full) {
+        *f      = h->slot;
+        h->full = 0;
+        pthread_cond_broadcast(&h->changed);
+    }
+    pthread_mutex_unlock(&h->lock);
+    return full;
+}
+
+static void handoff_close(stream_handoff *const h) {
+    pthread_mutex_lock(&h->lock);
+    h->closed = 1;
+    pthread_cond_broadcast(&h->changed);
+    pthread_mutex_unlock(&h->lock);
+}
+
+// The stream may end after any frame, trailing whitespace aside
+static int stream_at_end(FILE *const in) {
+    int c;
+
+    while ((c = getc(in)) != EOF && isspace(c)) {
+    }
+    if (c == EOF) {
+        return 1;
+    }
+    ungetc(c, in);
+    return 0;
+}
+
+static void *stream_decode(void *arg) {
+    stream_state *const st = arg;
+
+    for (long n = 0; !stream_at_end(st->in); ++n) {
+        struct timespec begin, end;
+
+        clock_gettime(CLOCK_MONOTONIC, &begin);
+        const stream_frame f = { .frame = stream_read_ppm(st->in) };
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        st->busy[0] += stream_seconds(&begin, &end);
+
+        if (!f.frame) {
+            fprintf(stderr, "Invalid frame %ld in '%s'\n", n, st->filename_in);
+            st->failed = 1;
+            break;
+        }
+        if (handoff_put(&st->decoded, &f)) {
+            stream_frame_free(&f);
+            break;
+        }
+    }
+    handoff_close(&st->decoded);
+    return NULL;
+}
+
+static void *stream_encode(void *arg) {
+    stream_state *const st = arg;
+    stream_frame        f;
+
+    while (handoff_take(&st->marched, &f)) {
+        struct timespec begin, end;
+
+        clock_gettime(CLOCK_MONOTONIC, &begin);
+        const int rc = stream_write_ppm(st->out, f.result);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        st->busy[2] += stream_seconds(&begin, &end);
+
+        stream_frame_free(&f);
+        if (rc) {
+            perror("stream");
+            st->failed = 1;
+            handoff_close(&st->marched);
+            break;
+        }
+        ++st->frames;
+    }
+    return NULL;
+}
+
+int stream_run(const char *filename_in, const char *filename_out, const pipeline_job *const job) {
+    stream_state st      = { .filename_in = filename_in };
+    pipeline_job marcher = *job;
+    pthread_t    decoder, encoder;
+
+    st.in  = strcmp(filename_in, "-") ? fopen(filename_in, "rb") : stdin;
+    st.out = strcmp(filename_out, "-") ? fopen(filename_out, "wb") : stdout;
+    if (!st.in || !st.out) {
+        fprintf(stderr, "Unable to open file '%s'\n", st.in ? filename_out : filename_in);
+        exit(1);
+    }
+
+    // The tiles are loaded once, for every frame
+    marcher.filename_in  = NULL;
+    marcher.filename_out = NULL;
+    if (!marcher.cmap) {
+        marcher.cmap = malloc(CONTOUR_CONFIG_COUNT * sizeof(ppm_image *));
+        init_cmap(marcher.cmap, 0, 1);
+    }
+
+    handoff_init(&st.decoded);
+    handoff_init(&st.marched);
+
+    struct timespec begin, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+    pthread_create(&decoder, NULL, stream_decode, &st);
+    pthread_create(&encoder, NULL, stream_encode, &st);
+
+    stream_frame f;
+
+    while (handoff_take(&st.decoded, &f)) {
+        struct timespec started, finished;
+
+        clock_gettime(CLOCK_MONOTONIC, &started);
+        marcher.image = f.frame;
+        f.result      = pipeline_run(&marcher);
+        clock_gettime(CLOCK_MONOTONIC, &finished);
+        st.busy[1] += stream_seconds(&started, &finished);
+
+        if (!f.result || handoff_put(&st.marched, &f)) {
+            stream_frame_free(&f);
+            st.failed = 1;
+            break;
+        }
+    }
+
+    // Stops the decoder early when a stage failed
+    handoff_close(&st.decoded);
+    handoff_close(&st.marched);
+    pthread_join(decoder, NULL);
+    pthread_join(encoder, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    handoff_destroy(&st.decoded);
+    handoff_destroy(&st.marched);
+    if (st.in != stdin) {
+        fclose(st.in);
+    }
+    if (st.out != stdout) {
+        fclose(st.out);
+    }
+    if (!job->cmap) {
+        for (long k = 0; k < CONTOUR_CONFIG_COUNT; ++k) {
+            image_free(marcher.cmap[k]);
+        }
+        free(marcher.cmap);
+    }
+
+    const double seconds = stream_seconds(&begin, &end);
+
+    fprintf(stderr, "stream: %ld frames in %.3f s (%.2f fps), busy decoding %.3f s, "
+            "marching %.3f s, encoding %.3f s\n", st.frames, seconds, st.frames / seconds,
+            st.busy[0], st.busy[1], st.busy[2]);
+    return st.failed ? 1 : 0;
+}
@@ -0,0 +1,30 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <stdio.h>
+
+#include "helpers.h"
+#include "pipeline.h"
+
+// Larger frames are refused rather than allocated
+#define STREAM_MAX_SIDE 32768
+
+// NULL on a malformed or truncated image. Unlike read_ppm(), the header
+// can't have comments.
+ppm_image *stream_read_ppm(FILE *const in);
+
+// Writes and flushes one P6 image, -1 if that failed
+int stream_write_ppm(FILE *const out, const ppm_image *const image);
+
+// Marches every frame of the concatenated P6 frames of `filename_in` into
+// the frames of `filename_out`, either of which can be "-" for the standard
+// input or output. The frames go through three stages at once: frame N+1 is
+// decoded and frame N-1 encoded on threads of their own while frame N is
+// marched as `job` says, on its threads. The frames can have any size. The
+// tiles are loaded once when `job->cmap` is NULL. Reports the frames per
+// second achieved on stderr.
+int stream_run(const char *filename_in, const char *filename_out, const pipeline_job *const job);
+
+#endif
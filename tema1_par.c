@@ -4,9 +4,19 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <string.h>
-#include <pthread.h>
+#include <getopt.h>
 
 #include "helpers.h"
+#include "marching.h"
+#include "batch.h"
+#include "stream.h"
+#include "backend.h"
+#include "pipeline.h"
+#include "kernels.h"
+#include "server.h"
+#include "profiler.h"
+#include "pfm.h"
+#include "textgrid.h"
 
 #define CONTOUR_CONFIG_COUNT 16
 #define STEP                 8
@@ -14,267 +24,363 @@
 #define RESCALE              2048
 
 #define CLAMP(v, min, max) if (v < min) { v = min; } else if (v > max) { v = max; }
-#define MIN(a, b)          ((a) < (b) ? (a) : (b))
 
-enum {
-    LOCK_CMAP_ALLOC,
-    LOCK_IMAGE_READ,
-    LOCK_GRID_ALLOC,
-    LOCK_WRITE,
-    NLOCKS
-};
-
-enum {
-    BARRIER_CMAP_AND_IMAGE_ALLOC,
-    BARRIER_CMAP_INIT_AND_GRID_ALLOC,
-    BARRIER_SAMPLE_GRID,
-    BARRIER_RESCALE_IMAGE,
-    BARRIER_MARCH,
-    NBARRIERS
-};
-
-typedef struct {
-    ppm_image        *image;
-    ppm_image        *scaled;
-    ppm_image       **cmap;
-    unsigned char   **grid;
-
-    long              nthreads;
-    pthread_mutex_t   locks[NLOCKS];
-    pthread_barrier_t barriers[NBARRIERS];
-
-    char filename_in[FILENAME_MAX_SIZE];
-    char filename_out[FILENAME_MAX_SIZE];
-
-    long              finished;
-} thread_data_shared;
-
-typedef struct {
-    thread_data_shared *shared;
-    long                tid;
-} thread_data;
-
-typedef struct {
-    long start;
-    long end;
-} thread_slice;
-
-static inline thread_slice thread_get_slice(const long tid,
-                                     const long nthreads,
-                                     const long range) {
-    const double ratio = (double) range / (double) nthreads;
-    return (thread_slice) {
-        .start = tid * ratio,
-        .end   = MIN((tid + 1) * ratio, range)
-    };
-}
-
-void init_cmap(ppm_image **const cmap,
-               const long tid,
-               const long nthreads) {
-    const thread_slice slice = thread_get_slice(tid, nthreads, CONTOUR_CONFIG_COUNT);
-
-    for (long i = slice.start; i < slice.end; ++i) {
-        char filename[FILENAME_MAX_SIZE];
-        sprintf(filename, "./contours/%ld.ppm", i);
-        cmap[i] = read_ppm(filename);
-    }
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "Usage: %s [options] <in> <out> <nthreads>\n"
+            "       %s --serve SOCKET [--trace FILE] [options] <nthreads>\n"
+            "  --batch      <in> lists one image per line, <out> is a directory;\n"
+            "               either can be a .tar archive of the images instead\n"
+            "  --stream     <in> and <out> are streams of concatenated P6 frames,\n"
+            "               either can be - for the standard input or output\n"
+            "  --serve SOCKET\n"
+            "               take jobs on the Unix socket SOCKET until told to quit\n"
+            "               (see server.h), instead of marching <in>\n"
+            "  --trace FILE record the jobs served to FILE, for loadgen to replay\n"
+            "  --no-coalesce\n"
+            "               run every job served, even those identical to one\n"
+            "               queued or running\n"
+            "  --mosaic     <in> is the manifest of a grid of tiles, read as one\n"
+            "               image (same format as the --tiles manifest)\n"
+            "  --sdf FILE   also write the signed distance field of the grid\n"
+            "               (float PFM for *.pfm, 8-bit PGM otherwise)\n"
+            "  --backend B  pthread (default), openmp or serial\n"
+            "  --checkpoint FILE\n"
+            "               write <out> band by band, recording progress in FILE\n"
+            "               so that an interrupted run can be resumed\n"
+            "  --tiles WxH  write <out> as a directory of WxH tiles and a manifest\n"
+            "  --mmap-out   march directly into a memory mapping of <out>\n"
+            "  --rle-grid   store the grid as runs, for large mostly uniform maps\n"
+            "  --overlay[=A]\n"
+            "               draw only the contour lines over the image, with\n"
+            "               alpha A (1-255, 255 by default)\n"
+            "  --smooth     place the contour where it crosses each cell edge\n"
+            "  --in-place   downscale into the input buffer to save memory\n"
+            "  --blocked    keep the rescaled image in 64x64 blocks while marching\n"
+            "  --adaptive W[,C]\n"
+            "               threshold against the mean of the WxW window around\n"
+            "               each point, less C (0 by default), instead of SIGMA\n"
+            "  --mask FILE  P5 mask of <in>, zero where it has no data (a P7 <in>\n"
+            "               with an alpha channel, or an ESRI grid with a\n"
+            "               NODATA_value, doesn't need one)\n"
+            "  --nodata R,G,B\n"
+            "               colour of the cells without data (black by default)\n"
+            "  --threshold T\n"
+            "               points of a float <in> (PFM, ESRI ASCII grid or CSV)\n"
+            "               at most T are inside (200 by default)\n"
+            "  --deadline MS\n"
+            "               give up on <in> after MS milliseconds (a checkpoint is\n"
+            "               kept, to resume from)\n"
+            "  --partial    past the deadline, still write what was marched\n"
+            "  --profile FILE\n"
+            "               sample the threads and write folded stacks to FILE\n"
+            "  --kernel K=V use variant V of kernel K (rescale,\n"
+            "               rescale_float, sample_grid, march)\n"
+            "  --kernel-bench\n"
+            "               time the kernel variants at startup, keep the fastest\n"
+            "  --kernel-profile FILE\n"
+            "               read the kernel variants from FILE, benchmarking them\n"
+            "               and writing it if it's missing or from another CPU\n",
+            argv0, argv0);
+    exit(1);
 }
 
-void rescale_image(ppm_image *const image,
-                   ppm_image *const scaled,
-                   const long tid,
-                   const long nthreads) {
-    if (image->x <= RESCALE_X && image->y <= RESCALE_Y) {
-        return;
-    }
-
-    uint8_t sample[3];
-
-    scaled->x = RESCALE_X;
-    scaled->y = RESCALE_Y;
-
-    const thread_slice slice = thread_get_slice(tid, nthreads, RESCALE_X * RESCALE_Y);
-
-    for (long i = slice.start; i < slice.end; ++i) {
-        sample_bicubic(image,
-                      (float)(i / RESCALE_Y) / (RESCALE_X - 1),
-                      (float)(i % RESCALE_Y) / (RESCALE_Y - 1),
-                      sample);
-
-        scaled->data[i] = *((ppm_pixel *) sample);
-    }
-}
-
-void sample_grid(unsigned char  **const grid,
-                 const ppm_image *const image,
-                 const long tid,
-                 const long nthreads) {
-    const long   p           = image->x / STEP;
-    const long   q           = image->y / STEP;
-    const thread_slice slice = thread_get_slice(tid, nthreads, p);
-
-    ppm_pixel     curr_pix;
-    unsigned char curr_col;
-
-    for (long i = slice.start; i < slice.end; ++i) {
-        grid[i] = malloc((q + 1) * sizeof(unsigned char));
-
-        curr_pix = image->data[i * STEP * image->y + image->x - 1];
-        curr_col = (curr_pix.red + curr_pix.green + curr_pix.blue) / 3;
-        grid[i][q] = curr_col <= SIGMA;
+int main(int argc, char *argv[]) {
+    static const struct option long_options[] = {
+        { "batch",          no_argument,       NULL, 'b' },
+        { "mosaic",         no_argument,       NULL, 'T' },
+        { "stream",         no_argument,       NULL, 'F' },
+        { "serve",          required_argument, NULL, 'L' },
+        { "trace",          required_argument, NULL, 'R' },
+        { "no-coalesce",    no_argument,       NULL, 'C' },
+        { "sdf",            required_argument, NULL, 's' },
+        { "backend",        required_argument, NULL, 'B' },
+        { "checkpoint",     required_argument, NULL, 'c' },
+        { "tiles",          required_argument, NULL, 't' },
+        { "mmap-out",       no_argument,       NULL, 'm' },
+        { "rle-grid",       no_argument,       NULL, 'r' },
+        { "overlay",        optional_argument, NULL, 'o' },
+        { "smooth",         no_argument,       NULL, 'S' },
+        { "in-place",       no_argument,       NULL, 'i' },
+        { "blocked",        no_argument,       NULL, 'O' },
+        { "adaptive",       required_argument, NULL, 'a' },
+        { "mask",           required_argument, NULL, 'M' },
+        { "nodata",         required_argument, NULL, 'n' },
+        { "threshold",      required_argument, NULL, 'h' },
+        { "deadline",       required_argument, NULL, 'd' },
+        { "partial",        no_argument,       NULL, 'q' },
+        { "profile",        required_argument, NULL, 'P' },
+        { "kernel",         required_argument, NULL, 'k' },
+        { "kernel-bench",   no_argument,       NULL, 'K' },
+        { "kernel-profile", required_argument, NULL, 'p' },
+        { NULL,             0,                 NULL, 0   }
+    };
 
-        for (long j = 0; j < q; ++j) {
-            curr_pix = image->data[i * STEP * image->y + j * STEP];
-            curr_col = (curr_pix.red + curr_pix.green + curr_pix.blue) / 3;
-            grid[i][j] = curr_col <= SIGMA;
+    const char    *filename_sdf        = NULL;
+    const char    *filename_checkpoint = NULL;
+    const backend *engine              = backend_find(NULL);
+    int            tile_size[2]        = { 0, 0 };
+    int            mmap_out            = 0;
+    int            rle_grid            = 0;
+    int            overlay             = 0;
+    int            smooth              = 0;
+    int            in_place            = 0;
+    int            blocked             = 0;
+    int            adaptive[2]         = { 0, 0 };
+    const char    *filename_mask       = NULL;
+    ppm_pixel      nodata              = { 0, 0, 0 };
+    float          threshold           = SIGMA;
+    int            threshold_set       = 0;
+    long           deadline            = 0;
+    int            partial             = 0;
+    const char   **kernel_forced       = calloc(argc, sizeof(char *));
+    long           kernel_nforced      = 0;
+    const char    *filename_profile    = NULL;
+    int            kernel_bench        = 0;
+    int            batch               = 0;
+    int            stream              = 0;
+    int            mosaic              = 0;
+    const char    *socket_path         = NULL;
+    const char    *filename_trace      = NULL;
+    int            coalesce            = 1;
+    const char    *filename_folded     = NULL;
+    int            rc;
+    int            opt;
+
+    while ((opt = getopt_long(argc, argv, "", long_options, NULL)) != -1) {
+        switch (opt) {
+        case 'b':
+            batch = 1;
+            break;
+        case 'T':
+            mosaic = 1;
+            break;
+        case 'F':
+            stream = 1;
+            break;
+        case 'L':
+            socket_path = optarg;
+            break;
+        case 'R':
+            filename_trace = optarg;
+            break;
+        case 'C':
+            coalesce = 0;
+            break;
+        case 's':
+            filename_sdf = optarg;
+            break;
+        case 'B':
+            if (!(engine = backend_find(optarg))) {
+                fprintf(stderr, "Unknown backend '%s'\n", optarg);
+                exit(1);
+            }
+            break;
+        case 'c':
+            filename_checkpoint = optarg;
+            break;
+        case 'm':
+            mmap_out = 1;
+            break;
+        case 'r':
+            rle_grid = 1;
+            break;
+        case 'S':
+            smooth = 1;
+            break;
+        case 'o':
+            overlay = optarg ? atoi(optarg) : 255;
+            if (overlay < 1 || overlay > 255) {
+                fprintf(stderr, "The overlay alpha must be between 1 and 255\n");
+                exit(1);
+            }
+            break;
+        case 'i':
+            in_place = 1;
+            break;
+        case 'O':
+            blocked = 1;
+            break;
+        case 'a':
+            if (sscanf(optarg, "%d,%d", &adaptive[0], &adaptive[1]) < 1 || adaptive[0] < 1) {
+                fprintf(stderr, "--adaptive takes a window size W, or W,C\n");
+                exit(1);
+            }
+            break;
+        case 'M':
+            filename_mask = optarg;
+            break;
+        case 'n': {
+            int red, green, blue;
+
+            if (sscanf(optarg, "%d,%d,%d", &red, &green, &blue) != 3
+                || red < 0 || red > 255 || green < 0 || green > 255 || blue < 0 || blue > 255) {
+                fprintf(stderr, "--nodata takes a colour as R,G,B\n");
+                exit(1);
+            }
+            nodata = (ppm_pixel) { red, green, blue };
+            break;
         }
-    }
-
-    // Task reserved for the thread having the last slice of the range
-    if (tid == nthreads - 1) {
-        grid[p] = malloc((q + 1) * sizeof(unsigned char));
-
-        for (long j = 0; j < q; ++j) {
-            curr_pix = image->data[(image->x - 1) * image->y + j * STEP];
-            curr_col = (curr_pix.red + curr_pix.green + curr_pix.blue) / 3;
-            grid[p][j] = curr_col <= SIGMA;
+        case 'h': {
+            char *end;
+
+            threshold     = strtof(optarg, &end);
+            threshold_set = 1;
+            if (end == optarg || *end) {
+                fprintf(stderr, "--threshold takes a number\n");
+                exit(1);
+            }
+            break;
         }
-    }
-}
-
-static inline void march_update(ppm_image *const image,
-                         const ppm_image *const c,
-                         const long x,
-                         const long y) {
-    int idx_i, idx_c;
-
-    for (int i = 0; i < c->x; ++i) {
-        for (int j = 0; j < c->y; ++j) {
-            idx_c = c->x * i + j;
-            idx_i = (x + i) * image->y + y + j;
-
-            image->data[idx_i].red   = c->data[idx_c].red;
-            image->data[idx_i].green = c->data[idx_c].green;
-            image->data[idx_i].blue  = c->data[idx_c].blue;
+        case 'd':
+            if ((deadline = atol(optarg)) <= 0) {
+                fprintf(stderr, "--deadline takes a number of milliseconds\n");
+                exit(1);
+            }
+            break;
+        case 'q':
+            partial = 1;
+            break;
+        case 'P':
+            filename_folded = optarg;
+            break;
+        case 'k':
+            kernel_forced[kernel_nforced++] = optarg;
+            break;
+        case 'K':
+            kernel_bench = 1;
+            break;
+        case 'p':
+            filename_profile = optarg;
+            break;
+        case 't':
+            if (sscanf(optarg, "%dx%d", &tile_size[1], &tile_size[0]) != 2) {
+                tile_size[0] = tile_size[1] = atoi(optarg);
+            }
+            break;
+        default:
+            usage(argv[0]);
         }
     }
-}
-
-void march(ppm_image     *const image,
-           unsigned char *const *const grid,
-           ppm_image     *const *const cmap,
-           const long     tid,
-           const long     nthreads) {
-    const long p = image->x / STEP;
-    const long q = image->y / STEP;
-
-    const thread_slice slice = thread_get_slice(tid, nthreads, p);
-
-    unsigned char k;
-
-    for (long i = slice.start; i < slice.end; ++i) {
-        for (long j = 0; j < q; ++j) {
-            k = 8 * grid[i][j]
-              + 4 * grid[i][j + 1]
-              + 2 * grid[i + 1][j + 1]
-              +     grid[i + 1][j];
-            march_update(image, cmap[k], i * STEP, j * STEP);
-        }
+    if (argc - optind != (socket_path ? 1 : 3)) {
+        usage(argv[0]);
     }
-}
-
-void *worker(void *args) {
-    thread_data_shared *const shared = ((thread_data *) args)->shared;
-    const long                tid    = ((thread_data *) args)->tid;
 
-    pthread_mutex_lock(&shared->locks[LOCK_IMAGE_READ]);
-    if (!shared->image) {
-        shared->image = read_ppm(shared->filename_in);
-        if (shared->image->x <= RESCALE_X && shared->image->y <= RESCALE_Y) {
-            shared->scaled = shared->image;
-        } else {
-            shared->scaled       = malloc(sizeof(ppm_image));
-            shared->scaled->data = malloc(RESCALE_X * RESCALE_Y * sizeof(ppm_pixel));
-        }
+    if (socket_path && (batch || mosaic || filename_sdf || filename_checkpoint || tile_size[0]
+                        || mmap_out || rle_grid || overlay || smooth || in_place || blocked
+                        || adaptive[0] || filename_mask)) {
+        fprintf(stderr, "--serve only runs plain jobs, it can only be used with --trace, "
+                        "--no-coalesce, --backend and the --kernel options\n");
+        exit(1);
     }
-    pthread_mutex_unlock(&shared->locks[LOCK_IMAGE_READ]);
-    pthread_mutex_lock(&shared->locks[LOCK_CMAP_ALLOC]);
-    if (!shared->cmap) {
-        shared->cmap = malloc(CONTOUR_CONFIG_COUNT * sizeof(ppm_image *));
+    if (stream && (socket_path || batch || mosaic || filename_sdf || filename_checkpoint
+                   || tile_size[0] || mmap_out || in_place || filename_mask || deadline)) {
+        fprintf(stderr, "--stream marches the frames in memory, it can't be used with --serve, "
+                        "--batch, --mosaic, --sdf, --checkpoint, --tiles, --mmap-out, "
+                        "--in-place, --mask or --deadline\n");
+        exit(1);
     }
-    pthread_mutex_unlock(&shared->locks[LOCK_CMAP_ALLOC]);
-    pthread_barrier_wait(&shared->barriers[BARRIER_CMAP_AND_IMAGE_ALLOC]);
-    
-    rescale_image(shared->image, shared->scaled, tid, shared->nthreads);
-    pthread_barrier_wait(&shared->barriers[BARRIER_RESCALE_IMAGE]);
-
-    pthread_mutex_lock(&shared->locks[LOCK_GRID_ALLOC]);
-    if (!shared->grid) {
-        shared->grid = malloc((shared->scaled->x / STEP + 1) * sizeof(unsigned char *));
+    if (deadline && (socket_path || batch)) {
+        fprintf(stderr, "--deadline can't be used with --serve (jobs carry their own) "
+                        "or --batch\n");
+        exit(1);
     }
-    pthread_mutex_unlock(&shared->locks[LOCK_GRID_ALLOC]);
-    init_cmap(shared->cmap, tid, shared->nthreads);
-    pthread_barrier_wait(&shared->barriers[BARRIER_CMAP_INIT_AND_GRID_ALLOC]);
-
-    sample_grid(shared->grid, shared->scaled, tid, shared->nthreads);
-    pthread_barrier_wait(&shared->barriers[BARRIER_SAMPLE_GRID]);
-
-    march(shared->scaled, shared->grid, shared->cmap, tid, shared->nthreads);
-    pthread_barrier_wait(&shared->barriers[BARRIER_MARCH]);
-
-    pthread_mutex_lock(&shared->locks[LOCK_WRITE]);
-    if (!shared->finished) {
-        shared->finished = 1;
-        write_ppm(shared->scaled, shared->filename_out);
+    if (partial && !deadline) {
+        fprintf(stderr, "--partial needs --deadline\n");
+        exit(1);
+    }
+    if ((filename_trace || !coalesce) && !socket_path) {
+        fprintf(stderr, "--trace and --no-coalesce only apply to --serve\n");
+        exit(1);
     }
-    pthread_mutex_unlock(&shared->locks[LOCK_WRITE]);
 
-    return NULL;
-}
+    if (batch && (mosaic || filename_sdf || filename_checkpoint || tile_size[0] || mmap_out
+                  || rle_grid || overlay || smooth || in_place || blocked || adaptive[0]
+                  || filename_mask)) {
+        fprintf(stderr, "--batch only runs plain jobs, it can only be used with --backend, "
+                        "--profile and the --kernel options\n");
+        exit(1);
+    }
+    // A float <in> is recognized by its magic, like a P7 one: a PFM, an ESRI
+    // ASCII grid, or a CSV matrix by its name
+    const int pfm = !socket_path && !batch && !stream && !mosaic
+                 && (pfm_probe(argv[optind]) || text_grid_probe(argv[optind]));
+
+    if (threshold_set && !pfm) {
+        fprintf(stderr, "--threshold only applies to a float <in>\n");
+        exit(1);
+    }
 
-int main(int argc, char *argv[]) {
-    (void) argc;
+    // Last on the command line, whatever the mode
+    const long   nthreads = atol(argv[argc - 1]);
+    cancel_token cancel;
+    pipeline_job job      = {
+        .filename_in         = argv[optind],
+        .mosaic              = mosaic,
+        .filename_out        = argv[optind + 1],
+        .filename_sdf        = filename_sdf,
+        .filename_checkpoint = filename_checkpoint,
+        .tile_size           = { tile_size[0], tile_size[1] },
+        .mmap_out            = mmap_out,
+        .rle_grid            = rle_grid,
+        .overlay             = overlay,
+        .smooth              = smooth,
+        .in_place            = in_place,
+        .blocked             = blocked,
+        .adaptive_window     = adaptive[0],
+        .adaptive_offset     = adaptive[1],
+        .filename_mask       = filename_mask,
+        .nodata              = nodata,
+        .threshold           = threshold,
+        .partial             = partial,
+        .nthreads            = nthreads,
+        .engine              = engine
+    };
 
-    thread_data_shared *shared = calloc(1, sizeof(*shared));
+    // The same check pipeline_run() makes, before anything is started. The
+    // frames of a stream are images, whatever <in> is named.
+    if (!socket_path && !batch) {
+        pipeline_job checked = job;
 
-    strcpy(shared->filename_in,  argv[1]);
-    strcpy(shared->filename_out, argv[2]);
-    shared->nthreads = atol(argv[3]);
+        checked.filename_in = stream ? NULL : job.filename_in;
 
-    pthread_t threads[shared->nthreads];
+        const char *const error = pipeline_check(&checked);
 
-    for (long i = 0; i < NLOCKS; ++i) {
-        pthread_mutex_init(&shared->locks[i], NULL);
-    }
-    for (long i = 0; i < NBARRIERS; ++i) {
-        pthread_barrier_init(&shared->barriers[i],
-                            NULL,
-                            shared->nthreads);
+        if (error) {
+            fprintf(stderr, "%s\n", error);
+            exit(1);
+        }
     }
 
-    thread_data args[shared->nthreads];
-    int         rc;
+    kernels_init(kernel_forced, kernel_nforced, filename_profile, kernel_bench);
 
-    for (long i = 0; i < shared->nthreads; ++i) {
-        args[i] = (thread_data) { .shared = shared, .tid = i };
+    if (filename_folded) {
+        profiler_start(filename_folded, PROFILER_HZ);
+    }
 
-        if ((rc = pthread_create(&threads[i], NULL, worker, &args[i]))) {
-            return rc;
+    if (socket_path) {
+        rc = server_run(socket_path, filename_trace, coalesce, nthreads, engine, NULL);
+    } else if (batch) {
+        rc = batch_run(argv[optind], argv[optind + 1], nthreads, engine, NULL);
+    } else {
+        // The deadline starts once the kernels are picked
+        cancel_init(&cancel, deadline);
+        job.cancel = deadline ? &cancel : NULL;
+
+        if (stream) {
+            rc = stream_run(argv[optind], argv[optind + 1], &job);
+        } else {
+            rc = pipeline_run(&job) ? 0 : 1;
         }
-    }
-    for (long i = 0; i < shared->nthreads; ++i) {
-        if ((rc = pthread_join(threads[i], NULL))) {
-            return rc;
+        if (deadline && cancel.cancelled) {
+            fprintf(stderr, rc ? "Deadline of %ld ms exceeded, nothing was written\n"
+                               : "Deadline of %ld ms exceeded, only part of <out> is marched\n",
+                    deadline);
         }
     }
 
-    for (long i = 0; i < NLOCKS; ++i) {
-        pthread_mutex_destroy(&shared->locks[i]);
-    }
-    for (long i = 0; i < NBARRIERS; ++i) {
-        pthread_barrier_destroy(&shared->barriers[i]);
+    if (filename_folded) {
+        profiler_stop();
     }
-
-    return 0;
+    return rc;
 }
@@ -0,0 +1,110 @@
+# Copyright 2023, Robert-Ioan Constantinescu
+
+# Checks the Python bindings against the CLI: `make python build`, then
+# `python3 test_pymarching.py` from the repository (`make pytest` does both).
+
+import os
+import random
+import subprocess
+import sys
+import tempfile
+import unittest
+
+ROOT = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, ROOT)
+
+import marching_squares as ms  # noqa: E402
+
+STEP = 8
+
+
+def ppm(width, height, pixels):
+    return b"P6\n%d %d\n255\n" % (width, height) + bytes(pixels)
+
+
+def read_ppm(filename):
+    with open(filename, "rb") as f:
+        f.readline()
+        width, height = map(int, f.readline().split())
+        f.readline()
+        return width, height, f.read()
+
+
+class MarchTest(unittest.TestCase):
+    def setUp(self):
+        self.tmp = tempfile.TemporaryDirectory()
+        self.dir = self.tmp.name
+        self.contours = os.path.join(self.dir, "contours")
+        rng = random.Random(1)
+
+        # Random tiles, different enough that a wrong configuration shows
+        os.mkdir(self.contours)
+        for k in range(16):
+            self.write_tile(k, ppm(STEP, STEP, [rng.randrange(256) for _ in range(STEP * STEP * 3)]))
+
+        # Not square and small enough not to be rescaled, with a gradient
+        # for the contours to cross
+        self.width, self.height = 53, 37
+        self.pixels = bytes((x * 5 + y * 3 + rng.randrange(40)) % 256
+                            for y in range(self.height) for x in range(self.width) for _ in range(3))
+
+    def tearDown(self):
+        self.tmp.cleanup()
+
+    def write_tile(self, k, data):
+        with open(os.path.join(self.contours, "%d.ppm" % k), "wb") as f:
+            f.write(data)
+
+    def cli(self):
+        with open(os.path.join(self.dir, "in.ppm"), "wb") as f:
+            f.write(ppm(self.width, self.height, self.pixels))
+        subprocess.run([os.path.join(ROOT, "tema1_par"), "in.ppm", "out.ppm", "2"],
+                       cwd=self.dir, check=True)
+        return read_ppm(os.path.join(self.dir, "out.ppm"))
+
+    def march(self, source, **kwargs):
+        return bytes(memoryview(ms.march(source, contours=self.contours, **kwargs)).cast("B"))
+
+    def test_matches_cli(self):
+        width, height, expected = self.cli()
+        self.assertEqual((width, height), (self.width, self.height))
+
+        shape = (self.height, self.width, 3)
+        for source in (memoryview(self.pixels).cast("B", shape),
+                       memoryview(bytearray(self.pixels)).cast("B", shape)):
+            for threads, backend in ((1, None), (3, "pthread"), (4, "serial")):
+                self.assertEqual(self.march(source, threads=threads, backend=backend), expected)
+
+    def test_inplace(self):
+        _, _, expected = self.cli()
+        buffer = bytearray(self.pixels)
+
+        self.march(memoryview(buffer).cast("B", (self.height, self.width, 3)), inplace=True)
+        self.assertEqual(bytes(buffer), expected)
+
+    def test_bad_arguments(self):
+        source = memoryview(self.pixels).cast("B", (self.height, self.width, 3))
+
+        for kwargs in ({"output": "pixels"}, {"backend": "nope"}, {"threads": 0},
+                       {"inplace": True}):
+            with self.assertRaises(ValueError):
+                self.march(source, **kwargs)
+        with self.assertRaises(ValueError):
+            self.march(memoryview(self.pixels).cast("B", (self.height, self.width * 3, 1)))
+
+    def test_bad_contours(self):
+        source = memoryview(self.pixels).cast("B", (self.height, self.width, 3))
+
+        with self.assertRaises(FileNotFoundError):
+            ms.march(source, contours=os.path.join(self.dir, "missing"))
+
+        with open(os.path.join(self.contours, "5.ppm"), "rb") as f:
+            tile = f.read()
+        for bad in (tile[:len(tile) // 2], b"P3\n8 8\n255\n", ppm(4, 4, bytes(4 * 4 * 3))):
+            self.write_tile(5, bad)
+            with self.assertRaises(ValueError):
+                self.march(source)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,386 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "marching.h"
+#include "textgrid.h"
+
+// The powers of ten that are exact as floats
+static const float powers_of_ten[] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+static int is_separator(const char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == ',' || c == ';';
+}
+
+static const char *skip_separators(const char *p, const char *const end) {
+    while (p < end && is_separator(*p)) {
+        ++p;
+    }
+    return p;
+}
+
+// Parses the number at `p`, up to `end`, and returns what follows it, or
+// NULL if there's no number there; "nan" in any case is NaN, as printf()
+// writes it. A mantissa below 2^24 and a power of ten
+// up to 10 are both exact as floats, so their product or quotient is one
+// correctly rounded float operation; anything else is left to strtof().
+static const char *parse_float(const char *p, const char *const end, float *const value) {
+    const char *const start    = p;
+    uint64_t          mantissa = 0;
+    int               digits   = 0;    // significant ones in the mantissa
+    int               rounded  = 0;    // some past the 19th were dropped
+    int               scale    = 0;    // digits after the point, in the mantissa
+    int               any      = 0;
+    int               negative = 0;
+
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p++ == '-';
+    }
+    if (end - p >= 3 && !strncasecmp(p, "nan", 3)) {
+        *value = NAN;
+        return p + 3;
+    }
+    for (; p < end && *p >= '0' && *p <= '9'; ++p, any = 1) {
+        if (digits < 19) {
+            mantissa = mantissa * 10 + (*p - '0');
+            digits  += mantissa != 0;
+        } else {
+            rounded = 1;
+        }
+    }
+    if (p < end && *p == '.') {
+        for (++p; p < end && *p >= '0' && *p <= '9'; ++p, any = 1) {
+            if (digits < 19) {
+                mantissa = mantissa * 10 + (*p - '0');
+                digits  += mantissa != 0;
+                ++scale;
+            } else {
+                rounded = 1;
+            }
+        }
+    }
+    if (!any) {
+        return NULL;
+    }
+
+    int exponent = 0;
+
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char *q       = p + 1;
+        int         exp_neg = 0;
+        int         exp_any = 0;
+
+        if (q < end && (*q == '-' || *q == '+')) {
+            exp_neg = *q++ == '-';
+        }
+        for (; q < end && *q >= '0' && *q <= '9'; ++q, exp_any = 1) {
+            exponent = exponent < 10000 ? exponent * 10 + (*q - '0') : exponent;
+        }
+        if (!exp_any) {
+            return NULL;
+        }
+        exponent = exp_neg ? -exponent : exponent;
+        p        = q;
+    }
+    exponent -= scale;
+
+    if (!rounded && mantissa < (1ULL << 24) && exponent >= -10 && exponent <= 10) {
+        const float f = exponent < 0 ? (float) mantissa / powers_of_ten[-exponent]
+                                     : (float) mantissa * powers_of_ten[exponent];
+
+        *value = negative ? -f : f;
+        return p;
+    }
+
+    // The mapping has no terminating NUL to stop strtof() at
+    char buffer[64];
+
+    if (p - start >= (long) sizeof(buffer)) {
+        return NULL;
+    }
+    memcpy(buffer, start, p - start);
+    buffer[p - start] = '\0';
+    *value = strtof(buffer, NULL);
+    return p;
+}
+
+static const char *line_end(const text_grid *const grid, const char *const p) {
+    const char *const end = grid->base + grid->size;
+    const char *const eol = memchr(p, '\n', end - p);
+
+    return eol ? eol : end;
+}
+
+// Offset of the first line starting at or after `offset`
+static size_t line_start(const text_grid *const grid, const size_t offset) {
+    if (offset <= grid->body) {
+        return grid->body;
+    }
+    if (offset >= grid->size) {
+        return grid->size;
+    }
+    if (grid->base[offset - 1] == '\n') {
+        return offset;
+    }
+
+    const char *const eol = line_end(grid, grid->base + offset);
+
+    return eol < grid->base + grid->size ? (size_t) (eol - grid->base) + 1 : grid->size;
+}
+
+// The lines starting in the thread's share of the bytes
+static void text_grid_share(const text_grid *const grid, const long tid, const long nthreads,
+                            size_t *const start, size_t *const stop) {
+    const thread_slice slice = thread_get_slice(tid, nthreads, grid->size - grid->body);
+
+    *start = line_start(grid, grid->body + slice.start);
+    *stop  = line_start(grid, grid->body + slice.end);
+}
+
+int text_grid_probe(const char *filename) {
+    const size_t len = strlen(filename);
+    char         key[6] = { 0 };
+    FILE        *fp;
+
+    if (len > 4 && !strcasecmp(filename + len - 4, ".csv")) {
+        return 1;
+    }
+    if (!(fp = fopen(filename, "r"))) {
+        return 0;
+    }
+
+    const int esri = fscanf(fp, " %5s", key) == 1 && !strcasecmp(key, "ncols");
+
+    fclose(fp);
+    return esri;
+}
+
+static int is_blank(const char *p, const char *const eol) {
+    return skip_separators(p, eol) == eol;
+}
+
+// Reads the "key value" lines of an ESRI header
+static void text_grid_esri_header(text_grid *const grid) {
+    const char *p   = grid->base;
+    const char *end = grid->base + grid->size;
+
+    grid->nrows = grid->ncols = 0;
+    for (;;) {
+        p = skip_separators(p, end);
+        while (p < end && *p == '\n') {
+            p = skip_separators(p + 1, end);
+        }
+        // No key starts with "nan", which is the first value of the body
+        if (p == end || !isalpha((unsigned char) *p)
+            || (end - p >= 3 && !strncasecmp(p, "nan", 3))) {
+            break;
+        }
+
+        const char *const eol = line_end(grid, p);
+        char              key[32];
+        size_t            n = 0;
+
+        while (p < eol && !is_separator(*p) && n < sizeof(key) - 1) {
+            key[n++] = *p++;
+        }
+        key[n] = '\0';
+
+        p = skip_separators(p, eol);
+        if (!strcasecmp(key, "ncols") || !strcasecmp(key, "nrows")) {
+            long value = 0;
+
+            while (p < eol && *p >= '0' && *p <= '9') {
+                value = value * 10 + (*p++ - '0');
+            }
+            *(tolower((unsigned char) key[1]) == 'c' ? &grid->ncols : &grid->nrows) = value;
+        } else if (!strcasecmp(key, "NODATA_value")) {
+            const char *const next = parse_float(p, eol, &grid->nodata);
+
+            if (!next || !is_blank(next, eol)) {
+                fprintf(stderr, "Invalid NODATA_value (error loading '%s')\n", grid->filename);
+                exit(1);
+            }
+            grid->has_nodata = 1;
+        }
+
+        // The georeferencing doesn't change the contours
+        p = eol;
+    }
+
+    if (grid->ncols <= 0 || grid->nrows <= 0 || grid->ncols > INT32_MAX / grid->nrows) {
+        fprintf(stderr, "Invalid ESRI ASCII grid header (error loading '%s')\n", grid->filename);
+        exit(1);
+    }
+    grid->body = p - grid->base;
+}
+
+// The columns of a CSV matrix are those of its first row. A first line that
+// isn't all numbers names the columns, and is skipped.
+static void text_grid_csv_header(text_grid *const grid) {
+    const char *p = grid->base;
+
+    for (int line = 0; line < 2 && !grid->ncols; ++line) {
+        const char *const eol     = line_end(grid, p);
+        const char       *q       = skip_separators(p, eol);
+        long              columns = 0;
+        float             value;
+
+        while (q < eol && (q = parse_float(q, eol, &value)) && (q == eol || is_separator(*q))) {
+            q = skip_separators(q, eol);
+            ++columns;
+        }
+        if (q == eol && columns) {
+            grid->ncols = columns;
+            grid->body  = p - grid->base;
+        } else {
+            p = eol + (eol < grid->base + grid->size);
+        }
+    }
+
+    if (!grid->ncols) {
+        fprintf(stderr, "Invalid CSV matrix (error loading '%s')\n", grid->filename);
+        exit(1);
+    }
+    grid->nrows = -1;
+}
+
+text_grid *text_grid_open(const char *filename, const long nthreads) {
+    text_grid *const grid = calloc(1, sizeof(text_grid));
+    struct stat      st;
+    const int        fd   = open(filename, O_RDONLY);
+
+    if (fd < 0 || fstat(fd, &st)) {
+        fprintf(stderr, "Unable to open file '%s'\n", filename);
+        exit(1);
+    }
+    if (!st.st_size) {
+        fprintf(stderr, "Empty file '%s'\n", filename);
+        exit(1);
+    }
+
+    grid->filename = filename;
+    grid->size     = st.st_size;
+    grid->base     = mmap(NULL, grid->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (grid->base == MAP_FAILED) {
+        perror(filename);
+        exit(1);
+    }
+
+    // Read front to back, once
+    madvise(grid->base, grid->size, MADV_SEQUENTIAL);
+
+    const char *const p = skip_separators(grid->base, grid->base + grid->size);
+
+    if (grid->base + grid->size - p >= 5 && !strncasecmp(p, "ncols", 5)) {
+        text_grid_esri_header(grid);
+    } else {
+        text_grid_csv_header(grid);
+    }
+
+    grid->nthreads = nthreads;
+    grid->rows     = calloc(nthreads, sizeof(long));
+    return grid;
+}
+
+void text_grid_count(text_grid *const grid, const long tid, const long nthreads) {
+    size_t start, stop;
+    long   rows = 0;
+
+    text_grid_share(grid, tid, nthreads, &start, &stop);
+    for (const char *p = grid->base + start; p < grid->base + stop; ) {
+        const char *const eol = line_end(grid, p);
+
+        rows += !is_blank(p, eol);
+        p     = eol + 1;
+    }
+    grid->rows[tid] = rows;
+}
+
+void text_grid_layout(text_grid *const grid) {
+    long total = 0;
+
+    for (long t = 0; t < grid->nthreads; ++t) {
+        const long rows = grid->rows[t];
+
+        grid->rows[t]  = total;
+        total         += rows;
+    }
+
+    if (grid->nrows >= 0 && total != grid->nrows) {
+        fprintf(stderr, "'%s' has %ld rows instead of the %ld of its header\n",
+                grid->filename, total, grid->nrows);
+        exit(1);
+    }
+    if (!total || grid->ncols > INT32_MAX / total) {
+        fprintf(stderr, "Invalid CSV matrix (error loading '%s')\n", grid->filename);
+        exit(1);
+    }
+
+    grid->nrows       = total;
+    grid->field       = malloc(sizeof(float_image));
+    grid->field->x    = grid->ncols;
+    grid->field->y    = grid->nrows;
+    grid->field->data = malloc((size_t) grid->ncols * grid->nrows * sizeof(float));
+    grid->mask        = grid->has_nodata ? malloc((size_t) grid->ncols * grid->nrows) : NULL;
+    grid->laid_out    = 1;
+}
+
+void text_grid_parse(text_grid *const grid, const long tid, const long nthreads) {
+    size_t start, stop;
+    long   row = grid->rows[tid];
+
+    text_grid_share(grid, tid, nthreads, &start, &stop);
+    for (const char *p = grid->base + start; p < grid->base + stop; ) {
+        const char *const eol = line_end(grid, p);
+        float *const         out  = &grid->field->data[row * grid->ncols];
+        unsigned char *const mask = grid->mask ? &grid->mask[row * grid->ncols] : NULL;
+        long                 c    = 0;
+
+        if (is_blank(p, eol)) {
+            p = eol + 1;
+            continue;
+        }
+
+        for (p = skip_separators(p, eol); p < eol && c < grid->ncols; ++c) {
+            const char *const next = parse_float(p, eol, &out[c]);
+
+            if (!next || (next < eol && !is_separator(*next))) {
+                fprintf(stderr, "Invalid value in row %ld of '%s'\n", row + 1, grid->filename);
+                exit(1);
+            }
+            p = skip_separators(next, eol);
+        }
+        if (mask) {
+            for (long i = 0; i < c; ++i) {
+                mask[i] = out[i] != grid->nodata;
+            }
+        }
+        if (c < grid->ncols || p < eol) {
+            fprintf(stderr, "Row %ld of '%s' doesn't have %ld values\n", row + 1, grid->filename,
+                    grid->ncols);
+            exit(1);
+        }
+
+        ++row;
+        p = eol + 1;
+    }
+}
+
+void text_grid_close(text_grid *const grid) {
+    munmap(grid->base, grid->size);
+    free(grid->rows);
+    free(grid->mask);
+    free(grid);
+}
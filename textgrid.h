@@ -0,0 +1,54 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef TEXTGRID_H
+#define TEXTGRID_H
+
+#include <stddef.h>
+
+#include "pfm.h"
+
+// A float raster stored as text: an ESRI ASCII grid (the ncols, nrows, ...
+// header, then one row per line, top to bottom) or a CSV matrix (one row
+// per line, the values separated by commas, semicolons or blanks, after an
+// optional line of column names). The file is mapped, and its lines are
+// split across the threads, each parsing the rows that start in its share
+// of the bytes. The cells of an ESRI grid holding its NODATA_value are left
+// out of `mask`.
+typedef struct {
+    const char    *filename;
+    char          *base;       // the mapping
+    size_t         size;
+    size_t         body;       // offset of the first row
+    long           nrows;      // from the header, or -1 until the lines are counted
+    long           ncols;
+    long           nthreads;
+    long          *rows;       // rows in every thread's share, then the first row of it
+    int            laid_out;
+    int            has_nodata;
+    float          nodata;     // NODATA_value, if the header has one
+    float_image   *field;
+    unsigned char *mask;       // with a NODATA_value, nonzero for the cells with data,
+                               // in the order of the field
+} text_grid;
+
+// Whether `filename` looks like one: an ESRI header, or a *.csv name
+int text_grid_probe(const char *filename);
+
+// Maps the file and reads its header; the rows are parsed by the phases
+// below, on `nthreads` threads
+text_grid *text_grid_open(const char *filename, const long nthreads);
+
+// Counts the rows of the thread's share of the lines
+void text_grid_count(text_grid *const grid, const long tid, const long nthreads);
+
+// Sizes the field once every share is counted, from a single thread
+void text_grid_layout(text_grid *const grid);
+
+// Parses the rows of the thread's share into the field
+void text_grid_parse(text_grid *const grid, const long tid, const long nthreads);
+
+// Unmaps the file. The field is the caller's, and so is the mask if the
+// caller took it, leaving NULL.
+void text_grid_close(text_grid *const grid);
+
+#endif
@@ -0,0 +1,119 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/stat.h>
+
+#include "marching.h"
+#include "tiles.h"
+
+tile_layout *tile_layout_create(const char *dirname,
+                                const int   x,
+                                const int   y,
+                                const int   tile_x,
+                                const int   tile_y) {
+    tile_layout *const layout = malloc(sizeof(tile_layout));
+    const long         p      = y / STEP;
+    const long         q      = x / STEP;
+
+    if (tile_x <= 0 || tile_y <= 0 || tile_x % STEP || tile_y % STEP) {
+        fprintf(stderr, "Tile sizes must be multiples of %d\n", STEP);
+        exit(1);
+    }
+    if (mkdir(dirname, 0755) && errno != EEXIST) {
+        perror(dirname);
+        exit(1);
+    }
+
+    layout->dirname = strdup(dirname);
+    layout->x       = x;
+    layout->y       = y;
+    layout->tile_x  = tile_x;
+    layout->tile_y  = tile_y;
+    layout->rows    = p ? (p + tile_y / STEP - 1) / (tile_y / STEP) : 1;
+    layout->cols    = q ? (q + tile_x / STEP - 1) / (tile_x / STEP) : 1;
+
+    return layout;
+}
+
+void tile_layout_free(tile_layout *const layout) {
+    free(layout->dirname);
+    free(layout);
+}
+
+void tile_bounds(const tile_layout *const layout,
+                 const long t,
+                 long *r0, long *r1,
+                 long *c0, long *c1) {
+    const long row = t / layout->cols;
+    const long col = t % layout->cols;
+
+    *r0 = row * layout->tile_y;
+    *r1 = row == layout->rows - 1 ? layout->y : *r0 + layout->tile_y;
+    *c0 = col * layout->tile_x;
+    *c1 = col == layout->cols - 1 ? layout->x : *c0 + layout->tile_x;
+}
+
+void tile_row_span(const tile_layout *const layout, const long row, long *start, long *end) {
+    long r0, r1, c0, c1;
+
+    tile_bounds(layout, row * layout->cols, &r0, &r1, &c0, &c1);
+    *start = r0 * layout->x;
+    *end   = r1 * layout->x;
+}
+
+static void tile_filename(const tile_layout *const layout, const long t, char *const filename) {
+    sprintf(filename, "%s/tile_%ld_%ld.ppm", layout->dirname, t / layout->cols, t % layout->cols);
+}
+
+void write_tile_row(const tile_layout *const layout,
+                    const long row,
+                    const ppm_pixel *const pixels,
+                    const long offset) {
+    char      filename[strlen(layout->dirname) + 64];
+    ppm_image tile = { .data = malloc((layout->tile_x + STEP) * (layout->tile_y + STEP)
+                                      * sizeof(ppm_pixel)) };
+
+    for (long t = row * layout->cols; t < (row + 1) * layout->cols; ++t) {
+        long r0, r1, c0, c1;
+
+        tile_bounds(layout, t, &r0, &r1, &c0, &c1);
+        tile.x = c1 - c0;
+        tile.y = r1 - r0;
+        for (long r = r0; r < r1; ++r) {
+            memcpy(&tile.data[(r - r0) * tile.x], &pixels[r * layout->x + c0 - offset],
+                   tile.x * sizeof(ppm_pixel));
+        }
+
+        tile_filename(layout, t, filename);
+        write_ppm(&tile, filename);
+    }
+
+    free(tile.data);
+}
+
+void write_tile_manifest(const tile_layout *const layout) {
+    char  filename[strlen(layout->dirname) + 64];
+    FILE *fp;
+
+    sprintf(filename, "%s/manifest.txt", layout->dirname);
+    fp = fopen(filename, "w");
+    if (!fp) {
+        fprintf(stderr, "Unable to open file '%s'\n", filename);
+        exit(1);
+    }
+
+    fprintf(fp, "size %ld %ld\n", layout->x, layout->y);
+    fprintf(fp, "tiles %ld %ld\n", layout->cols, layout->rows);
+    for (long t = 0; t < layout->rows * layout->cols; ++t) {
+        long r0, r1, c0, c1;
+
+        tile_bounds(layout, t, &r0, &r1, &c0, &c1);
+        fprintf(fp, "tile_%ld_%ld.ppm %ld %ld %ld %ld\n",
+                t / layout->cols, t % layout->cols, c0, r0, c1 - c0, r1 - r0);
+    }
+
+    fclose(fp);
+}
@@ -0,0 +1,49 @@
+/* Copyright 2023, Robert-Ioan Constantinescu */
+
+#ifndef TILES_H
+#define TILES_H
+
+#include "helpers.h"
+
+// The output file split into rows x cols tiles of tile_x x tile_y pixels,
+// in the geometry write_ppm() gives it: x is the width, and the pixels are
+// stored a row of the file after the other. The tiles of the last row and
+// column also take the pixels left over past the last multiple of STEP.
+typedef struct {
+    char *dirname;
+    long  x, y;
+    long  tile_x, tile_y;
+    long  rows, cols;
+} tile_layout;
+
+// `tile_x` (width) and `tile_y` (height) must be multiples of STEP.
+// Creates `dirname` if needed.
+tile_layout *tile_layout_create(const char *dirname,
+                                const int   x,
+                                const int   y,
+                                const int   tile_x,
+                                const int   tile_y);
+
+void tile_layout_free(tile_layout *const layout);
+
+// Rows [*r0, *r1) and columns [*c0, *c1) of the file covered by tile `t`
+void tile_bounds(const tile_layout *const layout,
+                 const long t,
+                 long *r0, long *r1,
+                 long *c0, long *c1);
+
+// Pixels [*start, *end) of the output, in the order of its data, that the
+// tiles of row `row` are cut from
+void tile_row_span(const tile_layout *const layout, const long row, long *start, long *end);
+
+// Cuts the tiles of row `row` out of `pixels`, which holds the output from
+// pixel `offset` on, and writes them
+void write_tile_row(const tile_layout *const layout,
+                    const long row,
+                    const ppm_pixel *const pixels,
+                    const long offset);
+
+// Lists every tile with its position, once they have all been written
+void write_tile_manifest(const tile_layout *const layout);
+
+#endif